@@ -0,0 +1,249 @@
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MeshCache.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Rx {
+
+namespace fs = std::filesystem;
+
+static_assert(sizeof(MeshCacheHeader) % 16 == 0);
+static_assert(sizeof(CachedMesh) % 16 == 0);
+static_assert(sizeof(CachedMaterial) % 16 == 0);
+
+static uint64_t AlignUp(uint64_t value) {
+    return (value + 15) & ~uint64_t(15);
+}
+
+static bool GetSourceStamp(const std::string& path, uint64_t& size, uint64_t& time) {
+    std::error_code ec;
+    size = fs::file_size(path, ec);
+    if (ec)
+        return false;
+    time = (uint64_t)fs::last_write_time(path, ec).time_since_epoch().count();
+    return !ec;
+}
+
+uint32_t MeshCacheWriter::addString(const std::string& str) {
+    const uint32_t offset = (uint32_t)m_Strings.size();
+    m_Strings.insert(m_Strings.end(), str.begin(), str.end());
+    m_Strings.push_back('\0');
+    return offset;
+}
+
+void MeshCacheWriter::addMesh(const std::vector<Vertex>&   vertices,
+                              const std::vector<uint32_t>& indices,
+                              uint32_t                     materialIndex) {
+    CachedMesh mesh{};
+    mesh.firstVertex   = (uint32_t)m_Vertices.size();
+    mesh.vertexCount   = (uint32_t)vertices.size();
+    mesh.firstIndex    = (uint32_t)m_Indices.size();
+    mesh.indexCount    = (uint32_t)indices.size();
+    mesh.materialIndex = materialIndex;
+    m_Meshes.push_back(mesh);
+
+    m_Vertices.insert(m_Vertices.end(), vertices.begin(), vertices.end());
+    m_Indices.insert(m_Indices.end(), indices.begin(), indices.end());
+}
+
+const char* MeshCacheWriter::string(uint32_t offset) const {
+    if (offset == CachedMaterial::NO_STRING || offset >= m_Strings.size())
+        return nullptr;
+    return m_Strings.data() + offset;
+}
+
+std::vector<uint8_t> MeshCacheWriter::serialize(const std::string& sourcePath) const {
+    MeshCacheHeader header{};
+    GetSourceStamp(sourcePath, header.sourceSize, header.sourceTime);
+
+    header.meshCount      = (uint32_t)m_Meshes.size();
+    header.materialCount  = (uint32_t)m_Materials.size();
+    header.vertexCount    = m_Vertices.size();
+    header.indexCount     = m_Indices.size();
+    header.meshOffset     = sizeof(MeshCacheHeader);
+    header.materialOffset = AlignUp(header.meshOffset + m_Meshes.size() * sizeof(CachedMesh));
+    header.vertexOffset   = AlignUp(header.materialOffset + m_Materials.size() * sizeof(CachedMaterial));
+    header.indexOffset    = AlignUp(header.vertexOffset + m_Vertices.size() * sizeof(Vertex));
+    header.stringOffset   = AlignUp(header.indexOffset + m_Indices.size() * sizeof(uint32_t));
+    header.stringSize     = m_Strings.size();
+
+    std::vector<uint8_t> bytes(header.stringOffset + header.stringSize, 0);
+    auto put = [&](uint64_t offset, const void* data, size_t size) {
+        if (size)
+            std::memcpy(bytes.data() + offset, data, size);
+    };
+    put(0, &header, sizeof(header));
+    put(header.meshOffset, m_Meshes.data(), m_Meshes.size() * sizeof(CachedMesh));
+    put(header.materialOffset, m_Materials.data(), m_Materials.size() * sizeof(CachedMaterial));
+    put(header.vertexOffset, m_Vertices.data(), m_Vertices.size() * sizeof(Vertex));
+    put(header.indexOffset, m_Indices.data(), m_Indices.size() * sizeof(uint32_t));
+    put(header.stringOffset, m_Strings.data(), m_Strings.size());
+    return bytes;
+}
+
+bool MeshCacheWriter::write(const std::string& path, const std::vector<uint8_t>& bytes) {
+    // Written under a temporary name so an interrupted cook never leaves a
+    // truncated cache behind
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+        file.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+        if (!file)
+            return false;
+    }
+
+    std::error_code ec;
+    fs::rename(tmpPath, path, ec);
+    return !ec;
+}
+
+bool MeshCache::open(const std::string& path, const std::string& sourcePath) {
+    close();
+
+    uint64_t sourceSize = 0, sourceTime = 0;
+    if (!fs::exists(path) || !GetSourceStamp(sourcePath, sourceSize, sourceTime))
+        return false;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size{};
+    GetFileSizeEx(file, &size);
+    HANDLE mapping = size.QuadPart ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+
+    m_Handle = mapping;
+    m_Size   = (size_t)size.QuadPart;
+    m_Data   = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return false;
+
+    // Geometry is read front to back exactly once
+    madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+    madvise(data, (size_t)st.st_size, MADV_WILLNEED);
+    m_Size = (size_t)st.st_size;
+    m_Data = static_cast<const uint8_t*>(data);
+#endif
+
+    m_Mapped = true;
+    if (!validate(path))
+        return false;
+
+    if (m_Header->sourceSize != sourceSize || m_Header->sourceTime != sourceTime) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MeshCache::adopt(std::vector<uint8_t>&& bytes) {
+    close();
+    m_Owned = std::move(bytes);
+    m_Data  = m_Owned.data();
+    m_Size  = m_Owned.size();
+    return validate("<in-memory cook>");
+}
+
+bool MeshCache::validate(const std::string& name) {
+    if (!m_Data || m_Size < sizeof(MeshCacheHeader)) {
+        close();
+        return false;
+    }
+
+    m_Header = reinterpret_cast<const MeshCacheHeader*>(m_Data);
+
+    // Sections are checked by subtraction so no offset or count from the file
+    // can wrap the bounds test
+    const uint64_t size = m_Size;
+    auto           fits = [size](uint64_t offset, uint64_t count, uint64_t stride) {
+        return offset <= size && count <= (size - offset) / stride;
+    };
+
+    const MeshCacheHeader& h = *m_Header;
+    const bool             valid =
+        h.magic == MeshCacheHeader::MAGIC && h.version == MeshCacheHeader::VERSION && h.vertexStride == sizeof(Vertex) &&
+        fits(h.meshOffset, h.meshCount, sizeof(CachedMesh)) &&
+        fits(h.materialOffset, h.materialCount, sizeof(CachedMaterial)) &&
+        fits(h.vertexOffset, h.vertexCount, sizeof(Vertex)) && fits(h.indexOffset, h.indexCount, sizeof(uint32_t)) &&
+        fits(h.stringOffset, h.stringSize, 1) && (h.stringSize == 0 || m_Data[h.stringOffset + h.stringSize - 1] == '\0');
+
+    if (!valid) {
+        RENDERX_WARN("MeshCache: '{}' is corrupt or from another version, recooking", name);
+        close();
+        return false;
+    }
+
+    for (uint32_t i = 0; i < h.meshCount; i++) {
+        const CachedMesh& m = mesh(i);
+        if (m.firstVertex > h.vertexCount || m.vertexCount > h.vertexCount - m.firstVertex ||
+            m.firstIndex > h.indexCount || m.indexCount > h.indexCount - m.firstIndex ||
+            m.materialIndex >= h.materialCount) {
+            RENDERX_WARN("MeshCache: '{}' has out-of-range mesh {}, recooking", name, i);
+            close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void MeshCache::close() {
+    if (m_Mapped)
+        unmap();
+    m_Owned.clear();
+    m_Owned.shrink_to_fit();
+    m_Data   = nullptr;
+    m_Size   = 0;
+    m_Header = nullptr;
+    m_Mapped = false;
+}
+
+void MeshCache::unmap() {
+#if defined(_WIN32)
+    if (m_Data)
+        UnmapViewOfFile(m_Data);
+    if (m_Handle)
+        CloseHandle(m_Handle);
+#else
+    if (m_Data)
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+    m_Handle = nullptr;
+}
+
+const char* MeshCache::string(uint32_t offset) const {
+    if (offset == CachedMaterial::NO_STRING || offset >= m_Header->stringSize)
+        return nullptr;
+    return at<char>(m_Header->stringOffset + offset);
+}
+
+} // namespace Rx
@@ -0,0 +1,130 @@
+#pragma once
+#include "ModelRenderer.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Cooked model format. The first load of a model runs Assimp once and writes
+// the final Vertex/index arrays, material parameters and texture paths next to
+// it as <model>.rxmesh; later loads memory-map that file and upload geometry
+// straight from the mapping.
+//
+// Layout (all offsets from the start of the file, 16-byte aligned):
+//   MeshCacheHeader
+//   CachedMesh[meshCount]
+//   CachedMaterial[materialCount]
+//   Vertex[vertexCount]
+//   uint32_t[indexCount]
+//   string blob (NUL-terminated, indexed by byte offset)
+
+namespace Rx {
+
+struct MeshCacheHeader {
+    static constexpr uint32_t MAGIC   = 0x434D5852; // "RXMC"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic          = MAGIC;
+    uint32_t version        = VERSION;
+    uint32_t vertexStride   = sizeof(Vertex);
+    uint32_t meshCount      = 0;
+    uint32_t materialCount  = 0;
+    uint32_t _pad           = 0;
+    uint64_t vertexCount    = 0;
+    uint64_t indexCount     = 0;
+    uint64_t sourceSize     = 0; // source model size and write time; a
+    uint64_t sourceTime     = 0; // mismatch means the cache is stale
+    uint64_t meshOffset     = 0;
+    uint64_t materialOffset = 0;
+    uint64_t vertexOffset   = 0;
+    uint64_t indexOffset    = 0;
+    uint64_t stringOffset   = 0;
+    uint64_t stringSize     = 0;
+    uint64_t _reserved      = 0;
+};
+
+struct CachedMesh {
+    uint32_t firstVertex;
+    uint32_t vertexCount;
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    uint32_t materialIndex;
+    uint32_t _pad[3];
+};
+
+enum class CachedTexture : uint32_t { ALBEDO, NORMAL, METAL_ROUGH, AO, COUNT };
+
+struct CachedMaterial {
+    static constexpr uint32_t NO_STRING = UINT32_MAX;
+
+    glm::vec4 baseColor;
+    float     metallic;
+    float     roughness;
+    uint32_t  name;                                     // string offset
+    uint32_t  textures[(uint32_t)CachedTexture::COUNT]; // string offsets, NO_STRING when absent
+    uint32_t  _pad;
+};
+
+// Accumulates a cooked model in memory and writes it in one go
+class MeshCacheWriter {
+public:
+    uint32_t addString(const std::string& str);
+    void     addMesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, uint32_t materialIndex);
+    void     addMaterial(const CachedMaterial& material) { m_Materials.push_back(material); }
+
+    // Same material accessors as MeshCache, for reading a cook in progress
+    uint32_t              materialCount() const { return (uint32_t)m_Materials.size(); }
+    const CachedMaterial& material(uint32_t i) const { return m_Materials[i]; }
+    const char*           string(uint32_t offset) const;
+
+    // Lays the cooked model out in the file format, stamped with `sourcePath`
+    std::vector<uint8_t> serialize(const std::string& sourcePath) const;
+
+    static bool write(const std::string& path, const std::vector<uint8_t>& bytes);
+
+private:
+    std::vector<CachedMesh>     m_Meshes;
+    std::vector<CachedMaterial> m_Materials;
+    std::vector<Vertex>         m_Vertices;
+    std::vector<uint32_t>       m_Indices;
+    std::vector<char>           m_Strings;
+};
+
+// Read-only view of a memory-mapped cache file
+class MeshCache {
+public:
+    MeshCache() = default;
+    ~MeshCache() { close(); }
+
+    MeshCache(const MeshCache&)            = delete;
+    MeshCache& operator=(const MeshCache&) = delete;
+
+    // Fails when the file is missing, corrupt, from another version or older
+    // than `sourcePath`
+    bool open(const std::string& path, const std::string& sourcePath);
+    // Uses an in-memory cook directly, for when the cache cannot be written
+    bool adopt(std::vector<uint8_t>&& bytes);
+    void close();
+
+    uint32_t              meshCount() const { return m_Header->meshCount; }
+    uint32_t              materialCount() const { return m_Header->materialCount; }
+    const CachedMesh&     mesh(uint32_t i) const { return at<CachedMesh>(m_Header->meshOffset)[i]; }
+    const CachedMaterial& material(uint32_t i) const { return at<CachedMaterial>(m_Header->materialOffset)[i]; }
+    const Vertex*         vertices() const { return at<Vertex>(m_Header->vertexOffset); }
+    const uint32_t*       indices() const { return at<uint32_t>(m_Header->indexOffset); }
+    const char*           string(uint32_t offset) const;
+
+private:
+    template <typename T> const T* at(uint64_t offset) const { return reinterpret_cast<const T*>(m_Data + offset); }
+
+    bool validate(const std::string& name);
+    void unmap();
+
+    const uint8_t*         m_Data   = nullptr;
+    size_t                 m_Size   = 0;
+    const MeshCacheHeader* m_Header = nullptr;
+    void*                  m_Handle = nullptr; // file mapping object on Windows
+    bool                   m_Mapped = false;
+    std::vector<uint8_t>   m_Owned; // backing store after adopt()
+};
+
+} // namespace Rx
@@ -1,4 +1,6 @@
 #include "ModelRenderer.h"
+#include "MeshCache.h"
+#include <RenderX/RX_KTX2.h>
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -10,7 +12,13 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
 #include "Files.h"
 
 namespace Rx {
@@ -28,6 +36,100 @@ static glm::vec2 toGlm2(const aiVector3D& v) {
     return {v.x, v.y};
 }
 
+// Runs `work(i)` for every i in [0, count) on a pool of worker threads and
+// calls `consume(i)` on the calling thread as each item finishes, so GPU
+// resource creation overlaps with the CPU work still in flight.
+template <typename Work, typename Consume> static void RunJobs(uint32_t count, Work&& work, Consume&& consume) {
+    if (count == 0)
+        return;
+
+    const uint32_t workerCount = std::min(count, std::max(1u, std::thread::hardware_concurrency()));
+
+    std::atomic<uint32_t>   next{0};
+    std::mutex              mutex;
+    std::condition_variable finished;
+    std::vector<uint32_t>   done;
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (uint32_t w = 0; w < workerCount; w++) {
+        workers.emplace_back([&]() {
+            for (uint32_t i = next++; i < count; i = next++) {
+                work(i);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    done.push_back(i);
+                }
+                finished.notify_one();
+            }
+        });
+    }
+
+    std::vector<uint32_t> ready;
+    for (uint32_t consumed = 0; consumed < count; consumed += static_cast<uint32_t>(ready.size())) {
+        ready.clear();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&]() { return !done.empty(); });
+            ready.swap(done);
+        }
+        for (uint32_t i : ready)
+            consume(i);
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+}
+
+static void DecodeImage(TextureJob& job) {
+    int channels = 0;
+    job.pixels   = stbi_load(job.path.c_str(), &job.width, &job.height, &channels, STBI_rgb_alpha);
+}
+
+// Worker side: reads a block-compressed sibling (albedo.png -> albedo.ktx2)
+// when there is one, otherwise decodes the image to RGBA8
+static void DecodeTexture(TextureJob& job) {
+    fs::path ktx2 = fs::path(job.path).replace_extension(".ktx2");
+    if (fs::exists(ktx2)) {
+        std::ifstream file(ktx2, std::ios::binary | std::ios::ate);
+        if (file) {
+            job.ktx2.resize((size_t)file.tellg());
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(job.ktx2.data()), (std::streamsize)job.ktx2.size());
+            return;
+        }
+    }
+    DecodeImage(job);
+}
+
+// Worker side: interleaves one mesh's vertices and flattens its faces
+static void ConvertMesh(const aiMesh* aiM, MeshJob& job) {
+    job.vertices.reserve(aiM->mNumVertices);
+    for (uint32_t v = 0; v < aiM->mNumVertices; v++) {
+        Vertex vert;
+        vert.position = toGlm(aiM->mVertices[v]);
+        vert.normal   = aiM->HasNormals() ? toGlm(aiM->mNormals[v]) : glm::vec3(0, 1, 0);
+        vert.uv       = aiM->HasTextureCoords(0) ? toGlm2(aiM->mTextureCoords[0][v]) : glm::vec2(0);
+        if (aiM->HasTangentsAndBitangents()) {
+            glm::vec3 T    = toGlm(aiM->mTangents[v]);
+            glm::vec3 B    = toGlm(aiM->mBitangents[v]);
+            glm::vec3 N    = vert.normal;
+            float     sign = glm::dot(glm::cross(N, T), B) < 0.0f ? -1.0f : 1.0f;
+            vert.tangent   = glm::vec4(T, sign);
+        } else {
+            vert.tangent = glm::vec4(1, 0, 0, 1);
+        }
+        job.vertices.push_back(vert);
+    }
+
+    job.indices.reserve(static_cast<size_t>(aiM->mNumFaces) * 3);
+    for (uint32_t f = 0; f < aiM->mNumFaces; f++) {
+        const aiFace& face = aiM->mFaces[f];
+        for (uint32_t fi = 0; fi < face.mNumIndices; fi++)
+            job.indices.push_back(face.mIndices[fi]);
+    }
+}
+
 void ModelRenderer::init(Swapchain* swapchain, CommandQueue* graphics, const RendererConfig& config) {
     m_Swapchain = swapchain;
     m_Graphics  = graphics;
@@ -38,8 +140,14 @@ void ModelRenderer::init(Swapchain* swapchain, CommandQueue* graphics, const Ren
     createShadowResources();
     createDepthBuffer();
     createDescriptorPool();
+    createMaterialBuffer();
     createPipelines();
     createFrameResources();
+
+    m_Geometry = Rx::CreateGeometryPool(GeometryPoolDesc(sizeof(Vertex))
+                                            .setMaxVertices(m_Config.maxVertices)
+                                            .setMaxIndices(m_Config.maxIndices)
+                                            .setDebugName("ModelGeometry"));
 }
 
 void ModelRenderer::createSetLayouts() {
@@ -50,17 +158,14 @@ void ModelRenderer::createSetLayouts() {
                                 .add(Binding::Texture(1, PipelineStage::FRAGMENT))            // shadowMap
                                 .add(Binding::Sampler(2, PipelineStage::FRAGMENT))            // shadowSampler
                                 .add(Binding::Sampler(3, PipelineStage::FRAGMENT))            // textureSampler
+                                .add(Binding::StorageBuffer(4, false, PipelineStage::FRAGMENT)) // materials
                                 .setDebugName("FrameSetLayout"));
 
-    // Set 1 — per-material, bound per mesh
-    m_MaterialSetLayout =
-        Rx::CreateSetLayout(SetLayoutDesc()
-                                .add(Binding::Texture(0, PipelineStage::FRAGMENT))        // albedo
-                                .add(Binding::Texture(1, PipelineStage::FRAGMENT))        // normal
-                                .add(Binding::Texture(2, PipelineStage::FRAGMENT))        // metalRough
-                                .add(Binding::Texture(3, PipelineStage::FRAGMENT))        // ao
-                                .add(Binding::ConstantBuffer(4, PipelineStage::FRAGMENT)) // MaterialUBO
-                                .setDebugName("MaterialSetLayout"));
+    // Set 1 — bindless textures, bound once per pass; materials index into it
+    m_Bindless = Rx::CreateBindlessTable(BindlessTableDesc()
+                                             .setCapacity(m_Config.maxTextures, 0, 0)
+                                             .setSetIndex(1)
+                                             .setDebugName("MaterialTextures"));
 }
 
 void ModelRenderer::createPipelines() {
@@ -72,7 +177,7 @@ void ModelRenderer::createPipelines() {
                            .addAttribute(VertexAttribute::Vec4(3, 0, offsetof(Vertex, tangent)));
 
     // ── Forward / PBR pipeline 
-    SetLayoutHandle   forwardSets[] = {m_FrameSetLayout, m_MaterialSetLayout};
+    SetLayoutHandle   forwardSets[] = {m_FrameSetLayout, Rx::GetBindlessSetLayout(m_Bindless)};
     PushConstantRange pushRange[]   = {PushConstantRange::Vertex(sizeof(PushConstants))};
     m_ForwardLayout                 = Rx::CreatePipelineLayout(forwardSets, 2, pushRange, 1);
 
@@ -169,24 +274,38 @@ void ModelRenderer::createFallbackTextures() {
     // We want non-metal (0) medium-rough (0.5), so G=128
     m_FallbackBlack = createSolidTexture(0, 128, 0, 255, "FallbackMetalRough");
 
-    m_FallbackWhiteView  = Rx::CreateTextureView(TextureViewDesc::Default(m_FallbackWhite));
-    m_FallbackNormalView = Rx::CreateTextureView(TextureViewDesc::Default(m_FallbackNormal));
-    m_FallbackBlackView  = Rx::CreateTextureView(TextureViewDesc::Default(m_FallbackBlack));
+    m_FallbackWhiteView  = Rx::CreateTextureView(TextureViewDesc::Default(m_FallbackWhite).setBindless(m_Bindless));
+    m_FallbackNormalView = Rx::CreateTextureView(TextureViewDesc::Default(m_FallbackNormal).setBindless(m_Bindless));
+    m_FallbackBlackView  = Rx::CreateTextureView(TextureViewDesc::Default(m_FallbackBlack).setBindless(m_Bindless));
 }
 
 void ModelRenderer::createDescriptorPool() {
     m_DescriptorPool =
-        Rx::CreateDescriptorPool(DescriptorPoolDesc::Persistent(SetLayoutHandle(0), 1000).setDebugName("RendererPool"));
+        Rx::CreateDescriptorPool(DescriptorPoolDesc::Persistent(m_FrameSetLayout, m_Config.framesInFlight)
+                                     .setGrowable()
+                                     .setDebugName("RendererPool"));
+}
+
+void ModelRenderer::createMaterialBuffer() {
+    const uint64_t size = sizeof(MaterialData) * m_Config.maxMaterials;
+
+    m_MaterialBuffer =
+        Rx::CreateBuffer(BufferDesc::StorageBuffer(size, MemoryType::GPU_ONLY).setDebugName("MaterialBuffer"));
+    m_MaterialView = Rx::CreateBufferView(BufferViewDesc::WholeBuffer(m_MaterialBuffer));
+    m_Uploads      = new UploadService(UploadServiceDesc().setBytesPerFrame(4 * 1024 * 1024));
+
+    // Handed out lowest slot first
+    m_FreeMaterialSlots.resize(m_Config.maxMaterials);
+    for (uint32_t i = 0; i < m_Config.maxMaterials; i++)
+        m_FreeMaterialSlots[i] = m_Config.maxMaterials - 1 - i;
 }
 
 void ModelRenderer::createFrameResources() {
+    m_FrameContext = Rx::CreateFrameContext(FrameContextDesc(m_Swapchain, m_Config.framesInFlight));
     m_Frames.resize(m_Config.framesInFlight);
 
 
     for (auto& frame : m_Frames) {
-        frame.graphicsAlloc = m_Graphics->CreateCommandAllocator();
-        frame.graphicsCmd   = frame.graphicsAlloc->Allocate();
-
         // Camera UBO — one per frame so we don't stomp in-flight data
         frame.cameraBuffer = Rx::CreateBuffer(
             BufferDesc::UniformBuffer(sizeof(CameraUBO), MemoryType::CPU_TO_GPU).setDebugName("CameraUBO"));
@@ -201,59 +320,212 @@ void ModelRenderer::createFrameResources() {
             DescriptorWrite::Texture(1, m_ShadowView),
             DescriptorWrite::Sampler(2, m_ShadowSampler),
             DescriptorWrite::Sampler(3, m_TextureSampler),
+            DescriptorWrite::StorageBuf(4, m_MaterialView),
         };
-        Rx::WriteSet(frame.frameSet, writes, 4);
+        Rx::WriteSet(frame.frameSet, writes, 5);
     }
 }
 
-int ModelRenderer::loadModel(const std::string& path) {
-    Assimp::Importer importer;
-
+// An Assimp import held open while its meshes are converted
+struct ModelCook {
+    Assimp::Importer           importer;
+    MeshCacheWriter            writer;
+    std::vector<const aiMesh*> sceneMeshes;
+    std::vector<MeshJob>       meshJobs;
+};
+
+// Runs Assimp and its post-processing once and records the materials. The
+// meshes are converted by the caller's job pool, alongside texture decoding.
+static bool BeginCook(const std::string& path, ModelCook& cook) {
     const aiScene* scene =
-        importer.ReadFile(path,
-                          aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace |
-                              aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality |
-                              aiProcess_GlobalScale | aiProcess_PreTransformVertices);
+        cook.importer.ReadFile(path,
+                               aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace |
+                                   aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality |
+                                   aiProcess_GlobalScale | aiProcess_PreTransformVertices);
 
     if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-        RENDERX_ERROR("ModelRenderer::loadModel: assimp failed to load '{}': {}", path, importer.GetErrorString());
-        return -1;
+        RENDERX_ERROR("ModelRenderer::loadModel: assimp failed to load '{}': {}", path, cook.importer.GetErrorString());
+        return false;
     }
 
-    Model model;
-    model.path   = path;
-    fs::path dir = fs::path(path).parent_path();
-
-    // Load materials
-    model.materials.resize(scene->mNumMaterials);
+    MeshCacheWriter& writer = cook.writer;
 
     for (uint32_t i = 0; i < scene->mNumMaterials; i++) {
         const aiMaterial* aiMat = scene->mMaterials[i];
-        Material&         mat   = model.materials[i];
 
         aiString matName;
         aiMat->Get(AI_MATKEY_NAME, matName);
-        mat.name = matName.C_Str();
 
-        // Helper to load a texture by type, fall back to handle if missing
-        auto tryLoad = [&](aiTextureType type, bool srgb) -> TextureHandle {
+        CachedMaterial mat{};
+        mat.name = writer.addString(matName.C_Str());
+
+        auto textureRef = [&](aiTextureType type) {
             aiString texPath;
-            if (aiMat->GetTexture(type, 0, &texPath) == AI_SUCCESS) {
-                std::string fullPath = (dir / texPath.C_Str()).string();
-                return loadTexture(fullPath, srgb);
-            }
-            return TextureHandle{};
+            if (aiMat->GetTexture(type, 0, &texPath) != AI_SUCCESS)
+                return CachedMaterial::NO_STRING;
+            return writer.addString(texPath.C_Str());
+        };
+        mat.textures[(uint32_t)CachedTexture::ALBEDO]      = textureRef(aiTextureType_DIFFUSE);
+        mat.textures[(uint32_t)CachedTexture::NORMAL]      = textureRef(aiTextureType_NORMALS);
+        mat.textures[(uint32_t)CachedTexture::METAL_ROUGH] = textureRef(aiTextureType_METALNESS);
+        mat.textures[(uint32_t)CachedTexture::AO]          = textureRef(aiTextureType_AMBIENT_OCCLUSION);
+
+        // Base color
+        aiColor4D baseColor(1, 1, 1, 1);
+        aiMat->Get(AI_MATKEY_COLOR_DIFFUSE, baseColor);
+        mat.baseColor = {baseColor.r, baseColor.g, baseColor.b, baseColor.a};
+
+        // Metallic / roughness
+        mat.metallic  = 0.0f;
+        mat.roughness = 0.5f;
+        aiMat->Get(AI_MATKEY_METALLIC_FACTOR, mat.metallic);
+        aiMat->Get(AI_MATKEY_ROUGHNESS_FACTOR, mat.roughness);
+
+        writer.addMaterial(mat);
+    }
+
+    // Gather meshes (walk node tree)
+    std::function<void(aiNode*)> processNode = [&](aiNode* node) {
+        for (uint32_t m = 0; m < node->mNumMeshes; m++)
+            cook.sceneMeshes.push_back(scene->mMeshes[node->mMeshes[m]]);
+        for (uint32_t c = 0; c < node->mNumChildren; c++)
+            processNode(node->mChildren[c]);
+    };
+    processNode(scene->mRootNode);
+
+    cook.meshJobs.resize(cook.sceneMeshes.size());
+    return true;
+}
+
+// Lays the converted meshes out as a mesh cache, writes it and hands it to `cache`
+static bool FinishCook(const std::string& path, ModelCook& cook, MeshCache& cache) {
+    // Scene order regardless of completion order
+    for (uint32_t m = 0; m < cook.meshJobs.size(); m++) {
+        cook.writer.addMesh(cook.meshJobs[m].vertices, cook.meshJobs[m].indices, cook.sceneMeshes[m]->mMaterialIndex);
+        cook.meshJobs[m] = {};
+    }
+
+    std::vector<uint8_t> bytes = cook.writer.serialize(path);
+    const std::string    cachePath = path + ".rxmesh";
+    if (!MeshCacheWriter::write(cachePath, bytes))
+        RENDERX_WARN("ModelRenderer::loadModel: could not write '{}', the model will be cooked again", cachePath);
+
+    return cache.adopt(std::move(bytes));
+}
+
+struct TextureSlot {
+    uint32_t                 material;
+    TextureHandle Material::*texture;
+};
+
+// One decode job per texture a material references. `source` is a MeshCache
+// or a MeshCacheWriter still being cooked.
+template <typename Source>
+static void RequestTextures(const Source&             source,
+                            const fs::path&           dir,
+                            std::vector<TextureJob>&  textureJobs,
+                            std::vector<TextureSlot>& textureSlots) {
+    for (uint32_t i = 0; i < source.materialCount(); i++) {
+        const CachedMaterial& cached = source.material(i);
+
+        auto request = [&](CachedTexture type, bool srgb, TextureHandle Material::*texture) {
+            const char* texPath = source.string(cached.textures[(uint32_t)type]);
+            if (!texPath)
+                return;
+            TextureJob job;
+            job.path = (dir / texPath).string();
+            job.srgb = srgb;
+            textureJobs.push_back(std::move(job));
+            textureSlots.push_back({i, texture});
         };
 
-        mat.albedoTex     = tryLoad(aiTextureType_DIFFUSE, true);            // sRGB
-        mat.normalTex     = tryLoad(aiTextureType_NORMALS, false);           // linear
-        mat.metalRoughTex = tryLoad(aiTextureType_METALNESS, false);         // linear
-        mat.aoTex         = tryLoad(aiTextureType_AMBIENT_OCCLUSION, false); // linear
+        request(CachedTexture::ALBEDO, true, &Material::albedoTex);           // sRGB
+        request(CachedTexture::NORMAL, false, &Material::normalTex);          // linear
+        request(CachedTexture::METAL_ROUGH, false, &Material::metalRoughTex); // linear
+        request(CachedTexture::AO, false, &Material::aoTex);                  // linear
+    }
+}
+
+int ModelRenderer::loadModel(const std::string& path) {
+    // Later runs map the cooked file and never touch Assimp
+    MeshCache                  cache;
+    std::unique_ptr<ModelCook> cook;
+    if (!cache.open(path + ".rxmesh", path)) {
+        RENDERX_INFO("ModelRenderer::loadModel: cooking '{}'", path);
+        cook = std::make_unique<ModelCook>();
+        if (!BeginCook(path, *cook))
+            return -1;
+    }
+
+    Model model;
+    model.path   = path;
+    fs::path dir = fs::path(path).parent_path();
+
+    // Textures are decoded on the worker pool, alongside the mesh conversion
+    // when the model is being cooked
+    std::vector<TextureJob>  textureJobs;
+    std::vector<TextureSlot> textureSlots;
+    if (cook) {
+        RequestTextures(cook->writer, dir, textureJobs, textureSlots);
+        model.materials.resize(cook->writer.materialCount());
+    } else {
+        RequestTextures(cache, dir, textureJobs, textureSlots);
+        model.materials.resize(cache.materialCount());
+    }
+
+    const uint32_t textureCount = static_cast<uint32_t>(textureJobs.size());
+    const uint32_t meshCount    = cook ? static_cast<uint32_t>(cook->meshJobs.size()) : 0;
+    RunJobs(
+        textureCount + meshCount,
+        [&](uint32_t i) {
+            if (i < textureCount)
+                DecodeTexture(textureJobs[i]);
+            else
+                ConvertMesh(cook->sceneMeshes[i - textureCount], cook->meshJobs[i - textureCount]);
+        },
+        [&](uint32_t i) {
+            if (i >= textureCount)
+                return;
+            const TextureSlot& slot                        = textureSlots[i];
+            model.materials[slot.material].*(slot.texture) = createTexture(textureJobs[i]);
+        });
+
+    if (cook && !FinishCook(path, *cook, cache)) {
+        for (Material& mat : model.materials)
+            for (TextureHandle* tex : {&mat.albedoTex, &mat.normalTex, &mat.metalRoughTex, &mat.aoTex})
+                if (tex->isValid())
+                    Rx::DestroyTexture(*tex);
+        return -1;
+    }
+
+    // Geometry goes from the mapping straight into staging
+    for (uint32_t m = 0; m < cache.meshCount(); m++) {
+        const CachedMesh& cachedMesh = cache.mesh(m);
+
+        Mesh mesh;
+        mesh.geometry      = m_Geometry->push(cache.vertices() + cachedMesh.firstVertex,
+                                         cachedMesh.vertexCount,
+                                         cache.indices() + cachedMesh.firstIndex,
+                                         cachedMesh.indexCount);
+        mesh.materialIndex = cachedMesh.materialIndex;
+        if (!mesh.geometry.isValid())
+            continue;
+
+        model.meshes.push_back(mesh);
+    }
+
+    for (uint32_t i = 0; i < cache.materialCount(); i++) {
+        const CachedMaterial& cached = cache.material(i);
+        Material&             mat    = model.materials[i];
+
+        const char* name = cache.string(cached.name);
+        mat.name         = name ? name : "";
 
         // Create views — use fallback if texture missing
         auto makeView = [&](TextureHandle tex, TextureViewHandle fallback) -> TextureViewHandle {
             if (tex.isValid())
-                return Rx::CreateTextureView(TextureViewDesc::Default(tex));
+                return Rx::CreateTextureView(
+                    TextureViewDesc::Default(tex).setMipRange(0, TextureViewDesc::ALL_MIPS).setBindless(m_Bindless));
             return fallback;
         };
 
@@ -269,146 +541,86 @@ int ModelRenderer::loadModel(const std::string& path) {
         mat.params.flags.hasAO         = mat.aoTex.isValid() ? 1 : 0;
         mat.params.normalStrength      = 1.0f;
         mat.params.aoStrength          = 1.0f;
+        mat.params.baseColor           = cached.baseColor;
+        mat.params.metallic            = cached.metallic;
+        mat.params.roughness           = cached.roughness;
 
-        // Base color
-        aiColor4D baseColor(1, 1, 1, 1);
-        aiMat->Get(AI_MATKEY_COLOR_DIFFUSE, baseColor);
-        mat.params.baseColor = {baseColor.r, baseColor.g, baseColor.b, baseColor.a};
-
-        // Metallic / roughness
-        float metallic = 0.0f, roughness = 0.5f;
-        aiMat->Get(AI_MATKEY_METALLIC_FACTOR, metallic);
-        aiMat->Get(AI_MATKEY_ROUGHNESS_FACTOR, roughness);
-        mat.params.metallic  = metallic;
-        mat.params.roughness = roughness;
-
-        // Upload MaterialUBO and build per-material descriptor set
-        buildMaterialSet(mat);
+        // Texture indices and parameters go into the shared material buffer
+        writeMaterial(mat);
     }
 
-    // Load meshes (walk node tree) 
-    std::function<void(aiNode*)> processNode = [&](aiNode* node) {
-        glm::mat4 nodeTransform = toGlm(node->mTransformation);
-        (void)nodeTransform; // we use per-instance push constants for the model matrix
-
-        for (uint32_t m = 0; m < node->mNumMeshes; m++) {
-            const aiMesh* aiM = scene->mMeshes[node->mMeshes[m]];
-
-            std::vector<Vertex>   vertices;
-            std::vector<uint32_t> indices;
-            vertices.reserve(aiM->mNumVertices);
-
-            for (uint32_t v = 0; v < aiM->mNumVertices; v++) {
-                Vertex vert;
-                vert.position = toGlm(aiM->mVertices[v]);
-                vert.normal   = aiM->HasNormals() ? toGlm(aiM->mNormals[v]) : glm::vec3(0, 1, 0);
-                vert.uv       = aiM->HasTextureCoords(0) ? toGlm2(aiM->mTextureCoords[0][v]) : glm::vec2(0);
-                if (aiM->HasTangentsAndBitangents()) {
-                    glm::vec3 T    = toGlm(aiM->mTangents[v]);
-                    glm::vec3 B    = toGlm(aiM->mBitangents[v]);
-                    glm::vec3 N    = vert.normal;
-                    float     sign = glm::dot(glm::cross(N, T), B) < 0.0f ? -1.0f : 1.0f;
-                    vert.tangent   = glm::vec4(T, sign);
-                } else {
-                    vert.tangent = glm::vec4(1, 0, 0, 1);
-                }
-                vertices.push_back(vert);
-            }
-
-            for (uint32_t f = 0; f < aiM->mNumFaces; f++) {
-                const aiFace& face = aiM->mFaces[f];
-                for (uint32_t fi = 0; fi < face.mNumIndices; fi++)
-                    indices.push_back(face.mIndices[fi]);
-            }
-
-            Mesh mesh;
-            mesh.vertexBuffer  = uploadBuffer(vertices.data(), vertices.size() * sizeof(Vertex), BufferFlags::VERTEX);
-            mesh.indexBuffer   = uploadBuffer(indices.data(), indices.size() * sizeof(uint32_t), BufferFlags::INDEX);
-            mesh.indexCount    = static_cast<uint32_t>(indices.size());
-            mesh.materialIndex = aiM->mMaterialIndex;
-
-            model.meshes.push_back(mesh);
-        }
-
-        for (uint32_t c = 0; c < node->mNumChildren; c++)
-            processNode(node->mChildren[c]);
-    };
-
-    processNode(scene->mRootNode);
-
     m_Models.push_back(std::move(model));
     return static_cast<int>(m_Models.size() - 1);
 }
 
-TextureHandle ModelRenderer::loadTexture(const std::string& path, bool srgb) {
-    int      w, h, channels;
-    stbi_uc* pixels = stbi_load(path.c_str(), &w, &h, &channels, STBI_rgb_alpha);
-    if (!pixels) {
-        RENDERX_WARN("ModelRenderer::loadTexture: failed to load '{}', using fallback", path);
+TextureHandle ModelRenderer::createTexture(TextureJob& job) {
+    const std::string name = fs::path(job.path).filename().string();
+
+    if (!job.ktx2.empty()) {
+        auto tex = Rx::LoadKTX2FromMemory(job.ktx2.data(), job.ktx2.size(), nullptr, name.c_str());
+        job.ktx2 = {};
+        if (tex.isValid())
+            return tex;
+        RENDERX_WARN("ModelRenderer::createTexture: KTX2 sibling of '{}' unusable, decoding it instead", job.path);
+        DecodeImage(job);
+    }
+
+    if (!job.pixels) {
+        RENDERX_WARN("ModelRenderer::createTexture: failed to load '{}', using fallback", job.path);
         return TextureHandle{};
     }
 
-    Format fmt      = srgb ? Format::RGBA8_SRGB : Format::RGBA8_UNORM;
-    size_t dataSize = static_cast<size_t>(w) * h * 4;
+    Format fmt      = job.srgb ? Format::RGBA8_SRGB : Format::RGBA8_UNORM;
+    size_t dataSize = static_cast<size_t>(job.width) * job.height * 4;
 
-    auto tex = Rx::CreateTexture(TextureDesc::Texture2D(w, h, fmt)
+    auto tex = Rx::CreateTexture(TextureDesc::Texture2D(job.width, job.height, fmt)
                                      .setUsage(TextureUsage::SAMPLED | TextureUsage::TRANSFER_DST)
-                                     //.setGeneratedMips()
-                                     .setInitialData(pixels, (uint32_t)dataSize)
-                                     .setDebugName(fs::path(path).filename().string().c_str()));
+                                     .setGeneratedMips()
+                                     .setInitialData(job.pixels, (uint32_t)dataSize)
+                                     .setDebugName(name.c_str()));
 
-    stbi_image_free(pixels);
+    stbi_image_free(job.pixels);
+    job.pixels = nullptr;
     return tex;
 }
 
-BufferHandle ModelRenderer::uploadBuffer(const void* data, size_t size, BufferFlags usage) {
-    BufferDesc desc = (usage == BufferFlags::VERTEX) ? BufferDesc::VertexBuffer(size, MemoryType::GPU_ONLY, data)
-                                                     : BufferDesc::IndexBuffer(size, MemoryType::GPU_ONLY, data);
-
-    return Rx::CreateBuffer(desc);
-}
-
-void ModelRenderer::buildMaterialSet(Material& mat) {
-    // Upload MaterialUBO
-    auto matBuffer =
-        Rx::CreateBuffer(BufferDesc::UniformBuffer(sizeof(MaterialUBO), MemoryType::CPU_TO_GPU, &mat.params));
-    auto matView = Rx::CreateBufferView(BufferViewDesc::WholeBuffer(matBuffer));
-
-    mat.descriptorSet = Rx::AllocateSet(m_DescriptorPool, m_MaterialSetLayout);
-
-    DescriptorWrite writes[] = {
-        DescriptorWrite::Texture(0, mat.albedoView),
-        DescriptorWrite::Texture(1, mat.normalView),
-        DescriptorWrite::Texture(2, mat.metalRoughView),
-        DescriptorWrite::Texture(3, mat.aoView),
-        DescriptorWrite::CBV(4, matView),
-    };
-    Rx::WriteSet(mat.descriptorSet, writes, 5);
+void ModelRenderer::writeMaterial(Material& mat) {
+    if (m_FreeMaterialSlots.empty()) {
+        RENDERX_WARN("ModelRenderer: material buffer is full, '{}' uses material 0", mat.name);
+        return;
+    }
+    mat.slot = m_FreeMaterialSlots.back();
+    m_FreeMaterialSlots.pop_back();
+
+    mat.params.albedoIndex     = Rx::GetTextureViewBindlessIndex(mat.albedoView);
+    mat.params.normalIndex     = Rx::GetTextureViewBindlessIndex(mat.normalView);
+    mat.params.metalRoughIndex = Rx::GetTextureViewBindlessIndex(mat.metalRoughView);
+    mat.params.aoIndex         = Rx::GetTextureViewBindlessIndex(mat.aoView);
+
+    // unloadModel waits for the GPU before returning slots, so nothing in flight
+    // reads this one; the frame that draws the material waits for the copy
+    m_Uploads->UploadBuffer(m_MaterialBuffer,
+                            &mat.params,
+                            sizeof(MaterialData),
+                            (uint64_t)mat.slot * sizeof(MaterialData),
+                            UploadPriority::HIGH);
 }
 
 void ModelRenderer::render(
     float aspect, const Camera& camera, glm::vec3 lightDir, glm::vec3 lightColor, float lightIntensity) {
-    auto& frame = m_Frames[m_FrameIndex];
-
-    // Wait for this frame slot to finish its previous GPU work
-    m_Graphics->Wait(frame.T);
-
-    uint32_t imageIndex = m_Swapchain->AcquireNextImage();
-
-    frame.graphicsAlloc->Reset();
-    frame.graphicsCmd->open();
+    // Waits for this frame slot's previous GPU work, acquires the next image
+    // and hands back an open command list
+    const FrameInfo& info  = m_FrameContext->BeginFrame();
+    auto&            frame = m_Frames[info.frameIndex];
 
     updateFrameData(frame, aspect, camera, lightDir, lightColor, lightIntensity);
-    shadowPass(frame.graphicsCmd, frame);
-    forwardPass(frame.graphicsCmd, frame, imageIndex, aspect);
-
-    frame.graphicsCmd->close();
-
-    frame.T = m_Graphics->Submit(SubmitInfo::Single(frame.graphicsCmd).setSwapchainWrite());
-
-    m_Swapchain->Present(imageIndex);
+    shadowPass(info.commandList, frame);
+    forwardPass(info.commandList, frame, info.imageIndex, aspect);
 
-    m_FrameIndex = (m_FrameIndex + 1) % m_Config.framesInFlight;
+    // Streams this frame's share of queued uploads; the draws above wait on it
+    const Timeline  uploaded = m_Uploads->Process();
+    QueueDependency dep(QueueType::TRANSFER, uploaded);
+    m_FrameContext->EndFrame(&dep, uploaded.value ? 1 : 0);
 }
 
 void ModelRenderer::updateFrameData(
@@ -490,8 +702,10 @@ void        ModelRenderer::forwardPass(CommandList* cmd, RendererFrame& frame, u
     cmd->setViewport(0, 0, (int)w, (int)h);
     cmd->setScissor(0, 0, w, h);
 
-    // Set 0 — frame data (camera, shadow map, samplers) — bound once
+    // Set 0 — frame data (camera, shadow map, samplers, materials) and
+    // set 1 — every material texture; nothing is bound per draw
     cmd->setDescriptorSet(0, frame.frameSet);
+    cmd->setBindlessTable(m_Bindless);
 
     drawMeshes(cmd, false);
 
@@ -505,6 +719,9 @@ void        ModelRenderer::forwardPass(CommandList* cmd, RendererFrame& frame, u
 }
 
 void ModelRenderer::drawMeshes(CommandList* cmd, bool isShadowPass) {
+    // Every mesh shares the pool's buffers, so they are bound once per pass
+    m_Geometry->bind(cmd);
+
     for (auto& model : m_Models) {
         for (auto& mesh : model.meshes) {
             auto& mat = model.materials[mesh.materialIndex];
@@ -514,13 +731,11 @@ void ModelRenderer::drawMeshes(CommandList* cmd, bool isShadowPass) {
             pc.normalMatrix = glm::transpose(glm::inverse(pc.model));
             cmd->pushConstants(0, &pc, sizeof(PushConstants));
 
-            if (!isShadowPass) {
-                cmd->setDescriptorSet(1, mat.descriptorSet);
-            }
-
-            cmd->setVertexBuffer(mesh.vertexBuffer);
-            cmd->setIndexBuffer(mesh.indexBuffer);
-            cmd->drawIndexed(mesh.indexCount);
+            // The material slot rides in firstInstance; pbr.vert forwards
+            // gl_InstanceIndex to the fragment shader
+            const GeometryAllocation& geo = mesh.geometry;
+            const uint32_t            slot = mat.slot != UINT32_MAX ? mat.slot : 0;
+            cmd->drawIndexed(geo.indexCount, geo.vertexOffset, 1, geo.firstIndex, slot);
         }
     }
 }
@@ -546,12 +761,11 @@ void ModelRenderer::unloadModel(int index) {
     m_Graphics->WaitIdle();
 
     auto& model = m_Models[index];
-    for (auto& mesh : model.meshes) {
-        Rx::DestroyBuffer(mesh.vertexBuffer);
-        Rx::DestroyBuffer(mesh.indexBuffer);
-    }
+    for (auto& mesh : model.meshes)
+        m_Geometry->free(mesh.geometry);
     for (auto& mat : model.materials) {
-        Rx::FreeSet(m_DescriptorPool, mat.descriptorSet);
+        if (mat.slot != UINT32_MAX)
+            m_FreeMaterialSlots.push_back(mat.slot);
         if (mat.albedoTex.isValid()) {
             Rx::DestroyTextureView(mat.albedoView);
             Rx::DestroyTexture(mat.albedoTex);
@@ -585,11 +799,23 @@ void ModelRenderer::shutdown() {
         Rx::FreeSet(m_DescriptorPool, frame.frameSet);
         Rx::DestroyBufferView(frame.cameraView);
         Rx::DestroyBuffer(frame.cameraBuffer);
-        frame.graphicsAlloc->Free(frame.graphicsCmd);
-        m_Graphics->DestroyCommandAllocator(frame.graphicsAlloc);
     }
     m_Frames.clear();
-    m_Graphics = nullptr;
+
+    m_Uploads->Flush();
+    delete m_Uploads;
+    m_Uploads = nullptr;
+    Rx::DestroyBufferView(m_MaterialView);
+    Rx::DestroyBuffer(m_MaterialBuffer);
+    m_FreeMaterialSlots.clear();
+    Rx::DestroyBindlessTable(m_Bindless);
+
+    Rx::DestroyGeometryPool(m_Geometry);
+    m_Geometry = nullptr;
+
+    Rx::DestroyFrameContext(m_FrameContext);
+    m_FrameContext = nullptr;
+    m_Graphics     = nullptr;
 }
 
 } // namespace Rx
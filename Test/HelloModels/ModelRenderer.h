@@ -1,6 +1,7 @@
 #pragma once
 #include <glm/glm.hpp>
 #include <RenderX/RenderX.h>
+#include <RenderX/RX_UploadService.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <string>
 #include <vector>
@@ -24,18 +25,22 @@ struct MaterialFlags {
     uint32_t _pad : 28;
 };
 
-// GPU-side material constant buffer
-// std140 layout
-struct MaterialUBO {
+// One entry of the material storage buffer, std430 layout. Draws pick their
+// entry through firstInstance; textures are bindless table indices.
+struct MaterialData {
     glm::vec4     baseColor; // fallback color if no albedo
     float         metallic;  // fallback if no metalRough map
     float         roughness; // fallback if no metalRough map
     float         normalStrength;
     float         aoStrength;
     MaterialFlags flags;
-    float         _pad[3];
+    uint32_t      albedoIndex;
+    uint32_t      normalIndex;
+    uint32_t      metalRoughIndex;
+    uint32_t      aoIndex;
+    uint32_t      _pad[3];
 };
-static_assert(sizeof(MaterialUBO) % 16 == 0);
+static_assert(sizeof(MaterialData) % 16 == 0);
 
 // GPU-side per-frame data
 struct CameraUBO {
@@ -67,19 +72,33 @@ struct Material {
     TextureViewHandle metalRoughView;
     TextureViewHandle aoView;
 
-    // Per-material descriptor set (set 1)
-    SetHandle descriptorSet;
+    // Entry in the renderer's material buffer
+    uint32_t slot = UINT32_MAX;
 
     // CPU data
-    MaterialUBO params;
-    std::string name;
+    MaterialData params;
+    std::string  name;
 };
 
+// Vertex and index ranges live in the renderer's shared GeometryPool
 struct Mesh {
-    BufferHandle vertexBuffer;
-    BufferHandle indexBuffer;
-    uint32_t     indexCount;
-    uint32_t     materialIndex;
+    GeometryAllocation geometry;
+    uint32_t           materialIndex;
+};
+
+// CPU results produced on the loader's worker threads
+struct TextureJob {
+    std::string          path;
+    bool                 srgb = false;
+    std::vector<uint8_t> ktx2;             // raw KTX2 file, uploaded without decoding
+    unsigned char*       pixels = nullptr; // RGBA8 from stb_image otherwise
+    int                  width  = 0;
+    int                  height = 0;
+};
+
+struct MeshJob {
+    std::vector<Vertex>   vertices;
+    std::vector<uint32_t> indices;
 };
 
 struct Model {
@@ -88,11 +107,9 @@ struct Model {
     std::string           path;
 };
 
+// Command lists and pacing come from the FrameContext; this only holds the
+// app-side data that has to be duplicated per frame in flight.
 struct RendererFrame {
-    CommandAllocator* graphicsAlloc = nullptr;
-    CommandAllocator* computeAlloc  = nullptr;
-    CommandList*      graphicsCmd   = nullptr;
-
     // Per-frame camera + light data
     BufferHandle     cameraBuffer;
     BufferViewHandle cameraView;
@@ -100,8 +117,6 @@ struct RendererFrame {
 
     // Per-frame descriptor set (set 0)
     SetHandle frameSet;
-
-    Timeline T = Timeline(0);
 };
 
 struct RendererConfig {
@@ -110,6 +125,14 @@ struct RendererConfig {
     Format   colorFormat    = Format::BGRA8_SRGB;
     Format   depthFormat    = Format::D32_SFLOAT;
     Format   shadowFormat   = Format::D32_SFLOAT;
+
+    // Capacity of the shared geometry pool
+    uint32_t maxVertices = 4 * 1024 * 1024;
+    uint32_t maxIndices  = 16 * 1024 * 1024;
+
+    // Capacity of the material buffer and the bindless texture array
+    uint32_t maxMaterials = 4096;
+    uint32_t maxTextures  = 16384;
 };
 
 struct Camera {
@@ -161,6 +184,7 @@ private:
     void createDepthBuffer();
     void createFallbackTextures();
     void createDescriptorPool();
+    void createMaterialBuffer();
     void createFrameResources();
 
     // ── Per-frame helpers ─────────────────────────────────────────────────
@@ -175,9 +199,8 @@ private:
     void drawMeshes(CommandList* cmd, bool shadowPass);
 
     // ── Model loading helpers ─────────────────────────────────────────────
-    TextureHandle loadTexture(const std::string& path, bool srgb);
-    BufferHandle  uploadBuffer(const void* data, size_t size, BufferFlags usage);
-    void          buildMaterialSet(Material& mat);
+    TextureHandle createTexture(TextureJob& job);
+    void          writeMaterial(Material& mat);
 
     glm::mat4 computeLightSpaceMatrix(glm::vec3 lightDir) const;
 
@@ -187,8 +210,19 @@ private:
     RendererConfig m_Config    = {};
 
     // Set layouts
-    SetLayoutHandle m_FrameSetLayout;    // set 0
-    SetLayoutHandle m_MaterialSetLayout; // set 1
+    SetLayoutHandle m_FrameSetLayout; // set 0
+
+    // Every texture a material can sample, plus the fallbacks (set 1)
+    BindlessTableHandle m_Bindless;
+
+    // MaterialData for every loaded material, indexed by Material::slot.
+    // GPU-only; entries stream in through m_Uploads.
+    BufferHandle          m_MaterialBuffer;
+    BufferViewHandle      m_MaterialView;
+    std::vector<uint32_t> m_FreeMaterialSlots;
+
+    // Drained once per frame in render(); the frame waits on what it submits
+    UploadService* m_Uploads = nullptr;
 
     // Pipeline layouts
     PipelineLayoutHandle m_ForwardLayout;
@@ -216,12 +250,15 @@ private:
     TextureViewHandle m_FallbackNormalView;
     TextureViewHandle m_FallbackBlackView;
 
-    // Descriptor pool — shared for frame sets and material sets
+    // Descriptor pool for the frame sets
     DescriptorPoolHandle m_DescriptorPool;
 
     // Per-frame resources
+    FrameContext*              m_FrameContext = nullptr;
     std::vector<RendererFrame> m_Frames;
-    uint32_t                   m_FrameIndex = 0;
+
+    // Vertex/index storage shared by every loaded mesh
+    GeometryPool* m_Geometry = nullptr;
 
     // Loaded models
     std::vector<Model> m_Models;
@@ -128,6 +128,7 @@ int main(int argc, char** argv) {
     Rx::InitDesc initInfo{};
     initInfo.api                = Rx::GraphicsAPI::VULKAN;
     initInfo.instanceExtensions = glfwGetRequiredInstanceExtensions(&initInfo.extensionCount);
+    initInfo.pipelineCachePath  = "HelloModels.rxpipelines";
 
 #if defined(_WIN32)
     initInfo.nativeWindowHandle = glfwGetWin32Window(window);
@@ -154,6 +155,8 @@ int main(int argc, char** argv) {
     }
 
     Rx::FlushUploads();
+    // KTX2 textures are queued on the asynchronous upload path
+    Rx::GetGpuQueue(Rx::QueueType::TRANSFER)->Wait(Rx::SubmitUploads());
 
     glm::vec3 lightDir       = glm::normalize(glm::vec3(-1.0f, -2.0f, -1.0f));
     glm::vec3 lightColor     = {1.0f, 0.95f, 0.88f}; // warm white
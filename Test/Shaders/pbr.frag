@@ -1,5 +1,6 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
+#extension GL_EXT_nonuniform_qualifier : require
 
 layout(location = 0) in vec3 inWorldPos;
 layout(location = 1) in vec3 inNormal;
@@ -7,6 +8,7 @@ layout(location = 2) in vec2 inUV;
 layout(location = 3) in vec3 inTangent;
 layout(location = 4) in vec3 inBitangent;
 layout(location = 5) in vec4 inLightSpacePos;
+layout(location = 6) flat in uint inMaterial;
 
 layout(location = 0) out vec4 outColor;
 
@@ -24,21 +26,28 @@ layout(set = 0, binding = 1) uniform texture2D shadowMap;
 layout(set = 0, binding = 2) uniform samplerShadow shadowSampler;
 layout(set = 0, binding = 3) uniform sampler textureSampler;
 
-layout(set = 1, binding = 0) uniform texture2D albedoTex;
-layout(set = 1, binding = 1) uniform texture2D normalTex;
-layout(set = 1, binding = 2) uniform texture2D metalRoughTex;
-layout(set = 1, binding = 3) uniform texture2D aoTex;
-
-layout(set = 1, binding = 4) uniform MaterialUBO {
+struct Material {
     vec4  baseColor;
     float metallic;
     float roughness;
     float normalStrength;
     float aoStrength;
     uint  flags; // bit 0=hasAlbedo, 1=hasNormal, 2=hasMetalRough, 3=hasAO
-    float _pad[3];
-}
-material;
+    uint  albedoIndex;
+    uint  normalIndex;
+    uint  metalRoughIndex;
+    uint  aoIndex;
+    uint  _pad[3];
+};
+
+layout(std430, set = 0, binding = 4) readonly buffer Materials {
+    Material materials[];
+};
+
+// Bindless table; materials hold indices into it
+layout(set = 1, binding = 0) uniform texture2D textures[];
+
+Material material;
 
 bool hasAlbedo() {
     return (material.flags & 1u) != 0u;
@@ -124,14 +133,20 @@ float sampleShadow(vec4 lightSpacePos) {
     return shadow / 9.0;
 }
 
+vec4 sampleMaterialTexture(uint index) {
+    return texture(sampler2D(textures[nonuniformEXT(index)], textureSampler), inUV);
+}
+
 void main() {
-    vec4 albedo4 = hasAlbedo() ? texture(sampler2D(albedoTex, textureSampler), inUV) : material.baseColor;
+    material = materials[inMaterial];
+
+    vec4 albedo4 = hasAlbedo() ? sampleMaterialTexture(material.albedoIndex) : material.baseColor;
     vec3 albedo  = albedo4.rgb;
 
     // Normal mapping
     vec3 N;
     if (hasNormal()) {
-        vec3 tsNormal  = texture(sampler2D(normalTex, textureSampler), inUV).xyz;
+        vec3 tsNormal  = sampleMaterialTexture(material.normalIndex).xyz;
         tsNormal       = tsNormal * 2.0 - 1.0;
         tsNormal.xy   *= material.normalStrength;
         tsNormal       = normalize(tsNormal);
@@ -144,7 +159,7 @@ void main() {
 
     float metallic, roughness;
     if (hasMetalRough()) {
-        vec4 mr   = texture(sampler2D(metalRoughTex, textureSampler), inUV);
+        vec4 mr   = sampleMaterialTexture(material.metalRoughIndex);
         metallic  = mr.b; // glTF: B=metallic, G=roughness
         roughness = mr.g;
     } else {
@@ -153,7 +168,7 @@ void main() {
     }
     roughness = max(roughness, 0.04); // clamp to avoid specular singularity
 
-    float ao = hasAO() ? texture(sampler2D(aoTex, textureSampler), inUV).r : 1.0;
+    float ao = hasAO() ? sampleMaterialTexture(material.aoIndex).r : 1.0;
     ao       = 1.0 + material.aoStrength * (ao - 1.0); // remap by strength
 
     // F0: base reflectivity — 0.04 for dielectrics, albedo for metals
@@ -12,6 +12,7 @@ layout(location = 2) out vec2 outUV;
 layout(location = 3) out vec3 outTangent;
 layout(location = 4) out vec3 outBitangent;
 layout(location = 5) out vec4 outLightSpacePos;
+layout(location = 6) flat out uint outMaterial; // material slot, passed as firstInstance
 
 layout(set = 0, binding = 0) uniform CameraUBO {
     mat4 view;
@@ -43,6 +44,7 @@ void main() {
 
     outUV            = inUV;
     outLightSpacePos = camera.lightSpaceMatrix * worldPos;
+    outMaterial      = gl_InstanceIndex;
 
     gl_Position = camera.proj * camera.view * worldPos;
 }
@@ -0,0 +1,189 @@
+// rx_replay — loads a frame capture written by Rx::EndCapture and replays it
+// N times, reporting CPU record time and submit-to-completion time per iteration.
+//
+//   rx_replay <capture.rxcap> [iterations] [--window]
+//
+// Replay runs headless by default: no surface, no swapchain, nothing shown.
+// --window initializes through a hidden GLFW window instead, for drivers that
+// will not create a device without a presentable surface.
+//
+// Submit-to-completion is wall-clock time from Submit until Wait returns on
+// the graphics timeline. It is not GPU execution time: it also includes
+// queueing, submission and wake-up latency. Timestamp queries are not exposed
+// through the CommandList API yet.
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#if defined(_WIN32)
+#define GLFW_EXPOSE_NATIVE_WIN32
+#include <GLFW/glfw3native.h>
+#elif defined(__linux__)
+#define GLFW_EXPOSE_NATIVE_X11
+#define GLFW_EXPOSE_NATIVE_WAYLAND
+#include <GLFW/glfw3native.h>
+#endif
+
+#include "RenderX/RX_Capture.h"
+#include "RenderX/RenderX.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point from, Clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+struct Stats {
+    std::vector<double> samples;
+
+    void add(double ms) { samples.push_back(ms); }
+
+    void print(const char* label) {
+        if (samples.empty())
+            return;
+        std::sort(samples.begin(), samples.end());
+        double total = 0.0;
+        for (double s : samples)
+            total += s;
+        std::printf("%-24s avg %8.3f ms   min %8.3f ms   median %8.3f ms   max %8.3f ms\n",
+                    label,
+                    total / samples.size(),
+                    samples.front(),
+                    samples[samples.size() / 2],
+                    samples.back());
+    }
+};
+
+void InitHeadless() {
+    Rx::InitDesc initInfo{};
+    initInfo.api         = Rx::GraphicsAPI::VULKAN;
+    initInfo.window.type = Rx::WindowSystem::NONE;
+    Rx::Init(initInfo);
+}
+
+bool InitRenderX(GLFWwindow* window) {
+    Rx::InitDesc initInfo{};
+    initInfo.api                = Rx::GraphicsAPI::VULKAN;
+    initInfo.instanceExtensions = glfwGetRequiredInstanceExtensions(&initInfo.extensionCount);
+
+#if defined(_WIN32)
+    initInfo.window.win32.hwnd      = glfwGetWin32Window(window);
+    initInfo.window.win32.hinstance = GetModuleHandle(nullptr);
+#elif defined(__linux__)
+    auto platform = glfwGetPlatform();
+    if (platform == GLFW_PLATFORM_X11) {
+        initInfo.window.x11.window  = (void*)glfwGetX11Window(window);
+        initInfo.window.x11.display = (void*)glfwGetX11Display();
+        initInfo.window.type        = Rx::WindowSystem::X11;
+    } else if (platform == GLFW_PLATFORM_WAYLAND) {
+        initInfo.window.wayland.surface = (void*)glfwGetWaylandWindow(window);
+        initInfo.window.wayland.display = (void*)glfwGetWaylandDisplay();
+        initInfo.window.type            = Rx::WindowSystem::WAYLAND;
+    } else {
+        return false;
+    }
+#else
+#error Unsupported platform
+#endif
+
+    Rx::Init(initInfo);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* path       = nullptr;
+    uint32_t    iterations = 100;
+    bool        useWindow  = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--window") == 0)
+            useWindow = true;
+        else if (!path)
+            path = argv[i];
+        else
+            iterations = (uint32_t)std::max(1, std::atoi(argv[i]));
+    }
+    if (!path) {
+        std::fprintf(stderr, "usage: rx_replay <capture.rxcap> [iterations] [--window]\n");
+        return 1;
+    }
+
+    GLFWwindow* window = nullptr;
+    if (useWindow) {
+        // The window only provides a surface; it is never shown
+        glfwInit();
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        window = glfwCreateWindow(64, 64, "rx_replay", nullptr, nullptr);
+        if (!window || !InitRenderX(window)) {
+            std::fprintf(stderr, "rx_replay: failed to create a window for the Vulkan backend\n");
+            return 1;
+        }
+    } else {
+        InitHeadless();
+    }
+
+    int result = 0;
+    {
+        Rx::CaptureReplayer replayer;
+        if (!replayer.Load(path)) {
+            result = 1;
+        } else {
+            Rx::CommandQueue*     graphics  = Rx::GetGpuQueue(Rx::QueueType::GRAPHICS);
+            Rx::CommandAllocator* allocator = graphics->CreateCommandAllocator("ReplayAllocator");
+
+            Stats cpu;
+            Stats submitToComplete;
+
+            // One warm-up iteration so pipeline and allocator setup is not timed
+            for (uint32_t i = 0; i <= iterations; i++) {
+                allocator->Reset();
+                Rx::CommandList* cmd = allocator->Allocate();
+
+                const auto recordStart = Clock::now();
+                cmd->open();
+                replayer.Record(cmd);
+                cmd->close();
+                const auto recordEnd = Clock::now();
+
+                const auto   submitStart = Clock::now();
+                Rx::Timeline done        = graphics->Submit(cmd);
+                graphics->Wait(done);
+                const auto submitEnd = Clock::now();
+
+                if (i == 0)
+                    continue;
+                cpu.add(ElapsedMs(recordStart, recordEnd));
+                submitToComplete.add(ElapsedMs(submitStart, submitEnd));
+            }
+
+            std::printf("%s: %u commands, %u resources, %u iterations\n",
+                        path,
+                        replayer.GetFrame().commandCount(),
+                        replayer.GetResourceCount(),
+                        iterations);
+            cpu.print("CPU record");
+            submitToComplete.print("submit->complete (wall)");
+
+            graphics->DestroyCommandAllocator(allocator);
+            replayer.Release();
+        }
+    }
+
+    Rx::Shutdown();
+    if (window) {
+        glfwDestroyWindow(window);
+        glfwTerminate();
+    }
+    return result;
+}
@@ -53,6 +53,9 @@ void* GLMapBuffer(BufferHandle handle) {
     return it->second.bytes.data();
 }
 
+// The CPU copy stays addressable for the buffer's lifetime
+void GLUnmapBuffer(BufferHandle) {}
+
 void GLDestroyBuffer(BufferHandle& handle) {
     PROFILE_FUNCTION();
     g_Buffers.erase(handle.id);
@@ -1,6 +1,7 @@
 #include "GL_Common.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 
 namespace Rx::RxGL {
@@ -124,6 +125,13 @@ void SwapBackbuffer() {
    
 }
 
+// The fixed-function path has no buffer bindings for these to drive; each
+// warns the first time it is used so a port from Vulkan notices
+void WarnVulkanOnly(std::atomic<bool>& warned, const char* name) {
+    if (!warned.exchange(true))
+        RENDERX_WARN("GLCommandList::{}: Vulkan-only, ignored by the OpenGL backend", name);
+}
+
 } // namespace
 
 void GLExecuteCommandList(GLCommandList& cmdList) {
@@ -333,12 +341,32 @@ void GLCommandList::setDescriptorSets(uint32_t, const SetHandle*, uint32_t) {}
 void GLCommandList::setBindlessTable(BindlessTableHandle) {}
 void GLCommandList::pushConstants(uint32_t, const void*, uint32_t, uint32_t) {}
 void GLCommandList::setDescriptorHeaps(DescriptorHeapHandle*, uint32_t) {}
-void GLCommandList::setInlineCBV(uint32_t, BufferHandle, uint64_t) {}
-void GLCommandList::setInlineSRV(uint32_t, BufferHandle, uint64_t) {}
-void GLCommandList::setInlineUAV(uint32_t, BufferHandle, uint64_t) {}
 void GLCommandList::setDescriptorBufferOffset(uint32_t, uint32_t, uint64_t) {}
-void GLCommandList::setDynamicOffset(uint32_t, uint32_t) {}
-void GLCommandList::pushDescriptor(uint32_t, const DescriptorWrite*, uint32_t) {}
+
+void GLCommandList::setInlineCBV(uint32_t, BufferHandle, uint64_t) {
+    static std::atomic<bool> warned{false};
+    WarnVulkanOnly(warned, "setInlineCBV");
+}
+
+void GLCommandList::setInlineSRV(uint32_t, BufferHandle, uint64_t) {
+    static std::atomic<bool> warned{false};
+    WarnVulkanOnly(warned, "setInlineSRV");
+}
+
+void GLCommandList::setInlineUAV(uint32_t, BufferHandle, uint64_t) {
+    static std::atomic<bool> warned{false};
+    WarnVulkanOnly(warned, "setInlineUAV");
+}
+
+void GLCommandList::setDynamicOffset(uint32_t, uint32_t) {
+    static std::atomic<bool> warned{false};
+    WarnVulkanOnly(warned, "setDynamicOffset");
+}
+
+void GLCommandList::pushDescriptor(uint32_t, const DescriptorWrite*, uint32_t) {
+    static std::atomic<bool> warned{false};
+    WarnVulkanOnly(warned, "pushDescriptor");
+}
 
 CommandList* GLCommandAllocator::Allocate() {
     return new GLCommandList();
@@ -512,4 +540,114 @@ void GLDestroySwapchain(Swapchain* swapchain) {
     delete swapchain;
 }
 
+GLFrameContext::GLFrameContext(const FrameContextDesc& desc)
+    : m_Swapchain(desc.swapchain),
+      m_CachedSetLifetime(desc.cachedSetLifetime) {
+    if (desc.transientBytes > 0)
+        RENDERX_WARN("GLFrameContext: transient allocators are not supported by the OpenGL backend");
+
+    m_Slots.resize(desc.framesInFlight);
+    for (auto& slot : m_Slots) {
+        slot.graphicsAllocator = g_GraphicsQueue->CreateCommandAllocator("FrameGraphicsAllocator");
+        if (desc.useCompute)
+            slot.computeAllocator = g_ComputeQueue->CreateCommandAllocator("FrameComputeAllocator");
+        slot.commandList = slot.graphicsAllocator->Allocate();
+        for (const auto& poolDesc : desc.linearPools)
+            slot.linearPools.push_back(GLCreateDescriptorPool(poolDesc));
+    }
+}
+
+GLFrameContext::~GLFrameContext() {
+    for (auto& slot : m_Slots) {
+        for (auto& pool : slot.linearPools)
+            GLDestroyDescriptorPool(pool);
+        slot.graphicsAllocator->Free(slot.commandList);
+        g_GraphicsQueue->DestroyCommandAllocator(slot.graphicsAllocator);
+        if (slot.computeAllocator)
+            g_ComputeQueue->DestroyCommandAllocator(slot.computeAllocator);
+    }
+}
+
+const FrameInfo& GLFrameContext::BeginFrame() {
+    RENDERX_ASSERT_MSG(!m_InFrame, "GLFrameContext::BeginFrame: previous frame was not ended");
+
+    Slot& slot = m_Slots[m_SlotIndex];
+    for (auto& pool : slot.linearPools)
+        GLResetDescriptorPool(pool);
+    if (m_CachedSetLifetime)
+        GLTrimSetCache(m_CachedSetLifetime);
+
+    m_Current                   = {};
+    m_Current.frameIndex        = m_SlotIndex;
+    m_Current.frameNumber       = m_FrameNumber;
+    m_Current.graphicsAllocator = slot.graphicsAllocator;
+    m_Current.computeAllocator  = slot.computeAllocator;
+    m_Current.linearPools       = slot.linearPools.data();
+    m_Current.linearPoolCount   = (uint32_t)slot.linearPools.size();
+
+    if (m_Swapchain)
+        m_Current.imageIndex = m_Swapchain->AcquireNextImage();
+
+    m_Current.commandList = slot.commandList;
+    m_Current.commandList->open();
+
+    m_InFrame = true;
+    return m_Current;
+}
+
+Timeline GLFrameContext::EndFrame(const QueueDependency*, uint32_t) {
+    RENDERX_ASSERT_MSG(m_InFrame, "GLFrameContext::EndFrame: BeginFrame was not called");
+
+    // Dependencies are already satisfied: every earlier submit has executed.
+    // Present swaps, so the submit itself must not.
+    m_Current.commandList->close();
+
+    Slot& slot    = m_Slots[m_SlotIndex];
+    slot.timeline = g_GraphicsQueue->Submit(m_Current.commandList);
+
+    if (m_Swapchain)
+        m_Swapchain->Present(m_Current.imageIndex);
+
+    m_SlotIndex = (m_SlotIndex + 1) % (uint32_t)m_Slots.size();
+    m_FrameNumber++;
+    m_InFrame = false;
+    return slot.timeline;
+}
+
+FrameContext* GLCreateFrameContext(const FrameContextDesc& desc) {
+    PROFILE_FUNCTION();
+    if (desc.framesInFlight == 0) {
+        RENDERX_ERROR("GLCreateFrameContext: framesInFlight must be at least 1");
+        return nullptr;
+    }
+    return new GLFrameContext(desc);
+}
+
+void GLDestroyFrameContext(FrameContext* context) {
+    PROFILE_FUNCTION();
+    delete context;
+}
+
+TransientAllocator* GLCreateTransientAllocator(const TransientAllocatorDesc& desc) {
+    PROFILE_FUNCTION();
+    RENDERX_WARN("GLCreateTransientAllocator: transient allocators are not supported by the OpenGL backend");
+    return nullptr;
+}
+
+void GLDestroyTransientAllocator(TransientAllocator* allocator) {
+    PROFILE_FUNCTION();
+    delete allocator;
+}
+
+GeometryPool* GLCreateGeometryPool(const GeometryPoolDesc& desc) {
+    PROFILE_FUNCTION();
+    RENDERX_WARN("GLCreateGeometryPool: geometry pools are not supported by the OpenGL backend");
+    return nullptr;
+}
+
+void GLDestroyGeometryPool(GeometryPool* pool) {
+    PROFILE_FUNCTION();
+    delete pool;
+}
+
 } // namespace Rx::RxGL
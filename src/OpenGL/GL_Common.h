@@ -213,6 +213,38 @@ private:
     std::vector<TextureViewHandle> m_DepthViews{};
 };
 
+// GL executes at submit, so no frame is ever in flight: slots only keep the
+// per-frame pools and lists apart, and BeginFrame never blocks
+class GLFrameContext final : public FrameContext {
+public:
+    explicit GLFrameContext(const FrameContextDesc& desc);
+    ~GLFrameContext() override;
+
+    const FrameInfo& BeginFrame() override;
+    Timeline         EndFrame(const QueueDependency* waits, uint32_t waitCount) override;
+
+    const FrameInfo& GetCurrentFrame() const override { return m_Current; }
+    uint32_t         GetFramesInFlight() const override { return (uint32_t)m_Slots.size(); }
+    Timeline GetFrameTimeline(uint32_t frameIndex) const override { return m_Slots[frameIndex].timeline; }
+
+private:
+    struct Slot {
+        CommandAllocator*                 graphicsAllocator = nullptr;
+        CommandAllocator*                 computeAllocator  = nullptr;
+        CommandList*                      commandList       = nullptr;
+        std::vector<DescriptorPoolHandle> linearPools;
+        Timeline                          timeline;
+    };
+
+    Swapchain*        m_Swapchain         = nullptr;
+    uint32_t          m_CachedSetLifetime = 0;
+    std::vector<Slot> m_Slots;
+    uint32_t          m_SlotIndex   = 0;
+    uint64_t          m_FrameNumber = 0;
+    FrameInfo         m_Current{};
+    bool              m_InFrame = false;
+};
+
 #if defined(_WIN32)
 extern int   g_WindowWidth;
 extern int   g_WindowHeight;
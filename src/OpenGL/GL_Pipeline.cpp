@@ -97,6 +97,27 @@ PipelineHandle GLCreateGraphicsPipeline(PipelineDesc& desc) {
     return handle;
 }
 
+// Programs are linked at bind time, so every pipeline is ready immediately
+PipelineHandle GLCreateGraphicsPipelineAsync(const PipelineDesc& desc, PipelineHandle) {
+    PROFILE_FUNCTION();
+
+    PipelineHandle handle{GLNextHandle()};
+    g_Pipelines.emplace(handle.id, GLPipelineResource{desc});
+    return handle;
+}
+
+void GLCreateGraphicsPipelinesAsync(const PipelineDesc* descs,
+                                    uint32_t            count,
+                                    PipelineHandle*     outPipelines,
+                                    PipelineHandle      fallback) {
+    for (uint32_t i = 0; i < count; i++)
+        outPipelines[i] = GLCreateGraphicsPipelineAsync(descs[i], fallback);
+}
+
+bool GLIsPipelineReady(PipelineHandle handle) {
+    return g_Pipelines.find(handle.id) != g_Pipelines.end();
+}
+
 void GLDestroyPipeline(PipelineHandle& handle) {
     PROFILE_FUNCTION();
     g_Pipelines.erase(handle.id);
@@ -109,6 +130,12 @@ void GLDestroyPipelineLayout(PipelineLayoutHandle& handle) {
     handle.id = 0;
 }
 
+// Program binaries are cached by the driver; there is nothing to write
+bool GLSavePipelineCache() {
+    PROFILE_FUNCTION();
+    return true;
+}
+
 void GLBindPipeline(const PipelineHandle handle) {
     auto it = g_Pipelines.find(handle.id);
     if (it == g_Pipelines.end()) {
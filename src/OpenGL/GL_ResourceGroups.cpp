@@ -9,6 +9,30 @@ namespace {
 uint32_t DescriptorStrideBytes() {
     return 32;
 }
+
+struct GLCachedSet {
+    SetHandle                    set;
+    DescriptorPoolHandle         pool;
+    SetLayoutHandle              layout;
+    std::vector<DescriptorWrite> writes;
+    uint64_t                     lastUsed = 0;
+};
+
+// Handle ids are never reused here, so an entry naming a destroyed view can
+// never be hit again; it just ages out in GLTrimSetCache
+std::unordered_multimap<uint64_t, GLCachedSet> g_SetCache; // colliding hashes keep separate entries
+uint64_t                                       g_SetCacheFrame = 0;
+
+uint64_t HashSetContents(SetLayoutHandle layout, const DescriptorWrite* writes, uint32_t writeCount) {
+    uint64_t hash = 0xcbf29ce484222325 ^ layout.id;
+    for (uint32_t i = 0; i < writeCount; ++i) {
+        hash = (hash * 0x100000001b3) ^ (((uint64_t)writes[i].arrayElement << 32) | ((uint64_t)writes[i].slot << 8) |
+                                         (uint64_t)writes[i].type);
+        hash = (hash * 0x100000001b3) ^ writes[i].handle;
+        hash = (hash * 0x100000001b3) ^ writes[i].sampler;
+    }
+    return hash;
+}
 } // namespace
 
 TextureHandle GLCreateTexture(const TextureDesc& desc) {
@@ -39,6 +63,17 @@ void GLDestroyTexture(TextureHandle& handle) {
     handle.id = 0;
 }
 
+FormatFeature GLGetFormatFeatures(Format format) {
+    PROFILE_FUNCTION();
+    // Textures live in CPU memory as 4-byte texels, so only uncompressed
+    // formats are usable
+    if (GetFormatBlockInfo(format).bytes == 0 || IsCompressedFormat(format))
+        return FormatFeature::NONE;
+    if (format == Format::D24_UNORM_S8_UINT || format == Format::D32_SFLOAT)
+        return FormatFeature::SAMPLED | FormatFeature::DEPTH_STENCIL;
+    return FormatFeature::SAMPLED | FormatFeature::FILTER_LINEAR | FormatFeature::RENDER_TARGET | FormatFeature::BLEND;
+}
+
 TextureViewHandle GLCreateTextureView(const TextureViewDesc& desc) {
     PROFILE_FUNCTION();
     if (!desc.texture.isValid()) {
@@ -139,8 +174,12 @@ void GLWriteSet(SetHandle set, const DescriptorWrite* writes, uint32_t writeCoun
         return;
     }
 
-    for (uint32_t i = 0; i < writeCount; ++i) {
-        it->second.writes[writes[i].slot] = writes[i];
+    // Stored per descriptor so no `handles` pointer outlives the call
+    thread_local std::vector<DescriptorWrite> expanded;
+    expanded.clear();
+    ExpandDescriptorWrites(writes, writeCount, expanded);
+    for (const DescriptorWrite& write : expanded) {
+        it->second.writes[write.slot] = write;
     }
 }
 
@@ -159,6 +198,86 @@ void GLWriteSets(SetHandle** sets, const DescriptorWrite** writes, uint32_t setC
     }
 }
 
+void GLWriteSetPacked(SetHandle set, const void* data) {
+    PROFILE_FUNCTION();
+
+    auto it = g_Sets.find(set.id);
+    if (it == g_Sets.end() || !data) {
+        return;
+    }
+    auto layoutIt = g_SetLayouts.find(it->second.layout.id);
+    if (layoutIt == g_SetLayouts.end()) {
+        return;
+    }
+
+    DescriptorWrite writes[SetLayoutDesc::MAX_BINDINGS];
+    GLWriteSet(set, writes, UnpackDescriptorWrites(layoutIt->second.desc, data, writes));
+}
+
+SetHandle GLAllocateCachedSet(DescriptorPoolHandle   pool,
+                              SetLayoutHandle        layout,
+                              const DescriptorWrite* writes,
+                              uint32_t               writeCount) {
+    PROFILE_FUNCTION();
+    if (writeCount > 0 && !writes) {
+        return SetHandle{};
+    }
+
+    thread_local std::vector<DescriptorWrite> expanded;
+    expanded.clear();
+    ExpandDescriptorWrites(writes, writeCount, expanded);
+    writes     = expanded.data();
+    writeCount = static_cast<uint32_t>(expanded.size());
+
+    const uint64_t hash = HashSetContents(layout, writes, writeCount);
+
+    auto [first, last] = g_SetCache.equal_range(hash);
+    for (auto it = first; it != last;) {
+        const GLCachedSet& entry = it->second;
+        // The set is gone when its pool was reset or destroyed
+        if (!g_Sets.count(entry.set.id)) {
+            it = g_SetCache.erase(it);
+            continue;
+        }
+        // Another set whose contents hash the same stays cached beside this one
+        const bool same = entry.layout.id == layout.id && entry.writes.size() == writeCount &&
+                          std::equal(entry.writes.begin(), entry.writes.end(), writes, [](const auto& a, const auto& b) {
+                              return a.slot == b.slot && a.type == b.type && a.handle == b.handle &&
+                                     a.sampler == b.sampler && a.arrayElement == b.arrayElement;
+                          });
+        if (same) {
+            it->second.lastUsed = g_SetCacheFrame;
+            return entry.set;
+        }
+        ++it;
+    }
+
+    SetHandle set = GLAllocateSet(pool, layout);
+    if (!set.isValid()) {
+        return set;
+    }
+    GLWriteSet(set, writes, writeCount);
+
+    g_SetCache.emplace(
+        hash, GLCachedSet{set, pool, layout, std::vector<DescriptorWrite>(writes, writes + writeCount), g_SetCacheFrame});
+    return set;
+}
+
+void GLTrimSetCache(uint32_t maxFrameAge) {
+    PROFILE_FUNCTION();
+    ++g_SetCacheFrame;
+
+    for (auto it = g_SetCache.begin(); it != g_SetCache.end();) {
+        if (g_SetCacheFrame - it->second.lastUsed > maxFrameAge) {
+            // Sets are host-side here, nothing in flight can still read them
+            GLFreeSet(it->second.pool, it->second.set);
+            it = g_SetCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 DescriptorHeapHandle GLCreateDescriptorHeap(const DescriptorHeapDesc& desc) {
     PROFILE_FUNCTION();
 
@@ -194,6 +313,66 @@ DescriptorPointer GLGetDescriptorHeapPtr(DescriptorHeapHandle heap, uint32_t ind
     return {base, reinterpret_cast<uint64_t>(base), static_cast<uint32_t>(it->second.bytes.size() - off)};
 }
 
+SetLayoutMemoryInfo GLGetSetLayoutMemoryInfo(SetLayoutHandle layout) {
+    PROFILE_FUNCTION();
+
+    SetLayoutMemoryInfo info{};
+    auto                it = g_SetLayouts.find(layout.id);
+    if (it == g_SetLayouts.end()) {
+        return info;
+    }
+
+    // Heaps are plain CPU memory with a fixed stride, so bindings are packed
+    const SetLayoutDesc& desc = it->second.desc;
+    for (uint32_t i = 0; i < desc.count; i++) {
+        info.bindingOffsets[i]  = info.sizeBytes;
+        info.sizeBytes         += static_cast<uint64_t>(desc.bindings[i].count) * DescriptorStrideBytes();
+    }
+    info.alignment = DescriptorStrideBytes();
+    return info;
+}
+
+DescriptorCaps GLGetDescriptorCaps() {
+    PROFILE_FUNCTION();
+
+    DescriptorCaps caps{};
+    caps.sizes.cbv     = DescriptorStrideBytes();
+    caps.sizes.srv     = DescriptorStrideBytes();
+    caps.sizes.uav     = DescriptorStrideBytes();
+    caps.sizes.sampler = DescriptorStrideBytes();
+    return caps;
+}
+
+// GLSL 4.5 has no unsized, dynamically indexed resource arrays; bindless
+// tables need descriptor indexing and are Vulkan only
+BindlessTableHandle GLCreateBindlessTable(const BindlessTableDesc& desc) {
+    PROFILE_FUNCTION();
+    RENDERX_ERROR("GLCreateBindlessTable: bindless tables are not supported by the OpenGL backend");
+    return {};
+}
+
+void GLDestroyBindlessTable(BindlessTableHandle& handle) {
+    PROFILE_FUNCTION();
+    handle.id = 0;
+}
+
+SetLayoutHandle GLGetBindlessSetLayout(BindlessTableHandle table) {
+    PROFILE_FUNCTION();
+    return {};
+}
+
+uint32_t GLGetTextureViewBindlessIndex(TextureViewHandle view) {
+    return BindlessTableDesc::INVALID_INDEX;
+}
+
+uint32_t GLGetBufferViewBindlessIndex(BufferViewHandle view) {
+    return BindlessTableDesc::INVALID_INDEX;
+}
+
+uint32_t GLGetSamplerBindlessIndex(SamplerHandle sampler) {
+    return BindlessTableDesc::INVALID_INDEX;
+}
+
 SamplerHandle GLCreateSampler(const SamplerDesc& desc) {
     PROFILE_FUNCTION();
     SamplerHandle handle{GLNextHandle()};
@@ -211,6 +390,76 @@ void GLFlushUploads() {
     PROFILE_FUNCTION();
 }
 
+// Resources live in host memory, so uploads land immediately and there is
+// nothing for FlushUploads/SubmitUploads to wait on
+bool GLUploadBuffer(BufferHandle dst, const void* data, uint32_t size, uint32_t dstOffset) {
+    PROFILE_FUNCTION();
+    auto it = g_Buffers.find(dst.id);
+    if (it == g_Buffers.end() || !data || size == 0) {
+        RENDERX_WARN("GLUploadBuffer: invalid buffer upload ignored");
+        return false;
+    }
+    std::vector<uint8_t>& bytes = it->second.bytes;
+    if (dstOffset > bytes.size() || size > bytes.size() - dstOffset) {
+        RENDERX_ERROR("GLUploadBuffer: upload of {} bytes at offset {} overruns buffer of {} bytes",
+                      size,
+                      dstOffset,
+                      bytes.size());
+        return false;
+    }
+    std::memcpy(bytes.data() + dstOffset, data, size);
+    return true;
+}
+
+bool GLUploadTexture(TextureHandle dst, const void* data, uint32_t size, const TextureCopy& region) {
+    PROFILE_FUNCTION();
+    auto it = g_Textures.find(dst.id);
+    if (it == g_Textures.end() || !data || size == 0) {
+        RENDERX_WARN("GLUploadTexture: invalid texture upload ignored");
+        return false;
+    }
+
+    // The host copy holds only the first level of the first layer
+    if (region.dstMipLevel != 0 || region.dstArrayLayer != 0)
+        return true;
+
+    if (region.dstOffset.x < 0 || region.dstOffset.y < 0 || region.dstOffset.z < 0 || region.extent.x < 0 ||
+        region.extent.y < 0 || region.extent.z < 0) {
+        RENDERX_ERROR("GLUploadTexture: negative region offset or extent");
+        return false;
+    }
+
+    const TextureDesc& desc = it->second.desc;
+    const uint64_t     w    = desc.width == 0 ? 1 : desc.width;
+    const uint64_t     h    = desc.height == 0 ? 1 : desc.height;
+    const uint64_t     d    = desc.depth == 0 ? 1 : desc.depth;
+
+    const uint64_t x = region.dstOffset.x, y = region.dstOffset.y, z = region.dstOffset.z;
+    const uint64_t ex = region.extent.x, ey = region.extent.y, ez = region.extent.z;
+    if (x + ex > w || y + ey > h || z + ez > d || ex * ey * ez * 4 > size) {
+        RENDERX_ERROR("GLUploadTexture: region exceeds the texture or the {} bytes of data", size);
+        return false;
+    }
+
+    // Tightly packed source rows, copied one at a time into the texel grid
+    const uint64_t rowBytes = ex * 4;
+    const auto*    src      = static_cast<const uint8_t*>(data);
+    uint8_t*       texels   = it->second.bytes.data();
+    for (uint64_t slice = 0; slice < ez; ++slice) {
+        for (uint64_t row = 0; row < ey; ++row) {
+            const uint64_t dstTexel = ((z + slice) * h + (y + row)) * w + x;
+            std::memcpy(texels + dstTexel * 4, src, rowBytes);
+            src += rowBytes;
+        }
+    }
+    return true;
+}
+
+Timeline GLSubmitUploads() {
+    PROFILE_FUNCTION();
+    return Timeline(0);
+}
+
 void GLPrintHandles() {
     PROFILE_FUNCTION();
     RENDERX_INFO("GL Handles | Buffers={} BufferViews={} Textures={} TextureViews={} Shaders={} Pipelines={} Layouts={} Sets={} Pools={} Heaps={} Samplers={}",
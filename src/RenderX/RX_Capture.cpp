@@ -0,0 +1,1573 @@
+#include "RX_Capture.h"
+#include "RX_Core.h"
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Rx {
+
+namespace {
+
+// Serialization helpers
+//
+// Every value is written field by field at a fixed width; no struct is ever
+// dumped as raw memory, so pointers and padding never reach the file and a
+// layout change in RX_Common.h cannot silently change the format.
+
+class ByteWriter {
+public:
+    static constexpr bool READING = false;
+
+    explicit ByteWriter(std::vector<uint8_t>& out)
+        : m_Out(out) {}
+
+    template <typename T> void write(const T& value) {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "structs are written through Fields()");
+        writeRaw(&value, sizeof(T));
+    }
+
+    template <typename T> void operator()(const T& value) {
+        if constexpr (std::is_same_v<T, bool>)
+            write<uint8_t>(value ? 1 : 0);
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+            write(value);
+        else
+            Fields(*this, value);
+    }
+    template <typename Tag> void operator()(const Handle<Tag>& handle) { write(handle.id); }
+
+    void writeRaw(const void* data, size_t size) {
+        if (!size)
+            return;
+        const size_t base = m_Out.size();
+        m_Out.resize(base + size);
+        std::memcpy(m_Out.data() + base, data, size);
+    }
+
+    void writeBytes(const void* data, uint64_t size) {
+        write(size);
+        writeRaw(data, (size_t)size);
+    }
+
+    void writeString(const char* str) { writeBytes(str, str ? std::strlen(str) : 0); }
+    void writeString(const std::string& str) { writeBytes(str.data(), str.size()); }
+
+    // Chunks are written header-first and patched with their size on end
+    size_t beginChunk(CaptureChunk type) {
+        const size_t at = m_Out.size();
+        write((uint32_t)type);
+        write(uint32_t(0));
+        write(uint64_t(0));
+        return at;
+    }
+    void endChunk(size_t at) {
+        const uint64_t size = m_Out.size() - at - CHUNK_HEADER_BYTES;
+        std::memcpy(m_Out.data() + at + sizeof(uint32_t) * 2, &size, sizeof(size));
+    }
+
+    static constexpr size_t CHUNK_HEADER_BYTES = sizeof(uint32_t) * 2 + sizeof(uint64_t);
+
+private:
+    std::vector<uint8_t>& m_Out;
+};
+
+class ByteReader {
+public:
+    static constexpr bool READING = true;
+
+    ByteReader(const uint8_t* data, size_t size)
+        : m_Data(data),
+          m_Size(size) {}
+
+    template <typename T> T read() {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "structs are read through Fields()");
+        std::array<uint8_t, sizeof(T)> raw{};
+        if (const uint8_t* src = take(sizeof(T)))
+            std::memcpy(raw.data(), src, sizeof(T));
+        return std::bit_cast<T>(raw);
+    }
+
+    template <typename T> void operator()(T& value) {
+        if constexpr (std::is_same_v<T, bool>)
+            value = read<uint8_t>() != 0;
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+            value = read<T>();
+        else
+            Fields(*this, value);
+    }
+    template <typename Tag> void operator()(Handle<Tag>& handle) { handle.id = read<uint64_t>(); }
+
+    // Returns a pointer into the source buffer; valid as long as it is
+    const uint8_t* readBytes(uint64_t& size) {
+        size = read<uint64_t>();
+        return size ? take(size) : nullptr;
+    }
+
+    std::string readString() {
+        uint64_t       size = 0;
+        const uint8_t* data = readBytes(size);
+        return data ? std::string(reinterpret_cast<const char*>(data), (size_t)size) : std::string();
+    }
+
+    const uint8_t* skip(uint64_t size) { return take(size); }
+
+    void   fail() { m_Ok = false; }
+    bool   ok() const { return m_Ok; }
+    size_t remaining() const { return m_Size - m_Offset; }
+
+private:
+    // Every length read from the file is checked here against what is left
+    const uint8_t* take(uint64_t size) {
+        if (!m_Ok || size > remaining()) {
+            m_Ok = false;
+            return nullptr;
+        }
+        const uint8_t* ptr = m_Data + m_Offset;
+        m_Offset += (size_t)size;
+        return ptr;
+    }
+
+    const uint8_t* m_Data;
+    size_t         m_Size;
+    size_t         m_Offset = 0;
+    bool           m_Ok     = true;
+};
+
+template <typename T> void WriteArray(ByteWriter& w, const T* items, uint32_t count) {
+    w.write(count);
+    for (uint32_t i = 0; i < count; i++)
+        w(items[i]);
+}
+
+// `proto` seeds each element, for types without a default constructor
+template <typename T> void ReadArray(ByteReader& r, std::vector<T>& out, const T& proto = T()) {
+    const uint32_t count = r.read<uint32_t>();
+    out.clear();
+    // Every element takes at least one byte, which bounds corrupt counts
+    if (count > r.remaining()) {
+        r.fail();
+        return;
+    }
+    out.reserve(count);
+    for (uint32_t i = 0; i < count && r.ok(); i++) {
+        T item = proto;
+        r(item);
+        out.push_back(item);
+    }
+}
+
+// Field lists, shared by ByteWriter and ByteReader so the two cannot drift.
+// Pointers (initial data, debug names, `handles`) and bindless tables are
+// never part of them.
+
+// D is T or const T: the writer sees const descs, the reader mutable ones
+template <typename D, typename T> concept FieldsOf = std::is_same_v<std::remove_const_t<D>, T>;
+
+template <typename A, FieldsOf<BufferDesc> D> void Fields(A& a, D& d) {
+    uint64_t size = d.size;
+    a(d.usage);
+    a(d.memoryType);
+    a(size);
+    a(d.bindingCount);
+    if constexpr (A::READING)
+        d.size = (size_t)size;
+}
+
+template <typename A, FieldsOf<BufferViewDesc> D> void Fields(A& a, D& d) {
+    a(d.buffer);
+    a(d.offset);
+    a(d.range);
+}
+
+template <typename A, FieldsOf<TextureDesc> D> void Fields(A& a, D& d) {
+    a(d.type);
+    a(d.width);
+    a(d.height);
+    a(d.depth);
+    a(d.mipLevels);
+    a(d.arrayLayers);
+    a(d.sampleCount);
+    a(d.format);
+    a(d.usage);
+    a(d.memoryType);
+    a(d.size);
+    a(d.generateMips);
+}
+
+template <typename A, FieldsOf<TextureViewDesc> D> void Fields(A& a, D& d) {
+    a(d.texture);
+    a(d.viewType);
+    a(d.format);
+    a(d.baseMipLevel);
+    a(d.mipLevelCount);
+    a(d.baseArrayLayer);
+    a(d.arrayLayerCount);
+}
+
+template <typename A, FieldsOf<SamplerDesc> D> void Fields(A& a, D& d) {
+    a(d.minFilter);
+    a(d.magFilter);
+    a(d.mipFilter);
+    a(d.addressU);
+    a(d.addressV);
+    a(d.addressW);
+    a(d.borderColor);
+    a(d.mipLodBias);
+    a(d.minLod);
+    a(d.maxLod);
+    a(d.maxAnisotropy);
+    a(d.comparisonEnable);
+    a(d.compareOp);
+    a(d.unnormalizedCoords);
+}
+
+template <typename A, FieldsOf<Binding> D> void Fields(A& a, D& b) {
+    uint8_t flags = uint8_t(b.updateAfterBind) | uint8_t(b.partiallyBound) << 1 | uint8_t(b.nonUniformIndex) << 2;
+    a(b.slot);
+    a(b.type);
+    a(b.stages);
+    a(b.count);
+    a(flags);
+    if constexpr (A::READING) {
+        b.updateAfterBind = (flags & 1) != 0;
+        b.partiallyBound  = (flags & 2) != 0;
+        b.nonUniformIndex = (flags & 4) != 0;
+    }
+}
+
+template <typename A, FieldsOf<SetLayoutDesc> D> void Fields(A& a, D& d) {
+    a(d.count);
+    a(d.descriptorBuffer);
+    a(d.pushDescriptor);
+    if constexpr (A::READING) {
+        if (d.count > SetLayoutDesc::MAX_BINDINGS) {
+            a.fail();
+            return;
+        }
+    }
+    for (uint32_t i = 0; i < d.count; i++)
+        a(d.bindings[i]);
+}
+
+template <typename A, FieldsOf<DescriptorPoolDesc> D> void Fields(A& a, D& d) {
+    a(d.flags);
+    a(d.capacity);
+    a(d.layout);
+    a(d.updateAfterBind);
+    a(d.growable);
+    a(d.heapOffset);
+    a(d.slotSize);
+}
+
+template <typename A, FieldsOf<PushConstantRange> D> void Fields(A& a, D& d) {
+    a(d.stages);
+    a(d.offset);
+    a(d.size);
+}
+
+template <typename A, FieldsOf<VertexAttribute> D> void Fields(A& a, D& d) {
+    a(d.location);
+    a(d.binding);
+    a(d.format);
+    a(d.offset);
+}
+
+template <typename A, FieldsOf<VertexBinding> D> void Fields(A& a, D& d) {
+    a(d.binding);
+    a(d.stride);
+    a(d.instanceData);
+}
+
+template <typename A, FieldsOf<RasterizerState> D> void Fields(A& a, D& d) {
+    a(d.fillMode);
+    a(d.cullMode);
+    a(d.frontCounterClockwise);
+    a(d.depthBias);
+    a(d.depthBiasClamp);
+    a(d.slopeScaledDepthBias);
+    a(d.depthClipEnable);
+    a(d.scissorEnable);
+    a(d.multisampleEnable);
+}
+
+template <typename A, FieldsOf<DepthStencilState> D> void Fields(A& a, D& d) {
+    a(d.depthEnable);
+    a(d.depthWriteEnable);
+    a(d.stencilEnable);
+    a(d.depthFunc);
+    a(d.stencilReadMask);
+    a(d.stencilWriteMask);
+}
+
+template <typename A, FieldsOf<BlendState> D> void Fields(A& a, D& d) {
+    a(d.enable);
+    a(d.srcColor);
+    a(d.dstColor);
+    a(d.srcAlpha);
+    a(d.dstAlpha);
+    a(d.colorOp);
+    a(d.alphaOp);
+    a(d.blendFactor.x);
+    a(d.blendFactor.y);
+    a(d.blendFactor.z);
+    a(d.blendFactor.w);
+}
+
+// Writes are recorded expanded, one descriptor each, so `handles` is never set
+template <typename A, FieldsOf<DescriptorWrite> D> void Fields(A& a, D& d) {
+    a(d.slot);
+    a(d.type);
+    a(d.handle);
+    a(d.sampler);
+    a(d.arrayElement);
+    a(d.count);
+}
+
+// Capture session
+
+struct HostBuffer {
+    uint64_t id;
+    size_t   size;
+};
+
+struct CaptureSession {
+    std::mutex                   mutex;
+    bool                         active = false;
+    RenderDispatchTable          backend{}; // entry points the hooks forward to
+    std::vector<uint8_t>         data;
+    uint32_t                     chunkCount = 0;
+    std::vector<HostBuffer>      hostBuffers;
+    std::unordered_set<uint64_t> cachedSets; // recorded once; cache hits return them again
+
+    // Packed writes are recorded as DescriptorWrites, which needs the layout
+    std::unordered_map<uint64_t, SetLayoutDesc> layouts;
+    std::unordered_map<uint64_t, uint64_t>      setLayouts;
+};
+
+CaptureSession g_Capture;
+
+bool IsHostVisible(MemoryType type) {
+    return type == MemoryType::CPU_TO_GPU || type == MemoryType::GPU_TO_CPU || type == MemoryType::CPU_ONLY;
+}
+
+BufferHandle CaptureCreateBuffer(const BufferDesc& desc) {
+    BufferHandle handle = g_Capture.backend.CreateBuffer(desc);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::BUFFER);
+    w.write(handle.id);
+    w(desc);
+    w.writeString(desc.debugName);
+    w.writeBytes(desc.initialData, desc.initialData ? desc.size : 0);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+
+    if (IsHostVisible(desc.memoryType))
+        g_Capture.hostBuffers.push_back({handle.id, desc.size});
+    return handle;
+}
+
+BufferViewHandle CaptureCreateBufferView(const BufferViewDesc& desc) {
+    BufferViewHandle handle = g_Capture.backend.CreateBufferView(desc);
+    if (!handle.isValid())
+        return handle;
+
+    // Bindless tables are not captured; the replayed view is a plain one
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::BUFFER_VIEW);
+    w.write(handle.id);
+    w(desc);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    return handle;
+}
+
+TextureHandle CaptureCreateTexture(const TextureDesc& desc) {
+    TextureHandle handle = g_Capture.backend.CreateTexture(desc);
+    if (!handle.isValid())
+        return handle;
+
+    if (desc.initialData && desc.size == 0)
+        RENDERX_WARN("Capture: texture '{}' has initial data but no size; data not captured",
+                     desc.debugName ? desc.debugName : "");
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::TEXTURE);
+    w.write(handle.id);
+    w(desc);
+    w.writeString(desc.debugName);
+    w.writeBytes(desc.initialData, desc.initialData ? desc.size : 0);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    return handle;
+}
+
+TextureViewHandle CaptureCreateTextureView(const TextureViewDesc& desc) {
+    TextureViewHandle handle = g_Capture.backend.CreateTextureView(desc);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::TEXTURE_VIEW);
+    w.write(handle.id);
+    w(desc);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    return handle;
+}
+
+SamplerHandle CaptureCreateSampler(const SamplerDesc& desc) {
+    SamplerHandle handle = g_Capture.backend.CreateSampler(desc);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::SAMPLER);
+    w.write(handle.id);
+    w(desc);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    return handle;
+}
+
+ShaderHandle CaptureCreateShader(const ShaderDesc& desc) {
+    ShaderHandle handle = g_Capture.backend.CreateShader(desc);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::SHADER);
+    w.write(handle.id);
+    w(desc.stage);
+    w.writeString(desc.entryPoint);
+    w.writeBytes(desc.bytecode.data(), desc.bytecode.size());
+    w.writeString(desc.source);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    return handle;
+}
+
+SetLayoutHandle CaptureCreateSetLayout(const SetLayoutDesc& desc) {
+    SetLayoutHandle handle = g_Capture.backend.CreateSetLayout(desc);
+    if (!handle.isValid())
+        return handle;
+
+    SetLayoutDesc stored = desc;
+    stored.debugName     = nullptr;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::SET_LAYOUT);
+    w.write(handle.id);
+    w(stored);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    g_Capture.layouts[handle.id] = stored;
+    return handle;
+}
+
+PipelineLayoutHandle CaptureCreatePipelineLayout(const SetLayoutHandle*   layouts,
+                                                 uint32_t                 layoutCount,
+                                                 const PushConstantRange* pushRanges,
+                                                 uint32_t                 pushRangeCount) {
+    PipelineLayoutHandle handle = g_Capture.backend.CreatePipelineLayout(layouts, layoutCount, pushRanges, pushRangeCount);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::PIPELINE_LAYOUT);
+    w.write(handle.id);
+    WriteArray(w, layouts, layouts ? layoutCount : 0);
+    WriteArray(w, pushRanges, pushRanges ? pushRangeCount : 0);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    return handle;
+}
+
+// Async pipelines are recorded like synchronous ones; replay compiles them
+// up front
+void RecordPipeline(PipelineHandle handle, const PipelineDesc& desc) {
+    if (desc.renderPass.isValid())
+        RENDERX_WARN("Capture: render pass pipelines are not captured; replay uses dynamic rendering");
+
+    ByteWriter   w(g_Capture.data);
+    const size_t at = w.beginChunk(CaptureChunk::PIPELINE);
+    w.write(handle.id);
+    WriteArray(w, desc.shaders.data(), (uint32_t)desc.shaders.size());
+    WriteArray(w, desc.vertexInputState.attributes.data(), (uint32_t)desc.vertexInputState.attributes.size());
+    WriteArray(w, desc.vertexInputState.vertexBindings.data(), (uint32_t)desc.vertexInputState.vertexBindings.size());
+    w(desc.primitiveType);
+    w(desc.rasterizer);
+    w(desc.depthStencil);
+    w(desc.blend);
+    w(desc.layout);
+    WriteArray(w, desc.colorFromats.data(), (uint32_t)desc.colorFromats.size());
+    w(desc.depthFormat);
+    w.writeString(desc.debugName);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+}
+
+PipelineHandle CaptureCreateGraphicsPipeline(PipelineDesc& desc) {
+    PipelineHandle handle = g_Capture.backend.CreateGraphicsPipeline(desc);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    RecordPipeline(handle, desc);
+    return handle;
+}
+
+PipelineHandle CaptureCreateGraphicsPipelineAsync(const PipelineDesc& desc, PipelineHandle fallback) {
+    PipelineHandle handle = g_Capture.backend.CreateGraphicsPipelineAsync(desc, fallback);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    RecordPipeline(handle, desc);
+    return handle;
+}
+
+void CaptureCreateGraphicsPipelinesAsync(const PipelineDesc* descs,
+                                         uint32_t            count,
+                                         PipelineHandle*     outPipelines,
+                                         PipelineHandle      fallback) {
+    g_Capture.backend.CreateGraphicsPipelinesAsync(descs, count, outPipelines, fallback);
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    for (uint32_t i = 0; i < count; i++) {
+        if (outPipelines[i].isValid())
+            RecordPipeline(outPipelines[i], descs[i]);
+    }
+}
+
+DescriptorPoolHandle CaptureCreateDescriptorPool(const DescriptorPoolDesc& desc) {
+    DescriptorPoolHandle handle = g_Capture.backend.CreateDescriptorPool(desc);
+    if (!handle.isValid())
+        return handle;
+
+    // Heaps are not captured
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::DESCRIPTOR_POOL);
+    w.write(handle.id);
+    w(desc);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    return handle;
+}
+
+void RecordSet(SetHandle set, DescriptorPoolHandle pool, SetLayoutHandle layout) {
+    ByteWriter   w(g_Capture.data);
+    const size_t at = w.beginChunk(CaptureChunk::SET);
+    w.write(set.id);
+    w.write(pool.id);
+    w.write(layout.id);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+    g_Capture.setLayouts[set.id] = layout.id;
+}
+
+SetHandle CaptureAllocateSet(DescriptorPoolHandle pool, SetLayoutHandle layout) {
+    SetHandle handle = g_Capture.backend.AllocateSet(pool, layout);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    RecordSet(handle, pool, layout);
+    return handle;
+}
+
+void CaptureAllocateSets(DescriptorPoolHandle pool, SetLayoutHandle layout, SetHandle* pSets, uint32_t count) {
+    g_Capture.backend.AllocateSets(pool, layout, pSets, count);
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    for (uint32_t i = 0; i < count; i++) {
+        if (pSets[i].isValid())
+            RecordSet(pSets[i], pool, layout);
+    }
+}
+
+// Stored one descriptor per write, with the `handles` arrays resolved
+void RecordSetWrite(SetHandle set, const DescriptorWrite* writes, uint32_t writeCount) {
+    thread_local std::vector<DescriptorWrite> expanded;
+    expanded.clear();
+    ExpandDescriptorWrites(writes, writeCount, expanded);
+
+    ByteWriter   w(g_Capture.data);
+    const size_t at = w.beginChunk(CaptureChunk::SET_WRITE);
+    w.write(set.id);
+    WriteArray(w, expanded.data(), (uint32_t)expanded.size());
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+}
+
+void CaptureWriteSet(SetHandle set, const DescriptorWrite* writes, uint32_t writeCount) {
+    g_Capture.backend.WriteSet(set, writes, writeCount);
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    RecordSetWrite(set, writes, writes ? writeCount : 0);
+}
+
+void CaptureWriteSets(SetHandle** sets, const DescriptorWrite** writes, uint32_t setCount, const uint32_t* writeCounts) {
+    g_Capture.backend.WriteSets(sets, writes, setCount, writeCounts);
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    for (uint32_t i = 0; i < setCount; i++)
+        RecordSetWrite(*sets[i], writes[i], writeCounts[i]);
+}
+
+void CaptureWriteSetPacked(SetHandle set, const void* data) {
+    g_Capture.backend.WriteSetPacked(set, data);
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    auto                        layoutId = g_Capture.setLayouts.find(set.id);
+    if (!data || layoutId == g_Capture.setLayouts.end())
+        return;
+    auto layout = g_Capture.layouts.find(layoutId->second);
+    if (layout == g_Capture.layouts.end())
+        return;
+
+    DescriptorWrite writes[SetLayoutDesc::MAX_BINDINGS];
+    RecordSetWrite(set, writes, UnpackDescriptorWrites(layout->second, data, writes));
+}
+
+// Replayed as a plain set: the cache only exists to share sets at runtime
+SetHandle CaptureAllocateCachedSet(DescriptorPoolHandle   pool,
+                                   SetLayoutHandle        layout,
+                                   const DescriptorWrite* writes,
+                                   uint32_t               writeCount) {
+    SetHandle handle = g_Capture.backend.AllocateCachedSet(pool, layout, writes, writeCount);
+    if (!handle.isValid())
+        return handle;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    if (g_Capture.cachedSets.insert(handle.id).second) {
+        RecordSet(handle, pool, layout);
+        RecordSetWrite(handle, writes, writes ? writeCount : 0);
+    }
+    return handle;
+}
+
+// Destruction is recorded so an id the backend frees and hands out again
+// during the capture names two resources in order, not one. `owner` is the
+// pool of a freed set.
+void RecordDestroy(CaptureChunk type, uint64_t id, uint64_t owner = 0) {
+    if (id == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    ByteWriter                  w(g_Capture.data);
+    const size_t                at = w.beginChunk(CaptureChunk::DESTROY);
+    w.write(id);
+    w(type);
+    w.write(owner);
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+
+    switch (type) {
+    case CaptureChunk::BUFFER:
+        std::erase_if(g_Capture.hostBuffers, [id](const HostBuffer& buffer) { return buffer.id == id; });
+        break;
+    case CaptureChunk::SET_LAYOUT:
+        g_Capture.layouts.erase(id);
+        break;
+    case CaptureChunk::SET:
+        g_Capture.setLayouts.erase(id);
+        g_Capture.cachedSets.erase(id);
+        break;
+    default:
+        break;
+    }
+}
+
+#define RX_CAPTURE_DESTROY(Name, HandleType, Chunk)                                                                              \
+    void CaptureDestroy##Name(HandleType& handle) {                                                                              \
+        const uint64_t id = handle.id;                                                                                           \
+        g_Capture.backend.Destroy##Name(handle);                                                                                 \
+        RecordDestroy(Chunk, id);                                                                                                \
+    }
+
+RX_CAPTURE_DESTROY(Buffer, BufferHandle, CaptureChunk::BUFFER)
+RX_CAPTURE_DESTROY(BufferView, BufferViewHandle, CaptureChunk::BUFFER_VIEW)
+RX_CAPTURE_DESTROY(Texture, TextureHandle, CaptureChunk::TEXTURE)
+RX_CAPTURE_DESTROY(TextureView, TextureViewHandle, CaptureChunk::TEXTURE_VIEW)
+RX_CAPTURE_DESTROY(Sampler, SamplerHandle, CaptureChunk::SAMPLER)
+RX_CAPTURE_DESTROY(Shader, ShaderHandle, CaptureChunk::SHADER)
+RX_CAPTURE_DESTROY(SetLayout, SetLayoutHandle, CaptureChunk::SET_LAYOUT)
+RX_CAPTURE_DESTROY(PipelineLayout, PipelineLayoutHandle, CaptureChunk::PIPELINE_LAYOUT)
+RX_CAPTURE_DESTROY(Pipeline, PipelineHandle, CaptureChunk::PIPELINE)
+RX_CAPTURE_DESTROY(DescriptorPool, DescriptorPoolHandle, CaptureChunk::DESCRIPTOR_POOL)
+
+#undef RX_CAPTURE_DESTROY
+
+void CaptureFreeSet(DescriptorPoolHandle pool, SetHandle& set) {
+    const uint64_t id = set.id;
+    g_Capture.backend.FreeSet(pool, set);
+    RecordDestroy(CaptureChunk::SET, id, pool.id);
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+// Capture
+//------------------------------------------------------------------------------
+
+void BeginCapture() {
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+
+    if (g_Capture.active) {
+        RENDERX_WARN("BeginCapture: a capture is already in progress");
+        return;
+    }
+    if (!g_DispatchTable.CreateBuffer) {
+        RENDERX_ERROR("BeginCapture: no backend is initialized");
+        return;
+    }
+
+    g_Capture.backend    = g_DispatchTable;
+    g_Capture.chunkCount = 0;
+    g_Capture.data.clear();
+    g_Capture.hostBuffers.clear();
+    g_Capture.cachedSets.clear();
+    g_Capture.layouts.clear();
+    g_Capture.setLayouts.clear();
+
+    g_DispatchTable.CreateBuffer                 = CaptureCreateBuffer;
+    g_DispatchTable.CreateBufferView             = CaptureCreateBufferView;
+    g_DispatchTable.CreateTexture                = CaptureCreateTexture;
+    g_DispatchTable.CreateTextureView            = CaptureCreateTextureView;
+    g_DispatchTable.CreateSampler                = CaptureCreateSampler;
+    g_DispatchTable.CreateShader                 = CaptureCreateShader;
+    g_DispatchTable.CreateSetLayout              = CaptureCreateSetLayout;
+    g_DispatchTable.CreatePipelineLayout         = CaptureCreatePipelineLayout;
+    g_DispatchTable.CreateGraphicsPipeline       = CaptureCreateGraphicsPipeline;
+    g_DispatchTable.CreateGraphicsPipelineAsync  = CaptureCreateGraphicsPipelineAsync;
+    g_DispatchTable.CreateGraphicsPipelinesAsync = CaptureCreateGraphicsPipelinesAsync;
+    g_DispatchTable.CreateDescriptorPool         = CaptureCreateDescriptorPool;
+    g_DispatchTable.AllocateSet                  = CaptureAllocateSet;
+    g_DispatchTable.AllocateSets                 = CaptureAllocateSets;
+    g_DispatchTable.WriteSet                     = CaptureWriteSet;
+    g_DispatchTable.WriteSets                    = CaptureWriteSets;
+    g_DispatchTable.WriteSetPacked               = CaptureWriteSetPacked;
+    g_DispatchTable.AllocateCachedSet            = CaptureAllocateCachedSet;
+    g_DispatchTable.DestroyBuffer                = CaptureDestroyBuffer;
+    g_DispatchTable.DestroyBufferView            = CaptureDestroyBufferView;
+    g_DispatchTable.DestroyTexture               = CaptureDestroyTexture;
+    g_DispatchTable.DestroyTextureView           = CaptureDestroyTextureView;
+    g_DispatchTable.DestroySampler               = CaptureDestroySampler;
+    g_DispatchTable.DestroyShader                = CaptureDestroyShader;
+    g_DispatchTable.DestroySetLayout             = CaptureDestroySetLayout;
+    g_DispatchTable.DestroyPipelineLayout        = CaptureDestroyPipelineLayout;
+    g_DispatchTable.DestroyPipeline              = CaptureDestroyPipeline;
+    g_DispatchTable.DestroyDescriptorPool        = CaptureDestroyDescriptorPool;
+    g_DispatchTable.FreeSet                      = CaptureFreeSet;
+
+    g_Capture.active = true;
+    RENDERX_INFO("Capture started");
+}
+
+bool EndCapture(const CommandStream& frame, const char* path) {
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+
+    if (!g_Capture.active) {
+        RENDERX_ERROR("EndCapture: BeginCapture was not called");
+        return false;
+    }
+
+    g_DispatchTable  = g_Capture.backend;
+    g_Capture.active = false;
+
+    ByteWriter w(g_Capture.data);
+
+    // Host-visible buffers are usually filled through MapBuffer after creation
+    for (const HostBuffer& buffer : g_Capture.hostBuffers) {
+        const void* mapped = g_DispatchTable.MapBuffer(BufferHandle(buffer.id));
+        if (!mapped)
+            continue;
+
+        const size_t at = w.beginChunk(CaptureChunk::BUFFER_CONTENTS);
+        w.write(buffer.id);
+        w.writeBytes(mapped, buffer.size);
+        w.endChunk(at);
+        g_Capture.chunkCount++;
+        g_DispatchTable.UnmapBuffer(BufferHandle(buffer.id));
+    }
+
+    const size_t at = w.beginChunk(CaptureChunk::FRAME);
+    w.writeBytes(frame.data(), frame.size());
+    w.endChunk(at);
+    g_Capture.chunkCount++;
+
+    std::vector<uint8_t> headerBytes;
+    ByteWriter           hw(headerBytes);
+    hw.write(CaptureFileHeader::MAGIC);
+    hw.write(CaptureFileHeader::VERSION);
+    hw.write(g_Capture.chunkCount);
+    hw.write(uint32_t(0));
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        RENDERX_ERROR("EndCapture: failed to open '{}' for writing", path);
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(headerBytes.data()), (std::streamsize)headerBytes.size());
+    file.write(reinterpret_cast<const char*>(g_Capture.data.data()), (std::streamsize)g_Capture.data.size());
+
+    RENDERX_INFO("Capture written to '{}': {} chunks, {} commands, {} bytes",
+                 path,
+                 g_Capture.chunkCount,
+                 frame.commandCount(),
+                 headerBytes.size() + g_Capture.data.size());
+
+    g_Capture.data.clear();
+    g_Capture.data.shrink_to_fit();
+    g_Capture.hostBuffers.clear();
+    g_Capture.cachedSets.clear();
+    g_Capture.layouts.clear();
+    g_Capture.setLayouts.clear();
+    return file.good();
+}
+
+bool IsCapturing() {
+    std::lock_guard<std::mutex> lock(g_Capture.mutex);
+    return g_Capture.active;
+}
+
+//------------------------------------------------------------------------------
+// Replay
+//------------------------------------------------------------------------------
+
+// Forwards a captured stream to a backend list, translating every captured
+// handle to the resource recreated for it. With no target it only discovers
+// attachments that need offscreen stand-ins.
+class CaptureRemapper final : public CommandList {
+public:
+    struct StandInRequest {
+        uint64_t viewId;
+        Format   format;
+        uint32_t width;
+        uint32_t height;
+        bool     depth;
+    };
+
+    explicit CaptureRemapper(CaptureReplayer& replayer)
+        : m_Replayer(replayer) {}
+
+    void setTarget(CommandList* target) { m_Target = target; }
+
+    const std::vector<StandInRequest>& standInRequests() const { return m_StandInRequests; }
+
+    void open() override {}
+    void close() override {}
+
+    void setPipeline(const PipelineHandle& pipeline) override {
+        if (m_Target)
+            m_Target->setPipeline(PipelineHandle(m_Replayer.remap(m_Replayer.m_Pipelines, pipeline.id)));
+    }
+    void setVertexBuffer(const BufferHandle& buffer, uint64_t offset) override {
+        if (m_Target)
+            m_Target->setVertexBuffer(buffer_(buffer), offset);
+    }
+    void setIndexBuffer(const BufferHandle& buffer, uint64_t offset, Format indextype) override {
+        if (m_Target)
+            m_Target->setIndexBuffer(buffer_(buffer), offset, indextype);
+    }
+    void setFramebuffer(FramebufferHandle) override { unsupported(CommandOp::SET_FRAMEBUFFER); }
+    void setViewport(const Viewport& viewport) override {
+        if (m_Target)
+            m_Target->setViewport(viewport);
+    }
+    void setScissor(const Scissor& scissor) override {
+        if (m_Target)
+            m_Target->setScissor(scissor);
+    }
+    void beginRenderPass(RenderPassHandle, const void*, uint32_t) override { unsupported(CommandOp::BEGIN_RENDER_PASS); }
+    void endRenderPass() override {}
+
+    void beginRendering(const RenderingDesc& desc) override {
+        if (!m_Target) {
+            discover(desc);
+            return;
+        }
+
+        m_Rendering = desc;
+        for (auto& color : m_Rendering.colorAttachments)
+            color.handle = view(color.handle);
+        if (m_Rendering.hasDepthStencil)
+            m_Rendering.depthStencilAttachment.handle = view(m_Rendering.depthStencilAttachment.handle);
+        m_Target->beginRendering(m_Rendering);
+    }
+    void endRendering() override {
+        if (m_Target)
+            m_Target->endRendering();
+    }
+
+    void writeBuffer(BufferHandle handle, const void* data, uint32_t offset, uint32_t size) override {
+        if (m_Target)
+            m_Target->writeBuffer(buffer_(handle), data, offset, size);
+    }
+    void copyBuffer(BufferHandle src, BufferHandle dst, const BufferCopy& region) override {
+        if (m_Target)
+            m_Target->copyBuffer(buffer_(src), buffer_(dst), region);
+    }
+    void copyTexture(TextureHandle src, TextureHandle dst, const TextureCopy& region) override {
+        if (m_Target)
+            m_Target->copyTexture(texture(src), texture(dst), region);
+    }
+    void copyBufferToTexture(BufferHandle src, TextureHandle dst, const TextureCopy& region) override {
+        if (m_Target)
+            m_Target->copyBufferToTexture(buffer_(src), texture(dst), region);
+    }
+    void copyTextureToBuffer(TextureHandle src, BufferHandle dst, const TextureCopy& region) override {
+        if (m_Target)
+            m_Target->copyTextureToBuffer(texture(src), buffer_(dst), region);
+    }
+
+    void Barrier(const Memory_Barrier* memoryBarriers,
+                 uint32_t              memoryCount,
+                 const BufferBarrier*  bufferBarriers,
+                 uint32_t              bufferCount,
+                 const TextureBarrier* imageBarriers,
+                 uint32_t              imageCount) override {
+        if (!m_Target)
+            return;
+
+        m_BufferBarriers.assign(bufferBarriers, bufferBarriers + bufferCount);
+        for (auto& b : m_BufferBarriers)
+            b.buffer = buffer_(b.buffer);
+
+        // Barriers on textures that were not captured (swapchain images) are
+        // dropped; stand-ins are transitioned by CaptureReplayer::Record
+        m_TextureBarriers.clear();
+        for (uint32_t i = 0; i < imageCount; i++) {
+            TextureBarrier b = imageBarriers[i];
+            b.texture        = texture(b.texture);
+            if (b.texture.isValid())
+                m_TextureBarriers.push_back(b);
+        }
+
+        if (memoryCount + m_BufferBarriers.size() + m_TextureBarriers.size() == 0)
+            return;
+        m_Target->Barrier(memoryBarriers,
+                          memoryCount,
+                          m_BufferBarriers.data(),
+                          (uint32_t)m_BufferBarriers.size(),
+                          m_TextureBarriers.data(),
+                          (uint32_t)m_TextureBarriers.size());
+    }
+
+    void drawIndexed(
+        uint32_t indexCount, int32_t vertexOffset, uint32_t instanceCount, uint32_t firstIndex, uint32_t firstInstance) override {
+        if (m_Target)
+            m_Target->drawIndexed(indexCount, vertexOffset, instanceCount, firstIndex, firstInstance);
+    }
+    void draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) override {
+        if (m_Target)
+            m_Target->draw(vertexCount, instanceCount, firstVertex, firstInstance);
+    }
+
+    void setDescriptorSet(uint32_t slot, SetHandle set) override {
+        if (m_Target)
+            m_Target->setDescriptorSet(slot, SetHandle(m_Replayer.remap(m_Replayer.m_Sets, set.id)));
+    }
+    void setDescriptorSets(uint32_t firstSlot, const SetHandle* sets, uint32_t count) override {
+        if (!m_Target)
+            return;
+        m_SetHandles.clear();
+        for (uint32_t i = 0; i < count; i++)
+            m_SetHandles.push_back(SetHandle(m_Replayer.remap(m_Replayer.m_Sets, sets[i].id)));
+        m_Target->setDescriptorSets(firstSlot, m_SetHandles.data(), count);
+    }
+    void setBindlessTable(BindlessTableHandle) override { unsupported(CommandOp::SET_BINDLESS_TABLE); }
+    void pushConstants(uint32_t slot, const void* data, uint32_t sizeIn32BitWords, uint32_t offsetIn32BitWords) override {
+        if (m_Target)
+            m_Target->pushConstants(slot, data, sizeIn32BitWords, offsetIn32BitWords);
+    }
+    void setDescriptorHeaps(DescriptorHeapHandle*, uint32_t) override { unsupported(CommandOp::SET_DESCRIPTOR_HEAPS); }
+    void setInlineCBV(uint32_t slot, BufferHandle buf, uint64_t offset) override {
+        if (m_Target)
+            m_Target->setInlineCBV(slot, buffer_(buf), offset);
+    }
+    void setInlineSRV(uint32_t slot, BufferHandle buf, uint64_t offset) override {
+        if (m_Target)
+            m_Target->setInlineSRV(slot, buffer_(buf), offset);
+    }
+    void setInlineUAV(uint32_t slot, BufferHandle buf, uint64_t offset) override {
+        if (m_Target)
+            m_Target->setInlineUAV(slot, buffer_(buf), offset);
+    }
+    void setDescriptorBufferOffset(uint32_t slot, uint32_t bufferIndex, uint64_t byteOffset) override {
+        if (m_Target)
+            m_Target->setDescriptorBufferOffset(slot, bufferIndex, byteOffset);
+    }
+    void setDynamicOffset(uint32_t slot, uint32_t byteOffset) override {
+        if (m_Target)
+            m_Target->setDynamicOffset(slot, byteOffset);
+    }
+    void pushDescriptor(uint32_t slot, const DescriptorWrite* writes, uint32_t count) override {
+        if (!m_Target)
+            return;
+        m_Writes.assign(writes, writes + count);
+        for (auto& write : m_Writes)
+            write = m_Replayer.remapWrite(write);
+        m_Target->pushDescriptor(slot, m_Writes.data(), count);
+    }
+
+private:
+    BufferHandle buffer_(BufferHandle h) const { return BufferHandle(m_Replayer.remap(m_Replayer.m_Buffers, h.id)); }
+    TextureHandle texture(TextureHandle h) const { return TextureHandle(m_Replayer.remap(m_Replayer.m_Textures, h.id)); }
+
+    TextureViewHandle view(TextureViewHandle h) const {
+        auto it = m_Replayer.m_StandIns.find(h.id);
+        if (it != m_Replayer.m_StandIns.end())
+            return it->second.view;
+        return TextureViewHandle(m_Replayer.remap(m_Replayer.m_TextureViews, h.id));
+    }
+
+    void discover(const RenderingDesc& desc) {
+        auto note = [&](TextureViewHandle h, Format format, bool depth) {
+            if (!h.isValid() || m_Replayer.m_TextureViews.count(h.id) || m_Replayer.m_StandIns.count(h.id))
+                return;
+            m_StandInRequests.push_back({h.id, format, (uint32_t)desc.width, (uint32_t)desc.height, depth});
+            m_Replayer.m_StandIns[h.id] = {};
+        };
+        for (const auto& color : desc.colorAttachments)
+            note(color.handle, color.format, false);
+        if (desc.hasDepthStencil)
+            note(desc.depthStencilAttachment.handle, desc.depthStencilAttachment.format, true);
+    }
+
+    void unsupported(CommandOp op) {
+        if (!m_Target)
+            RENDERX_WARN("CaptureReplayer: {} is not supported by capture replay and is skipped", CommandOpToString(op));
+    }
+
+    CaptureReplayer&             m_Replayer;
+    CommandList*                 m_Target = nullptr;
+    RenderingDesc                m_Rendering;
+    std::vector<BufferBarrier>   m_BufferBarriers;
+    std::vector<TextureBarrier>  m_TextureBarriers;
+    std::vector<SetHandle>       m_SetHandles;
+    std::vector<DescriptorWrite> m_Writes;
+    std::vector<StandInRequest>  m_StandInRequests;
+};
+
+CaptureReplayer::~CaptureReplayer() {
+    Release();
+}
+
+uint64_t CaptureReplayer::remap(const std::unordered_map<uint64_t, uint64_t>& map, uint64_t id) const {
+    if (id == 0)
+        return 0;
+    auto it = map.find(id);
+    return it != map.end() ? it->second : 0;
+}
+
+DescriptorWrite CaptureReplayer::remapWrite(DescriptorWrite write) const {
+    switch (write.type) {
+    case ResourceType::CONSTANT_BUFFER:
+    case ResourceType::STORAGE_BUFFER:
+    case ResourceType::RW_STORAGE_BUFFER:
+    case ResourceType::DYNAMIC_CONSTANT_BUFFER:
+    case ResourceType::DYNAMIC_STORAGE_BUFFER:
+        write.handle = remap(m_BufferViews, write.handle);
+        break;
+    case ResourceType::TEXTURE_SRV:
+    case ResourceType::TEXTURE_UAV:
+        write.handle = remap(m_TextureViews, write.handle);
+        break;
+    case ResourceType::COMBINED_TEXTURE_SAMPLER:
+        write.handle  = remap(m_TextureViews, write.handle);
+        write.sampler = remap(m_Samplers, write.sampler);
+        break;
+    case ResourceType::SAMPLER:
+        write.handle = remap(m_Samplers, write.handle);
+        break;
+    default:
+        write.handle = 0;
+        break;
+    }
+    return write;
+}
+
+bool CaptureReplayer::Load(const char* path) {
+    Release();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        RENDERX_ERROR("CaptureReplayer::Load: failed to open '{}'", path);
+        return false;
+    }
+
+    const std::streamoff fileSize = file.tellg();
+    if (fileSize <= 0) {
+        RENDERX_ERROR("CaptureReplayer::Load: '{}' is empty or unreadable", path);
+        return false;
+    }
+    std::vector<uint8_t> bytes((size_t)fileSize);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(bytes.data()), (std::streamsize)bytes.size());
+    if (!file) {
+        RENDERX_ERROR("CaptureReplayer::Load: failed to read '{}'", path);
+        return false;
+    }
+
+    ByteReader        reader(bytes.data(), bytes.size());
+    CaptureFileHeader header;
+    header.magic      = reader.read<uint32_t>();
+    header.version    = reader.read<uint32_t>();
+    header.chunkCount = reader.read<uint32_t>();
+    header._pad       = reader.read<uint32_t>();
+    if (!reader.ok() || header.magic != CaptureFileHeader::MAGIC) {
+        RENDERX_ERROR("CaptureReplayer::Load: '{}' is not a RenderX capture", path);
+        return false;
+    }
+    if (header.version != CaptureFileHeader::VERSION) {
+        RENDERX_ERROR("CaptureReplayer::Load: '{}' has version {}, expected {}", path, header.version, CaptureFileHeader::VERSION);
+        return false;
+    }
+    if (header.chunkCount > reader.remaining() / ByteWriter::CHUNK_HEADER_BYTES) {
+        RENDERX_ERROR("CaptureReplayer::Load: '{}' claims {} chunks, more than the file can hold", path, header.chunkCount);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header.chunkCount; i++) {
+        CaptureChunkHeader chunk;
+        chunk.type = reader.read<CaptureChunk>();
+        chunk._pad = reader.read<uint32_t>();
+        chunk.size = reader.read<uint64_t>();
+        if (!reader.ok() || chunk.size > reader.remaining()) {
+            RENDERX_ERROR("CaptureReplayer::Load: truncated chunk {} in '{}'", i, path);
+            Release();
+            return false;
+        }
+
+        const uint8_t* payload = reader.skip(chunk.size);
+        if (!loadChunk(chunk.type, payload, (size_t)chunk.size)) {
+            RENDERX_ERROR("CaptureReplayer::Load: malformed chunk {} (type {}) in '{}'", i, (uint32_t)chunk.type, path);
+            Release();
+            return false;
+        }
+    }
+
+    // Initial data is staged at creation; make sure it has landed before replay
+    FlushUploads();
+    createStandIns();
+
+    RENDERX_INFO("CaptureReplayer: loaded '{}' ({} resources, {} commands, {} stand-in targets)",
+                 path,
+                 m_ResourceCount,
+                 m_Frame.commandCount(),
+                 m_StandIns.size());
+    return true;
+}
+
+bool CaptureReplayer::loadChunk(CaptureChunk type, const uint8_t* data, size_t size) {
+    ByteReader r(data, size);
+    const auto id = r.read<uint64_t>();
+
+    switch (type) {
+    case CaptureChunk::BUFFER: {
+        BufferDesc desc;
+        r(desc);
+        std::string    name     = r.readString();
+        uint64_t       dataSize = 0;
+        const uint8_t* initial  = r.readBytes(dataSize);
+        // CreateBuffer reads desc.size bytes of initial data
+        if (!r.ok() || (initial && dataSize != desc.size))
+            return false;
+        desc.debugName    = name.empty() ? nullptr : name.c_str();
+        desc.initialData  = initial;
+        m_Buffers[id]     = CreateBuffer(desc).id;
+        m_BufferSizes[id] = desc.size;
+        break;
+    }
+    case CaptureChunk::BUFFER_VIEW: {
+        BufferViewDesc desc;
+        r(desc);
+        if (!r.ok())
+            return false;
+        desc.buffer       = BufferHandle(remap(m_Buffers, desc.buffer.id));
+        m_BufferViews[id] = CreateBufferView(desc).id;
+        break;
+    }
+    case CaptureChunk::TEXTURE: {
+        TextureDesc desc;
+        r(desc);
+        std::string    name     = r.readString();
+        uint64_t       dataSize = 0;
+        const uint8_t* initial  = r.readBytes(dataSize);
+        if (!r.ok() || (initial && dataSize != desc.size))
+            return false;
+        desc.debugName   = name.empty() ? nullptr : name.c_str();
+        desc.initialData = initial;
+        m_Textures[id]   = CreateTexture(desc).id;
+        break;
+    }
+    case CaptureChunk::TEXTURE_VIEW: {
+        TextureViewDesc desc;
+        r(desc);
+        if (!r.ok())
+            return false;
+        desc.texture       = TextureHandle(remap(m_Textures, desc.texture.id));
+        m_TextureViews[id] = CreateTextureView(desc).id;
+        break;
+    }
+    case CaptureChunk::SAMPLER: {
+        SamplerDesc desc;
+        r(desc);
+        if (!r.ok())
+            return false;
+        m_Samplers[id] = CreateSampler(desc).id;
+        break;
+    }
+    case CaptureChunk::SHADER: {
+        ShaderDesc desc;
+        r(desc.stage);
+        desc.entryPoint         = r.readString();
+        uint64_t       codeSize = 0;
+        const uint8_t* code     = r.readBytes(codeSize);
+        desc.source             = r.readString();
+        if (!r.ok())
+            return false;
+        desc.bytecode.assign(code, code + codeSize);
+        m_Shaders[id] = CreateShader(desc).id;
+        break;
+    }
+    case CaptureChunk::SET_LAYOUT: {
+        SetLayoutDesc desc;
+        r(desc);
+        if (!r.ok())
+            return false;
+        m_SetLayouts[id] = CreateSetLayout(desc).id;
+        break;
+    }
+    case CaptureChunk::PIPELINE_LAYOUT: {
+        std::vector<SetLayoutHandle>   layouts;
+        std::vector<PushConstantRange> ranges;
+        ReadArray(r, layouts);
+        ReadArray(r, ranges);
+        if (!r.ok())
+            return false;
+        for (auto& layout : layouts)
+            layout = SetLayoutHandle(remap(m_SetLayouts, layout.id));
+        m_PipelineLayouts[id] =
+            CreatePipelineLayout(layouts.data(), (uint32_t)layouts.size(), ranges.data(), (uint32_t)ranges.size()).id;
+        break;
+    }
+    case CaptureChunk::PIPELINE: {
+        PipelineDesc desc;
+        ReadArray(r, desc.shaders);
+        ReadArray(r, desc.vertexInputState.attributes, VertexAttribute(0, 0, Format::UNDEFINED, 0));
+        ReadArray(r, desc.vertexInputState.vertexBindings, VertexBinding(0, 0));
+        r(desc.primitiveType);
+        r(desc.rasterizer);
+        r(desc.depthStencil);
+        r(desc.blend);
+        r(desc.layout);
+        ReadArray(r, desc.colorFromats);
+        r(desc.depthFormat);
+        std::string name = r.readString();
+        if (!r.ok())
+            return false;
+        for (auto& shader : desc.shaders)
+            shader = ShaderHandle(remap(m_Shaders, shader.id));
+        desc.layout     = PipelineLayoutHandle(remap(m_PipelineLayouts, desc.layout.id));
+        desc.debugName  = name.empty() ? nullptr : name.c_str();
+        m_Pipelines[id] = CreateGraphicsPipeline(desc).id;
+        break;
+    }
+    case CaptureChunk::DESCRIPTOR_POOL: {
+        DescriptorPoolDesc desc;
+        r(desc);
+        if (!r.ok())
+            return false;
+        desc.layout = SetLayoutHandle(remap(m_SetLayouts, desc.layout.id));
+        desc.heap   = DescriptorHeapHandle(); // heaps are not captured
+        m_Pools[id] = CreateDescriptorPool(desc).id;
+        break;
+    }
+    case CaptureChunk::SET: {
+        const auto pool   = r.read<uint64_t>();
+        const auto layout = r.read<uint64_t>();
+        if (!r.ok())
+            return false;
+        m_Sets[id] =
+            AllocateSet(DescriptorPoolHandle(remap(m_Pools, pool)), SetLayoutHandle(remap(m_SetLayouts, layout))).id;
+        break;
+    }
+    case CaptureChunk::SET_WRITE: {
+        std::vector<DescriptorWrite> writes;
+        ReadArray(r, writes);
+        if (!r.ok())
+            return false;
+        for (auto& write : writes) {
+            // Recorded expanded; a wider write would index past the binding
+            if (write.count != 1)
+                return false;
+            write = remapWrite(write);
+        }
+        WriteSet(SetHandle(remap(m_Sets, id)), writes.data(), (uint32_t)writes.size());
+        return true;
+    }
+    case CaptureChunk::BUFFER_CONTENTS: {
+        uint64_t       dataSize = 0;
+        const uint8_t* contents = r.readBytes(dataSize);
+        auto           capacity = m_BufferSizes.find(id);
+        if (!r.ok() || capacity == m_BufferSizes.end() || dataSize > capacity->second)
+            return false;
+        const BufferHandle buffer(remap(m_Buffers, id));
+        void*              mapped = MapBuffer(buffer);
+        if (!mapped)
+            return true;
+        if (contents)
+            std::memcpy(mapped, contents, (size_t)dataSize);
+        UnmapBuffer(buffer);
+        return true;
+    }
+    case CaptureChunk::FRAME: {
+        // The frame chunk has no id; the first 8 bytes are the stream size
+        r = ByteReader(data, size);
+        uint64_t       streamSize = 0;
+        const uint8_t* stream     = r.readBytes(streamSize);
+        if (!r.ok())
+            return false;
+        return m_Frame.assign(stream, (size_t)streamSize);
+    }
+    case CaptureChunk::DESTROY: {
+        const auto resource = r.read<CaptureChunk>();
+        const auto owner    = r.read<uint64_t>();
+        if (!r.ok())
+            return false;
+        return destroyResource(resource, id, owner);
+    }
+    default:
+        RENDERX_WARN("CaptureReplayer: skipping unknown chunk type {}", (uint32_t)type);
+        return true;
+    }
+
+    m_ResourceCount++;
+    return true;
+}
+
+// Destroys the resource recreated for a captured id and forgets the mapping,
+// so a later chunk reusing the id creates a fresh one
+bool CaptureReplayer::destroyResource(CaptureChunk type, uint64_t id, uint64_t owner) {
+    auto take = [id](std::unordered_map<uint64_t, uint64_t>& map) -> uint64_t {
+        auto it = map.find(id);
+        if (it == map.end())
+            return 0; // created before the capture started
+        const uint64_t live = it->second;
+        map.erase(it);
+        return live;
+    };
+
+    switch (type) {
+    case CaptureChunk::BUFFER: {
+        BufferHandle h(take(m_Buffers));
+        m_BufferSizes.erase(id);
+        if (h.isValid())
+            DestroyBuffer(h);
+        return true;
+    }
+    case CaptureChunk::BUFFER_VIEW: {
+        BufferViewHandle h(take(m_BufferViews));
+        if (h.isValid())
+            DestroyBufferView(h);
+        return true;
+    }
+    case CaptureChunk::TEXTURE: {
+        TextureHandle h(take(m_Textures));
+        if (h.isValid())
+            DestroyTexture(h);
+        return true;
+    }
+    case CaptureChunk::TEXTURE_VIEW: {
+        TextureViewHandle h(take(m_TextureViews));
+        if (h.isValid())
+            DestroyTextureView(h);
+        return true;
+    }
+    case CaptureChunk::SAMPLER: {
+        SamplerHandle h(take(m_Samplers));
+        if (h.isValid())
+            DestroySampler(h);
+        return true;
+    }
+    case CaptureChunk::SHADER: {
+        ShaderHandle h(take(m_Shaders));
+        if (h.isValid())
+            DestroyShader(h);
+        return true;
+    }
+    case CaptureChunk::SET_LAYOUT: {
+        SetLayoutHandle h(take(m_SetLayouts));
+        if (h.isValid())
+            DestroySetLayout(h);
+        return true;
+    }
+    case CaptureChunk::PIPELINE_LAYOUT: {
+        PipelineLayoutHandle h(take(m_PipelineLayouts));
+        if (h.isValid())
+            DestroyPipelineLayout(h);
+        return true;
+    }
+    case CaptureChunk::PIPELINE: {
+        PipelineHandle h(take(m_Pipelines));
+        if (h.isValid())
+            DestroyPipeline(h);
+        return true;
+    }
+    case CaptureChunk::DESCRIPTOR_POOL: {
+        DescriptorPoolHandle h(take(m_Pools));
+        if (h.isValid())
+            DestroyDescriptorPool(h);
+        return true;
+    }
+    case CaptureChunk::SET: {
+        SetHandle h(take(m_Sets));
+        if (h.isValid())
+            FreeSet(DescriptorPoolHandle(remap(m_Pools, owner)), h);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+void CaptureReplayer::createStandIns() {
+    m_Remapper = std::make_unique<CaptureRemapper>(*this);
+
+    // Discovery pass: find attachments that were not created while capturing
+    m_Frame.Replay(m_Remapper.get());
+
+    for (const auto& request : m_Remapper->standInRequests()) {
+        TextureDesc desc = request.depth ? TextureDesc::DepthStencil(request.width, request.height, request.format)
+                                         : TextureDesc::RenderTarget(request.width, request.height, request.format);
+        desc.debugName   = "CaptureStandIn";
+
+        StandIn standIn;
+        standIn.texture = CreateTexture(desc);
+        standIn.view    = CreateTextureView(TextureViewDesc(standIn.texture).setFormat(request.format));
+        m_StandIns[request.viewId] = standIn;
+
+        // Contents are discarded every replay; the captured load ops clear them
+        TextureBarrier barrier(
+            standIn.texture,
+            TextureLayout::UNDEFINED,
+            request.depth ? TextureLayout::DEPTH_STENCIL_ATTACHMENT : TextureLayout::COLOR_ATTACHMENT,
+            PipelineStage::TOP_OF_PIPE,
+            AccessFlags::NONE,
+            request.depth ? PipelineStage::EARLY_FRAGMENT_TESTS : PipelineStage::COLOR_ATTACHMENT_OUTPUT,
+            request.depth ? AccessFlags::DEPTH_STENCIL_WRITE : AccessFlags::COLOR_ATTACHMENT_WRITE);
+        if (request.depth) {
+            barrier.range.aspect = TextureAspect::IMAGE_ASPECT_DEPTH;
+            if (request.format == Format::D24_UNORM_S8_UINT)
+                barrier.range.aspect = barrier.range.aspect | TextureAspect::IMAGE_ASPECT_STENCIL;
+        }
+        m_StandInBarriers.push_back(barrier);
+    }
+}
+
+void CaptureReplayer::Record(CommandList* target) {
+    RENDERX_ASSERT_MSG(m_Remapper, "CaptureReplayer::Record: nothing loaded");
+    if (!m_Remapper || !target)
+        return;
+
+    if (!m_StandInBarriers.empty())
+        target->Barrier(nullptr, 0, nullptr, 0, m_StandInBarriers.data(), (uint32_t)m_StandInBarriers.size());
+
+    m_Remapper->setTarget(target);
+    m_Frame.Replay(m_Remapper.get());
+    m_Remapper->setTarget(nullptr);
+}
+
+void CaptureReplayer::Release() {
+    if (!m_Remapper && m_ResourceCount == 0)
+        return;
+
+    GetGpuQueue(QueueType::GRAPHICS)->WaitIdle();
+
+    auto destroyAll = [](std::unordered_map<uint64_t, uint64_t>& map, auto destroy) {
+        for (auto& [captured, live] : map) {
+            if (live != 0)
+                destroy(live);
+        }
+        map.clear();
+    };
+
+    // Sets are owned by their pools
+    m_Sets.clear();
+    destroyAll(m_Pools, [](uint64_t id) {
+        DescriptorPoolHandle h(id);
+        DestroyDescriptorPool(h);
+    });
+    destroyAll(m_Pipelines, [](uint64_t id) {
+        PipelineHandle h(id);
+        DestroyPipeline(h);
+    });
+    destroyAll(m_PipelineLayouts, [](uint64_t id) {
+        PipelineLayoutHandle h(id);
+        DestroyPipelineLayout(h);
+    });
+    destroyAll(m_SetLayouts, [](uint64_t id) {
+        SetLayoutHandle h(id);
+        DestroySetLayout(h);
+    });
+    destroyAll(m_Shaders, [](uint64_t id) {
+        ShaderHandle h(id);
+        DestroyShader(h);
+    });
+    destroyAll(m_Samplers, [](uint64_t id) {
+        SamplerHandle h(id);
+        DestroySampler(h);
+    });
+    destroyAll(m_TextureViews, [](uint64_t id) {
+        TextureViewHandle h(id);
+        DestroyTextureView(h);
+    });
+    destroyAll(m_Textures, [](uint64_t id) {
+        TextureHandle h(id);
+        DestroyTexture(h);
+    });
+    destroyAll(m_BufferViews, [](uint64_t id) {
+        BufferViewHandle h(id);
+        DestroyBufferView(h);
+    });
+    destroyAll(m_Buffers, [](uint64_t id) {
+        BufferHandle h(id);
+        DestroyBuffer(h);
+    });
+    m_BufferSizes.clear();
+
+    for (auto& [captured, standIn] : m_StandIns) {
+        if (standIn.view.isValid())
+            DestroyTextureView(standIn.view);
+        if (standIn.texture.isValid())
+            DestroyTexture(standIn.texture);
+    }
+    m_StandIns.clear();
+    m_StandInBarriers.clear();
+
+    m_Remapper.reset();
+    m_Frame.clear();
+    m_ResourceCount = 0;
+}
+
+} // namespace Rx
@@ -0,0 +1,132 @@
+#pragma once
+#include "RX_CommandStream.h"
+#include <memory>
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+// FRAME CAPTURE
+//------------------------------------------------------------------------------
+// Serializes a frame — the resources it needs and the commands that draw it —
+// into a compact binary file that can be replayed without the application.
+//
+//   Rx::BeginCapture();                 // before creating the frame's resources
+//   ... create buffers, textures, pipelines, sets ...
+//   Rx::CommandStream frame;
+//   frame.open(); record(frame); frame.close();
+//   frame.Replay(cmd);                  // render normally
+//   Rx::EndCapture(frame, "frame.rxcap");
+//
+// While capturing, resource creation entry points in the dispatch table are
+// wrapped so every Create*/AllocateSet/WriteSet call is recorded together with
+// its initial data, and every Destroy*/FreeSet call so reused handle ids stay
+// distinct. CPU-visible buffers are snapshotted again at EndCapture so data
+// written through MapBuffer is preserved.
+//
+// Not captured: render passes / framebuffers (classic path), descriptor heaps
+// and bindless tables. Attachments that were not created while capturing
+// (swapchain images) are replaced by offscreen stand-ins on replay.
+//------------------------------------------------------------------------------
+
+namespace Rx {
+
+enum class CaptureChunk : uint32_t {
+    BUFFER,
+    BUFFER_VIEW,
+    TEXTURE,
+    TEXTURE_VIEW,
+    SAMPLER,
+    SHADER,
+    SET_LAYOUT,
+    PIPELINE_LAYOUT,
+    PIPELINE,
+    DESCRIPTOR_POOL,
+    SET,
+    SET_WRITE,
+    BUFFER_CONTENTS,
+    FRAME,
+    DESTROY, // id, the destroyed resource's chunk type, owning pool for sets
+    COUNT
+};
+
+// Headers and chunk payloads are written field by field at fixed widths, in
+// declaration order; nothing is stored as a raw struct image.
+struct CaptureFileHeader {
+    static constexpr uint32_t MAGIC   = 0x50435852; // "RXCP"
+    static constexpr uint32_t VERSION = 9; // 9: BC1_RGB formats renumber Format
+
+    uint32_t magic      = MAGIC;
+    uint32_t version    = VERSION;
+    uint32_t chunkCount = 0;
+    uint32_t _pad       = 0;
+};
+
+struct CaptureChunkHeader {
+    CaptureChunk type;
+    uint32_t     _pad = 0;
+    uint64_t     size = 0; // payload bytes following this header
+};
+
+RENDERX_EXPORT void BeginCapture();
+RENDERX_EXPORT bool EndCapture(const CommandStream& frame, const char* path);
+RENDERX_EXPORT bool IsCapturing();
+
+class CaptureRemapper;
+
+// Loads a capture file, recreates its resources on the active backend and
+// records the captured frame into any command list, with every handle
+// translated to the recreated resources.
+class RENDERX_EXPORT CaptureReplayer {
+public:
+    CaptureReplayer() = default;
+    ~CaptureReplayer();
+
+    CaptureReplayer(const CaptureReplayer&)            = delete;
+    CaptureReplayer& operator=(const CaptureReplayer&) = delete;
+
+    bool Load(const char* path);
+
+    // Destroys every recreated resource; must run before Rx::Shutdown
+    void Release();
+
+    // Records the captured frame into `target`, which must be open.
+    void Record(CommandList* target);
+
+    const CommandStream& GetFrame() const { return m_Frame; }
+    uint32_t             GetResourceCount() const { return m_ResourceCount; }
+
+private:
+    friend class CaptureRemapper;
+
+    struct StandIn {
+        TextureHandle     texture;
+        TextureViewHandle view;
+    };
+
+    bool            loadChunk(CaptureChunk type, const uint8_t* data, size_t size);
+    bool            destroyResource(CaptureChunk type, uint64_t id, uint64_t owner);
+    void            createStandIns();
+    uint64_t        remap(const std::unordered_map<uint64_t, uint64_t>& map, uint64_t id) const;
+    DescriptorWrite remapWrite(DescriptorWrite write) const;
+
+    std::unordered_map<uint64_t, uint64_t> m_Buffers;
+    std::unordered_map<uint64_t, uint64_t> m_BufferViews;
+    std::unordered_map<uint64_t, uint64_t> m_Textures;
+    std::unordered_map<uint64_t, uint64_t> m_TextureViews;
+    std::unordered_map<uint64_t, uint64_t> m_Samplers;
+    std::unordered_map<uint64_t, uint64_t> m_Shaders;
+    std::unordered_map<uint64_t, uint64_t> m_SetLayouts;
+    std::unordered_map<uint64_t, uint64_t> m_PipelineLayouts;
+    std::unordered_map<uint64_t, uint64_t> m_Pipelines;
+    std::unordered_map<uint64_t, uint64_t> m_Pools;
+    std::unordered_map<uint64_t, uint64_t> m_Sets;
+    std::unordered_map<uint64_t, uint64_t> m_BufferSizes; // captured buffer id -> size, bounds BUFFER_CONTENTS
+
+    std::unordered_map<uint64_t, StandIn> m_StandIns; // keyed by captured view id
+    std::vector<TextureBarrier>           m_StandInBarriers;
+
+    std::unique_ptr<CaptureRemapper> m_Remapper;
+    CommandStream                    m_Frame;
+    uint32_t                         m_ResourceCount = 0;
+};
+
+} // namespace Rx
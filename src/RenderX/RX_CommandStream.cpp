@@ -0,0 +1,827 @@
+#include "RX_CommandStream.h"
+#include "RX_Validation.h"
+#include <cstring>
+
+namespace Rx {
+
+namespace {
+
+constexpr uint32_t STREAM_ALIGN = 8;
+
+constexpr uint32_t AlignStream(uint32_t size) {
+    return (size + STREAM_ALIGN - 1) & ~(STREAM_ALIGN - 1);
+}
+
+// Packet payloads. Trailing arrays follow the payload directly, each starting
+// on an 8-byte boundary.
+
+struct SetPipelineCmd {
+    PipelineHandle pipeline;
+};
+
+struct SetBufferCmd {
+    BufferHandle buffer;
+    uint64_t     offset;
+    Format       format;
+};
+
+struct SetFramebufferCmd {
+    FramebufferHandle framebuffer;
+};
+
+struct BeginRenderPassCmd {
+    RenderPassHandle pass;
+    uint32_t         clearCount;
+};
+
+struct BeginRenderingCmd {
+    int32_t                    width;
+    int32_t                    height;
+    uint32_t                   colorCount;
+    uint32_t                   hasDepthStencil;
+    ClearColor                 clearColor;
+    DepthStencilAttachmentDesc depthStencil;
+    // AttachmentDesc[colorCount]
+};
+
+struct WriteBufferCmd {
+    BufferHandle buffer;
+    uint32_t     offset;
+    uint32_t     size;
+    // uint8_t[size]
+};
+
+struct CopyBufferCmd {
+    BufferHandle src;
+    BufferHandle dst;
+    BufferCopy   region;
+};
+
+struct CopyTextureCmd {
+    uint64_t    src; // raw handle ids — meaning depends on the op
+    uint64_t    dst;
+    TextureCopy region;
+};
+
+struct BarrierCmd {
+    uint32_t memoryCount;
+    uint32_t bufferCount;
+    uint32_t imageCount;
+    // Memory_Barrier[memoryCount], BufferBarrier[bufferCount], TextureBarrier[imageCount]
+};
+
+struct DrawIndexedCmd {
+    uint32_t indexCount;
+    int32_t  vertexOffset;
+    uint32_t instanceCount;
+    uint32_t firstIndex;
+    uint32_t firstInstance;
+};
+
+struct DrawCmd {
+    uint32_t vertexCount;
+    uint32_t instanceCount;
+    uint32_t firstVertex;
+    uint32_t firstInstance;
+};
+
+struct SlotCountCmd {
+    uint32_t slot;
+    uint32_t count;
+    // SetHandle[count] / DescriptorWrite[count] / DescriptorHeapHandle[count]
+};
+
+struct SetBindlessTableCmd {
+    BindlessTableHandle table;
+};
+
+struct PushConstantsCmd {
+    uint32_t slot;
+    uint32_t sizeIn32BitWords;
+    uint32_t offsetIn32BitWords;
+    // uint32_t[sizeIn32BitWords]
+};
+
+struct InlineViewCmd {
+    uint32_t     slot;
+    BufferHandle buffer;
+    uint64_t     offset;
+};
+
+struct DescriptorBufferOffsetCmd {
+    uint32_t slot;
+    uint32_t bufferIndex;
+    uint64_t byteOffset;
+};
+
+struct DynamicOffsetCmd {
+    uint32_t slot;
+    uint32_t byteOffset;
+};
+
+static_assert(std::is_trivially_copyable_v<Viewport>);
+static_assert(std::is_trivially_copyable_v<Scissor>);
+static_assert(std::is_trivially_copyable_v<ClearValue>);
+static_assert(std::is_trivially_copyable_v<AttachmentDesc>);
+static_assert(std::is_trivially_copyable_v<Memory_Barrier>);
+static_assert(std::is_trivially_copyable_v<BufferBarrier>);
+static_assert(std::is_trivially_copyable_v<TextureBarrier>);
+static_assert(std::is_trivially_copyable_v<DescriptorWrite>);
+static_assert(std::is_trivially_copyable_v<SetHandle>);
+static_assert(std::is_trivially_copyable_v<DescriptorHeapHandle>);
+
+constexpr uint64_t AlignStream64(uint64_t size) {
+    return (size + STREAM_ALIGN - 1) & ~uint64_t(STREAM_ALIGN - 1);
+}
+
+// Reads a fixed payload that may not be aligned (serialized streams)
+template <typename T> bool ReadPayload(const uint8_t* payload, uint64_t payloadBytes, T& out) {
+    if (payloadBytes < sizeof(T))
+        return false;
+    std::memcpy(&out, payload, sizeof(T));
+    return true;
+}
+
+// True when a packet's payload and every trailing array its counts describe
+// lie inside the `payloadBytes` that follow its header
+bool PacketFits(CommandOp op, const uint8_t* payload, uint64_t payloadBytes) {
+    auto withTrailing = [&](uint64_t cmdSize, uint64_t trailingBytes) {
+        return payloadBytes >= cmdSize && trailingBytes <= payloadBytes - AlignStream64(cmdSize);
+    };
+
+    switch (op) {
+    case CommandOp::SET_PIPELINE:
+        return payloadBytes >= sizeof(SetPipelineCmd);
+    case CommandOp::SET_VERTEX_BUFFER:
+    case CommandOp::SET_INDEX_BUFFER:
+        return payloadBytes >= sizeof(SetBufferCmd);
+    case CommandOp::SET_FRAMEBUFFER:
+        return payloadBytes >= sizeof(SetFramebufferCmd);
+    case CommandOp::SET_VIEWPORT:
+        return payloadBytes >= sizeof(Viewport);
+    case CommandOp::SET_SCISSOR:
+        return payloadBytes >= sizeof(Scissor);
+    case CommandOp::END_RENDER_PASS:
+    case CommandOp::END_RENDERING:
+        return true;
+    case CommandOp::BEGIN_RENDER_PASS: {
+        BeginRenderPassCmd cmd;
+        return ReadPayload(payload, payloadBytes, cmd) &&
+               withTrailing(sizeof(cmd), (uint64_t)cmd.clearCount * sizeof(ClearValue));
+    }
+    case CommandOp::BEGIN_RENDERING: {
+        BeginRenderingCmd cmd;
+        return ReadPayload(payload, payloadBytes, cmd) &&
+               withTrailing(sizeof(cmd), (uint64_t)cmd.colorCount * sizeof(AttachmentDesc));
+    }
+    case CommandOp::WRITE_BUFFER: {
+        WriteBufferCmd cmd;
+        return ReadPayload(payload, payloadBytes, cmd) && withTrailing(sizeof(cmd), cmd.size);
+    }
+    case CommandOp::COPY_BUFFER:
+        return payloadBytes >= sizeof(CopyBufferCmd);
+    case CommandOp::COPY_TEXTURE:
+    case CommandOp::COPY_BUFFER_TO_TEXTURE:
+    case CommandOp::COPY_TEXTURE_TO_BUFFER:
+        return payloadBytes >= sizeof(CopyTextureCmd);
+    case CommandOp::BARRIER: {
+        BarrierCmd cmd;
+        return ReadPayload(payload, payloadBytes, cmd) &&
+               withTrailing(sizeof(cmd),
+                            AlignStream64((uint64_t)cmd.memoryCount * sizeof(Memory_Barrier)) +
+                                AlignStream64((uint64_t)cmd.bufferCount * sizeof(BufferBarrier)) +
+                                (uint64_t)cmd.imageCount * sizeof(TextureBarrier));
+    }
+    case CommandOp::DRAW_INDEXED:
+        return payloadBytes >= sizeof(DrawIndexedCmd);
+    case CommandOp::DRAW:
+        return payloadBytes >= sizeof(DrawCmd);
+    case CommandOp::SET_DESCRIPTOR_SET:
+        return withTrailing(sizeof(SlotCountCmd), sizeof(SetHandle));
+    case CommandOp::SET_DESCRIPTOR_SETS:
+    case CommandOp::SET_DESCRIPTOR_HEAPS:
+    case CommandOp::PUSH_DESCRIPTOR: {
+        SlotCountCmd cmd;
+        if (!ReadPayload(payload, payloadBytes, cmd))
+            return false;
+        const uint64_t element = op == CommandOp::SET_DESCRIPTOR_SETS    ? sizeof(SetHandle)
+                                 : op == CommandOp::SET_DESCRIPTOR_HEAPS ? sizeof(DescriptorHeapHandle)
+                                                                         : sizeof(DescriptorWrite);
+        return withTrailing(sizeof(cmd), (uint64_t)cmd.count * element);
+    }
+    case CommandOp::SET_BINDLESS_TABLE:
+        return payloadBytes >= sizeof(SetBindlessTableCmd);
+    case CommandOp::PUSH_CONSTANTS: {
+        PushConstantsCmd cmd;
+        return ReadPayload(payload, payloadBytes, cmd) &&
+               withTrailing(sizeof(cmd), (uint64_t)cmd.sizeIn32BitWords * sizeof(uint32_t));
+    }
+    case CommandOp::SET_INLINE_CBV:
+    case CommandOp::SET_INLINE_SRV:
+    case CommandOp::SET_INLINE_UAV:
+        return payloadBytes >= sizeof(InlineViewCmd);
+    case CommandOp::SET_DESCRIPTOR_BUFFER_OFFSET:
+        return payloadBytes >= sizeof(DescriptorBufferOffsetCmd);
+    case CommandOp::SET_DYNAMIC_OFFSET:
+        return payloadBytes >= sizeof(DynamicOffsetCmd);
+    default:
+        return false;
+    }
+}
+
+// Walks packets in a stream buffer. Stops, with an error, at the first packet
+// whose header or trailing arrays run past the end of the buffer.
+class PacketReader {
+public:
+    PacketReader(const uint8_t* data, size_t size)
+        : m_Cursor(data),
+          m_End(data + size) {}
+
+    bool next() {
+        if (m_Cursor >= m_End)
+            return false;
+        const size_t remaining = (size_t)(m_End - m_Cursor);
+        m_Header               = reinterpret_cast<const CommandPacketHeader*>(m_Cursor);
+        if (remaining < sizeof(CommandPacketHeader) || m_Header->size < sizeof(CommandPacketHeader) ||
+            m_Header->size > remaining ||
+            !PacketFits(m_Header->op, m_Cursor + sizeof(CommandPacketHeader), m_Header->size - sizeof(CommandPacketHeader))) {
+            RENDERX_ERROR("CommandStream: corrupt packet, stopping");
+            m_Cursor = m_End;
+            return false;
+        }
+        m_Payload = m_Cursor + sizeof(CommandPacketHeader);
+        m_Cursor += m_Header->size;
+        return true;
+    }
+
+    CommandOp op() const { return m_Header->op; }
+
+    template <typename T> const T& payload() const { return *reinterpret_cast<const T*>(m_Payload); }
+
+    // Trailing array `index`, given the byte sizes of the arrays before it
+    template <typename T> const T* trailing(uint32_t payloadSize, uint32_t skipBytes = 0) const {
+        return reinterpret_cast<const T*>(m_Payload + AlignStream(payloadSize) + skipBytes);
+    }
+
+private:
+    const uint8_t*             m_Cursor;
+    const uint8_t*             m_End;
+    const CommandPacketHeader* m_Header  = nullptr;
+    const uint8_t*             m_Payload = nullptr;
+};
+
+// beginRendering takes a RenderingDesc with a std::vector; rebuild it from the
+// flattened packet into a per-thread scratch so replay does not allocate once
+// the vector has grown to the widest pass seen.
+const RenderingDesc& UnpackRenderingDesc(const PacketReader& reader) {
+    thread_local RenderingDesc scratch;
+
+    const auto&           cmd    = reader.payload<BeginRenderingCmd>();
+    const AttachmentDesc* colors = reader.trailing<AttachmentDesc>(sizeof(BeginRenderingCmd));
+
+    scratch.width                  = cmd.width;
+    scratch.height                 = cmd.height;
+    scratch.hasDepthStencil        = cmd.hasDepthStencil != 0;
+    scratch.clearColor             = cmd.clearColor;
+    scratch.depthStencilAttachment = cmd.depthStencil;
+    scratch.colorAttachments.assign(colors, colors + cmd.colorCount);
+    return scratch;
+}
+
+} // namespace
+
+const char* CommandOpToString(CommandOp op) {
+    switch (op) {
+    case CommandOp::SET_PIPELINE:
+        return "SET_PIPELINE";
+    case CommandOp::SET_VERTEX_BUFFER:
+        return "SET_VERTEX_BUFFER";
+    case CommandOp::SET_INDEX_BUFFER:
+        return "SET_INDEX_BUFFER";
+    case CommandOp::SET_FRAMEBUFFER:
+        return "SET_FRAMEBUFFER";
+    case CommandOp::SET_VIEWPORT:
+        return "SET_VIEWPORT";
+    case CommandOp::SET_SCISSOR:
+        return "SET_SCISSOR";
+    case CommandOp::BEGIN_RENDER_PASS:
+        return "BEGIN_RENDER_PASS";
+    case CommandOp::END_RENDER_PASS:
+        return "END_RENDER_PASS";
+    case CommandOp::BEGIN_RENDERING:
+        return "BEGIN_RENDERING";
+    case CommandOp::END_RENDERING:
+        return "END_RENDERING";
+    case CommandOp::WRITE_BUFFER:
+        return "WRITE_BUFFER";
+    case CommandOp::COPY_BUFFER:
+        return "COPY_BUFFER";
+    case CommandOp::COPY_TEXTURE:
+        return "COPY_TEXTURE";
+    case CommandOp::COPY_BUFFER_TO_TEXTURE:
+        return "COPY_BUFFER_TO_TEXTURE";
+    case CommandOp::COPY_TEXTURE_TO_BUFFER:
+        return "COPY_TEXTURE_TO_BUFFER";
+    case CommandOp::BARRIER:
+        return "BARRIER";
+    case CommandOp::DRAW_INDEXED:
+        return "DRAW_INDEXED";
+    case CommandOp::DRAW:
+        return "DRAW";
+    case CommandOp::SET_DESCRIPTOR_SET:
+        return "SET_DESCRIPTOR_SET";
+    case CommandOp::SET_DESCRIPTOR_SETS:
+        return "SET_DESCRIPTOR_SETS";
+    case CommandOp::SET_BINDLESS_TABLE:
+        return "SET_BINDLESS_TABLE";
+    case CommandOp::PUSH_CONSTANTS:
+        return "PUSH_CONSTANTS";
+    case CommandOp::SET_DESCRIPTOR_HEAPS:
+        return "SET_DESCRIPTOR_HEAPS";
+    case CommandOp::SET_INLINE_CBV:
+        return "SET_INLINE_CBV";
+    case CommandOp::SET_INLINE_SRV:
+        return "SET_INLINE_SRV";
+    case CommandOp::SET_INLINE_UAV:
+        return "SET_INLINE_UAV";
+    case CommandOp::SET_DESCRIPTOR_BUFFER_OFFSET:
+        return "SET_DESCRIPTOR_BUFFER_OFFSET";
+    case CommandOp::SET_DYNAMIC_OFFSET:
+        return "SET_DYNAMIC_OFFSET";
+    case CommandOp::PUSH_DESCRIPTOR:
+        return "PUSH_DESCRIPTOR";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+// Recording
+
+void* CommandStream::push(CommandOp op, const void* payload, uint32_t payloadSize, const void* extra, uint32_t extraSize) {
+    const uint32_t payloadBytes = AlignStream(payloadSize);
+    const uint32_t packetSize   = (uint32_t)sizeof(CommandPacketHeader) + payloadBytes + AlignStream(extraSize);
+
+    const size_t base = m_Data.size();
+    m_Data.resize(base + packetSize);
+
+    uint8_t*            dst = m_Data.data() + base;
+    CommandPacketHeader header{op, 0, packetSize};
+    std::memcpy(dst, &header, sizeof(header));
+    // resize() zero-fills, so a null payload or extra leaves zeroed space for
+    // the caller to fill in place
+    if (payload && payloadSize)
+        std::memcpy(dst + sizeof(header), payload, payloadSize);
+    if (extra && extraSize)
+        std::memcpy(dst + sizeof(header) + payloadBytes, extra, extraSize);
+
+    m_CommandCount++;
+    return dst + sizeof(header);
+}
+
+void CommandStream::clear() {
+    m_Data.clear();
+    m_CommandCount = 0;
+}
+
+bool CommandStream::assign(const void* data, size_t size) {
+    clear();
+
+    const auto* bytes  = static_cast<const uint8_t*>(data);
+    size_t      cursor = 0;
+    uint32_t    count  = 0;
+    while (cursor < size) {
+        CommandPacketHeader header;
+        if (size - cursor < sizeof(header)) {
+            RENDERX_ERROR("CommandStream::assign: truncated packet header at offset {}", cursor);
+            return false;
+        }
+        std::memcpy(&header, bytes + cursor, sizeof(header));
+        if (header.op >= CommandOp::COUNT || header.size < sizeof(header) || header.size % STREAM_ALIGN != 0 ||
+            header.size > size - cursor) {
+            RENDERX_ERROR("CommandStream::assign: malformed packet at offset {}", cursor);
+            return false;
+        }
+        if (!PacketFits(header.op, bytes + cursor + sizeof(header), header.size - sizeof(header))) {
+            RENDERX_ERROR("CommandStream::assign: {} packet at offset {} overruns its size",
+                          CommandOpToString(header.op),
+                          cursor);
+            return false;
+        }
+        cursor += header.size;
+        count++;
+    }
+
+    m_Data.assign(bytes, bytes + size);
+    m_CommandCount = count;
+    return true;
+}
+
+void CommandStream::open() {
+    clear();
+}
+
+void CommandStream::close() {}
+
+void CommandStream::setPipeline(const PipelineHandle& pipeline) {
+    push(CommandOp::SET_PIPELINE, SetPipelineCmd{pipeline});
+}
+
+void CommandStream::setVertexBuffer(const BufferHandle& buffer, uint64_t offset) {
+    push(CommandOp::SET_VERTEX_BUFFER, SetBufferCmd{buffer, offset, Format::UNDEFINED});
+}
+
+void CommandStream::setIndexBuffer(const BufferHandle& buffer, uint64_t offset, Format indextype) {
+    push(CommandOp::SET_INDEX_BUFFER, SetBufferCmd{buffer, offset, indextype});
+}
+
+void CommandStream::setFramebuffer(FramebufferHandle handle) {
+    push(CommandOp::SET_FRAMEBUFFER, SetFramebufferCmd{handle});
+}
+
+void CommandStream::setViewport(const Viewport& viewport) {
+    push(CommandOp::SET_VIEWPORT, viewport);
+}
+
+void CommandStream::setScissor(const Scissor& scissor) {
+    push(CommandOp::SET_SCISSOR, scissor);
+}
+
+void CommandStream::beginRenderPass(RenderPassHandle pass, const void* clearValues, uint32_t clearCount) {
+    push(CommandOp::BEGIN_RENDER_PASS,
+         BeginRenderPassCmd{pass, clearValues ? clearCount : 0},
+         clearValues,
+         clearValues ? clearCount * (uint32_t)sizeof(ClearValue) : 0);
+}
+
+void CommandStream::endRenderPass() {
+    push(CommandOp::END_RENDER_PASS, nullptr, 0);
+}
+
+void CommandStream::beginRendering(const RenderingDesc& desc) {
+    BeginRenderingCmd cmd{};
+    cmd.width           = desc.width;
+    cmd.height          = desc.height;
+    cmd.colorCount      = (uint32_t)desc.colorAttachments.size();
+    cmd.hasDepthStencil = desc.hasDepthStencil ? 1 : 0;
+    cmd.clearColor      = desc.clearColor;
+    cmd.depthStencil    = desc.depthStencilAttachment;
+
+    push(CommandOp::BEGIN_RENDERING,
+         cmd,
+         desc.colorAttachments.data(),
+         cmd.colorCount * (uint32_t)sizeof(AttachmentDesc));
+}
+
+void CommandStream::endRendering() {
+    push(CommandOp::END_RENDERING, nullptr, 0);
+}
+
+void CommandStream::writeBuffer(BufferHandle handle, const void* data, uint32_t offset, uint32_t size) {
+    push(CommandOp::WRITE_BUFFER, WriteBufferCmd{handle, offset, size}, data, size);
+}
+
+void CommandStream::copyBuffer(BufferHandle src, BufferHandle dst, const BufferCopy& region) {
+    push(CommandOp::COPY_BUFFER, CopyBufferCmd{src, dst, region});
+}
+
+void CommandStream::copyTexture(TextureHandle srcTexture, TextureHandle dstTexture, const TextureCopy& region) {
+    push(CommandOp::COPY_TEXTURE, CopyTextureCmd{srcTexture.id, dstTexture.id, region});
+}
+
+void CommandStream::copyBufferToTexture(BufferHandle srcBuffer, TextureHandle dstTexture, const TextureCopy& region) {
+    push(CommandOp::COPY_BUFFER_TO_TEXTURE, CopyTextureCmd{srcBuffer.id, dstTexture.id, region});
+}
+
+void CommandStream::copyTextureToBuffer(TextureHandle srcTexture, BufferHandle dstBuffer, const TextureCopy& region) {
+    push(CommandOp::COPY_TEXTURE_TO_BUFFER, CopyTextureCmd{srcTexture.id, dstBuffer.id, region});
+}
+
+void CommandStream::Barrier(const Memory_Barrier* memoryBarriers,
+                            uint32_t              memoryCount,
+                            const BufferBarrier*  bufferBarriers,
+                            uint32_t              bufferCount,
+                            const TextureBarrier* imageBarriers,
+                            uint32_t              imageCount) {
+    memoryCount = memoryBarriers ? memoryCount : 0;
+    bufferCount = bufferBarriers ? bufferCount : 0;
+    imageCount  = imageBarriers ? imageCount : 0;
+
+    const uint32_t memoryBytes = AlignStream(memoryCount * (uint32_t)sizeof(Memory_Barrier));
+    const uint32_t bufferBytes = AlignStream(bufferCount * (uint32_t)sizeof(BufferBarrier));
+    const uint32_t imageBytes  = imageCount * (uint32_t)sizeof(TextureBarrier);
+
+    // Reserve the header and all three arrays, then fill them in place
+    const uint32_t arrayBytes = memoryBytes + bufferBytes + imageBytes;
+    auto*          payload    = static_cast<uint8_t*>(push(CommandOp::BARRIER, nullptr, sizeof(BarrierCmd), nullptr, arrayBytes));
+
+    BarrierCmd cmd{memoryCount, bufferCount, imageCount};
+    std::memcpy(payload, &cmd, sizeof(cmd));
+
+    uint8_t* arrays = payload + AlignStream(sizeof(BarrierCmd));
+    if (memoryCount)
+        std::memcpy(arrays, memoryBarriers, memoryCount * sizeof(Memory_Barrier));
+    if (bufferCount)
+        std::memcpy(arrays + memoryBytes, bufferBarriers, bufferCount * sizeof(BufferBarrier));
+    if (imageCount)
+        std::memcpy(arrays + memoryBytes + bufferBytes, imageBarriers, imageCount * sizeof(TextureBarrier));
+}
+
+void CommandStream::drawIndexed(
+    uint32_t indexCount, int32_t vertexOffset, uint32_t instanceCount, uint32_t firstIndex, uint32_t firstInstance) {
+    push(CommandOp::DRAW_INDEXED, DrawIndexedCmd{indexCount, vertexOffset, instanceCount, firstIndex, firstInstance});
+}
+
+void CommandStream::draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+    push(CommandOp::DRAW, DrawCmd{vertexCount, instanceCount, firstVertex, firstInstance});
+}
+
+void CommandStream::setDescriptorSet(uint32_t slot, SetHandle set) {
+    push(CommandOp::SET_DESCRIPTOR_SET, SlotCountCmd{slot, 1}, &set, (uint32_t)sizeof(SetHandle));
+}
+
+void CommandStream::setDescriptorSets(uint32_t firstSlot, const SetHandle* sets, uint32_t count) {
+    push(CommandOp::SET_DESCRIPTOR_SETS, SlotCountCmd{firstSlot, count}, sets, count * (uint32_t)sizeof(SetHandle));
+}
+
+void CommandStream::setBindlessTable(BindlessTableHandle table) {
+    push(CommandOp::SET_BINDLESS_TABLE, SetBindlessTableCmd{table});
+}
+
+void CommandStream::pushConstants(uint32_t slot, const void* data, uint32_t sizeIn32BitWords, uint32_t offsetIn32BitWords) {
+    push(CommandOp::PUSH_CONSTANTS,
+         PushConstantsCmd{slot, sizeIn32BitWords, offsetIn32BitWords},
+         data,
+         sizeIn32BitWords * (uint32_t)sizeof(uint32_t));
+}
+
+void CommandStream::setDescriptorHeaps(DescriptorHeapHandle* heaps, uint32_t count) {
+    push(CommandOp::SET_DESCRIPTOR_HEAPS, SlotCountCmd{0, count}, heaps, count * (uint32_t)sizeof(DescriptorHeapHandle));
+}
+
+void CommandStream::setInlineCBV(uint32_t slot, BufferHandle buf, uint64_t offset) {
+    push(CommandOp::SET_INLINE_CBV, InlineViewCmd{slot, buf, offset});
+}
+
+void CommandStream::setInlineSRV(uint32_t slot, BufferHandle buf, uint64_t offset) {
+    push(CommandOp::SET_INLINE_SRV, InlineViewCmd{slot, buf, offset});
+}
+
+void CommandStream::setInlineUAV(uint32_t slot, BufferHandle buf, uint64_t offset) {
+    push(CommandOp::SET_INLINE_UAV, InlineViewCmd{slot, buf, offset});
+}
+
+void CommandStream::setDescriptorBufferOffset(uint32_t slot, uint32_t bufferIndex, uint64_t byteOffset) {
+    push(CommandOp::SET_DESCRIPTOR_BUFFER_OFFSET, DescriptorBufferOffsetCmd{slot, bufferIndex, byteOffset});
+}
+
+void CommandStream::setDynamicOffset(uint32_t slot, uint32_t byteOffset) {
+    push(CommandOp::SET_DYNAMIC_OFFSET, DynamicOffsetCmd{slot, byteOffset});
+}
+
+void CommandStream::pushDescriptor(uint32_t slot, const DescriptorWrite* writes, uint32_t count) {
+    // `handles` arrays are gone by replay time; record one descriptor per write
+    thread_local std::vector<DescriptorWrite> expanded;
+    expanded.clear();
+    ExpandDescriptorWrites(writes, count, expanded);
+    push(CommandOp::PUSH_DESCRIPTOR,
+         SlotCountCmd{slot, (uint32_t)expanded.size()},
+         expanded.data(),
+         (uint32_t)(expanded.size() * sizeof(DescriptorWrite)));
+}
+
+// Replay
+
+void CommandStream::Replay(CommandList* target) const {
+    RENDERX_ASSERT_MSG(target && target != this, "CommandStream::Replay: invalid target");
+    if (!target || target == this)
+        return;
+
+    PacketReader reader(m_Data.data(), m_Data.size());
+    while (reader.next()) {
+        switch (reader.op()) {
+        case CommandOp::SET_PIPELINE:
+            target->setPipeline(reader.payload<SetPipelineCmd>().pipeline);
+            break;
+        case CommandOp::SET_VERTEX_BUFFER: {
+            const auto& cmd = reader.payload<SetBufferCmd>();
+            target->setVertexBuffer(cmd.buffer, cmd.offset);
+            break;
+        }
+        case CommandOp::SET_INDEX_BUFFER: {
+            const auto& cmd = reader.payload<SetBufferCmd>();
+            target->setIndexBuffer(cmd.buffer, cmd.offset, cmd.format);
+            break;
+        }
+        case CommandOp::SET_FRAMEBUFFER:
+            target->setFramebuffer(reader.payload<SetFramebufferCmd>().framebuffer);
+            break;
+        case CommandOp::SET_VIEWPORT:
+            target->setViewport(reader.payload<Viewport>());
+            break;
+        case CommandOp::SET_SCISSOR:
+            target->setScissor(reader.payload<Scissor>());
+            break;
+        case CommandOp::BEGIN_RENDER_PASS: {
+            const auto& cmd = reader.payload<BeginRenderPassCmd>();
+            target->beginRenderPass(
+                cmd.pass, cmd.clearCount ? reader.trailing<ClearValue>(sizeof(cmd)) : nullptr, cmd.clearCount);
+            break;
+        }
+        case CommandOp::END_RENDER_PASS:
+            target->endRenderPass();
+            break;
+        case CommandOp::BEGIN_RENDERING:
+            target->beginRendering(UnpackRenderingDesc(reader));
+            break;
+        case CommandOp::END_RENDERING:
+            target->endRendering();
+            break;
+        case CommandOp::WRITE_BUFFER: {
+            const auto& cmd = reader.payload<WriteBufferCmd>();
+            target->writeBuffer(cmd.buffer, reader.trailing<uint8_t>(sizeof(cmd)), cmd.offset, cmd.size);
+            break;
+        }
+        case CommandOp::COPY_BUFFER: {
+            const auto& cmd = reader.payload<CopyBufferCmd>();
+            target->copyBuffer(cmd.src, cmd.dst, cmd.region);
+            break;
+        }
+        case CommandOp::COPY_TEXTURE: {
+            const auto& cmd = reader.payload<CopyTextureCmd>();
+            target->copyTexture(TextureHandle(cmd.src), TextureHandle(cmd.dst), cmd.region);
+            break;
+        }
+        case CommandOp::COPY_BUFFER_TO_TEXTURE: {
+            const auto& cmd = reader.payload<CopyTextureCmd>();
+            target->copyBufferToTexture(BufferHandle(cmd.src), TextureHandle(cmd.dst), cmd.region);
+            break;
+        }
+        case CommandOp::COPY_TEXTURE_TO_BUFFER: {
+            const auto& cmd = reader.payload<CopyTextureCmd>();
+            target->copyTextureToBuffer(TextureHandle(cmd.src), BufferHandle(cmd.dst), cmd.region);
+            break;
+        }
+        case CommandOp::BARRIER: {
+            const auto&    cmd         = reader.payload<BarrierCmd>();
+            const uint32_t memoryBytes = AlignStream(cmd.memoryCount * (uint32_t)sizeof(Memory_Barrier));
+            const uint32_t bufferBytes = AlignStream(cmd.bufferCount * (uint32_t)sizeof(BufferBarrier));
+            target->Barrier(cmd.memoryCount ? reader.trailing<Memory_Barrier>(sizeof(cmd)) : nullptr,
+                            cmd.memoryCount,
+                            cmd.bufferCount ? reader.trailing<BufferBarrier>(sizeof(cmd), memoryBytes) : nullptr,
+                            cmd.bufferCount,
+                            cmd.imageCount ? reader.trailing<TextureBarrier>(sizeof(cmd), memoryBytes + bufferBytes)
+                                           : nullptr,
+                            cmd.imageCount);
+            break;
+        }
+        case CommandOp::DRAW_INDEXED: {
+            const auto& cmd = reader.payload<DrawIndexedCmd>();
+            target->drawIndexed(cmd.indexCount, cmd.vertexOffset, cmd.instanceCount, cmd.firstIndex, cmd.firstInstance);
+            break;
+        }
+        case CommandOp::DRAW: {
+            const auto& cmd = reader.payload<DrawCmd>();
+            target->draw(cmd.vertexCount, cmd.instanceCount, cmd.firstVertex, cmd.firstInstance);
+            break;
+        }
+        case CommandOp::SET_DESCRIPTOR_SET: {
+            const auto& cmd = reader.payload<SlotCountCmd>();
+            target->setDescriptorSet(cmd.slot, *reader.trailing<SetHandle>(sizeof(cmd)));
+            break;
+        }
+        case CommandOp::SET_DESCRIPTOR_SETS: {
+            const auto& cmd = reader.payload<SlotCountCmd>();
+            target->setDescriptorSets(cmd.slot, reader.trailing<SetHandle>(sizeof(cmd)), cmd.count);
+            break;
+        }
+        case CommandOp::SET_BINDLESS_TABLE:
+            target->setBindlessTable(reader.payload<SetBindlessTableCmd>().table);
+            break;
+        case CommandOp::PUSH_CONSTANTS: {
+            const auto& cmd = reader.payload<PushConstantsCmd>();
+            target->pushConstants(
+                cmd.slot, reader.trailing<uint32_t>(sizeof(cmd)), cmd.sizeIn32BitWords, cmd.offsetIn32BitWords);
+            break;
+        }
+        case CommandOp::SET_DESCRIPTOR_HEAPS: {
+            // The interface takes a mutable pointer but never writes through it
+            const auto& cmd = reader.payload<SlotCountCmd>();
+            target->setDescriptorHeaps(const_cast<DescriptorHeapHandle*>(reader.trailing<DescriptorHeapHandle>(sizeof(cmd))),
+                                       cmd.count);
+            break;
+        }
+        case CommandOp::SET_INLINE_CBV: {
+            const auto& cmd = reader.payload<InlineViewCmd>();
+            target->setInlineCBV(cmd.slot, cmd.buffer, cmd.offset);
+            break;
+        }
+        case CommandOp::SET_INLINE_SRV: {
+            const auto& cmd = reader.payload<InlineViewCmd>();
+            target->setInlineSRV(cmd.slot, cmd.buffer, cmd.offset);
+            break;
+        }
+        case CommandOp::SET_INLINE_UAV: {
+            const auto& cmd = reader.payload<InlineViewCmd>();
+            target->setInlineUAV(cmd.slot, cmd.buffer, cmd.offset);
+            break;
+        }
+        case CommandOp::SET_DESCRIPTOR_BUFFER_OFFSET: {
+            const auto& cmd = reader.payload<DescriptorBufferOffsetCmd>();
+            target->setDescriptorBufferOffset(cmd.slot, cmd.bufferIndex, cmd.byteOffset);
+            break;
+        }
+        case CommandOp::SET_DYNAMIC_OFFSET: {
+            const auto& cmd = reader.payload<DynamicOffsetCmd>();
+            target->setDynamicOffset(cmd.slot, cmd.byteOffset);
+            break;
+        }
+        case CommandOp::PUSH_DESCRIPTOR: {
+            const auto& cmd = reader.payload<SlotCountCmd>();
+            target->pushDescriptor(cmd.slot, reader.trailing<DescriptorWrite>(sizeof(cmd)), cmd.count);
+            break;
+        }
+        default:
+            RENDERX_ERROR("CommandStream::Replay: unknown op {}", (uint32_t)reader.op());
+            return;
+        }
+    }
+}
+
+// Offline validation
+
+void CommandStream::Validate() const {
+    using Validation::ValidationLayer;
+
+    // The validation layer tracks state per CommandList*; the stream registers
+    // itself for the duration of the walk.
+    CommandList*     self       = const_cast<CommandStream*>(this);
+    ValidationLayer& validation = ValidationLayer::Get();
+
+    validation.RegisterCommandList(self);
+    validation.OnCommandListBegin(self);
+
+    PacketReader reader(m_Data.data(), m_Data.size());
+    while (reader.next()) {
+        switch (reader.op()) {
+        case CommandOp::SET_PIPELINE:
+            validation.ValidateSetPipeline(self, reader.payload<SetPipelineCmd>().pipeline);
+            break;
+        case CommandOp::SET_VERTEX_BUFFER:
+            validation.ValidateSetVertexBuffer(self, reader.payload<SetBufferCmd>().buffer);
+            break;
+        case CommandOp::SET_INDEX_BUFFER:
+            validation.ValidateSetIndexBuffer(self, reader.payload<SetBufferCmd>().buffer);
+            break;
+        case CommandOp::BEGIN_RENDER_PASS:
+            validation.ValidateBeginRenderPass(self, reader.payload<BeginRenderPassCmd>().pass);
+            break;
+        case CommandOp::END_RENDER_PASS:
+            validation.ValidateEndRenderPass(self);
+            break;
+        case CommandOp::BEGIN_RENDERING:
+            validation.ValidateBeginRendering(self, UnpackRenderingDesc(reader));
+            break;
+        case CommandOp::END_RENDERING:
+            validation.ValidateEndRendering(self);
+            break;
+        case CommandOp::WRITE_BUFFER: {
+            const auto& cmd = reader.payload<WriteBufferCmd>();
+            validation.ValidateBufferWrite(cmd.buffer, cmd.offset, cmd.size);
+            break;
+        }
+        case CommandOp::COPY_BUFFER: {
+            const auto& cmd = reader.payload<CopyBufferCmd>();
+            validation.ValidateBufferCopy(cmd.src, cmd.dst, cmd.region);
+            break;
+        }
+        case CommandOp::COPY_TEXTURE: {
+            const auto& cmd = reader.payload<CopyTextureCmd>();
+            validation.ValidateTextureCopy(TextureHandle(cmd.src), TextureHandle(cmd.dst), cmd.region);
+            break;
+        }
+        case CommandOp::COPY_BUFFER_TO_TEXTURE: {
+            const auto& cmd = reader.payload<CopyTextureCmd>();
+            validation.ValidateBufferToTextureCopy(BufferHandle(cmd.src), TextureHandle(cmd.dst), cmd.region);
+            break;
+        }
+        case CommandOp::DRAW_INDEXED: {
+            const auto& cmd = reader.payload<DrawIndexedCmd>();
+            validation.ValidateDrawIndexed(self, cmd.indexCount, cmd.instanceCount);
+            break;
+        }
+        case CommandOp::DRAW: {
+            const auto& cmd = reader.payload<DrawCmd>();
+            validation.ValidateDrawCall(self, cmd.vertexCount, cmd.instanceCount);
+            break;
+        }
+        default:
+            // No validation hook for this op yet
+            break;
+        }
+    }
+
+    validation.OnCommandListEnd(self);
+    validation.UnregisterCommandList(self);
+}
+
+} // namespace Rx
@@ -0,0 +1,150 @@
+#pragma once
+#include "RX_Common.h"
+
+//------------------------------------------------------------------------------
+// COMMAND STREAM
+//------------------------------------------------------------------------------
+// Backend-agnostic, packed encoding of CommandList calls. A CommandStream is
+// itself a CommandList: record into it with the usual API, then Replay() it
+// into any backend list as many times as needed. Static parts of a frame
+// (UI, static geometry passes) can be recorded once and replayed cheaply, and
+// Validate() runs the validation layer over the stream off the hot path.
+//
+// Layout: a flat byte buffer of packets. Each packet is a CommandPacketHeader
+// followed by a POD payload and optional trailing arrays; sizes are rounded up
+// to 8 bytes so every header and payload stays naturally aligned.
+//
+// Handles are stored by value — the resources they name must outlive every
+// replay of the stream.
+//------------------------------------------------------------------------------
+
+namespace Rx {
+
+enum class CommandOp : uint16_t {
+    SET_PIPELINE,
+    SET_VERTEX_BUFFER,
+    SET_INDEX_BUFFER,
+    SET_FRAMEBUFFER,
+    SET_VIEWPORT,
+    SET_SCISSOR,
+    BEGIN_RENDER_PASS,
+    END_RENDER_PASS,
+    BEGIN_RENDERING,
+    END_RENDERING,
+    WRITE_BUFFER,
+    COPY_BUFFER,
+    COPY_TEXTURE,
+    COPY_BUFFER_TO_TEXTURE,
+    COPY_TEXTURE_TO_BUFFER,
+    BARRIER,
+    DRAW_INDEXED,
+    DRAW,
+    SET_DESCRIPTOR_SET,
+    SET_DESCRIPTOR_SETS,
+    SET_BINDLESS_TABLE,
+    PUSH_CONSTANTS,
+    SET_DESCRIPTOR_HEAPS,
+    SET_INLINE_CBV,
+    SET_INLINE_SRV,
+    SET_INLINE_UAV,
+    SET_DESCRIPTOR_BUFFER_OFFSET,
+    SET_DYNAMIC_OFFSET,
+    PUSH_DESCRIPTOR,
+    COUNT
+};
+
+RENDERX_EXPORT const char* CommandOpToString(CommandOp op);
+
+struct CommandPacketHeader {
+    CommandOp op;
+    uint16_t  _pad = 0;
+    uint32_t  size = 0; // header + payload, multiple of 8
+};
+static_assert(sizeof(CommandPacketHeader) == 8);
+
+class RENDERX_EXPORT CommandStream final : public CommandList {
+public:
+    CommandStream() = default;
+    explicit CommandStream(size_t reserveBytes) { m_Data.reserve(reserveBytes); }
+
+    // Recording. open() discards previous contents but keeps capacity.
+    void open() override;
+    void close() override;
+
+    void setPipeline(const PipelineHandle& pipeline) override;
+    void setVertexBuffer(const BufferHandle& buffer, uint64_t offset = 0) override;
+    void setIndexBuffer(const BufferHandle& buffer, uint64_t offset = 0, Format indextype = Format::UINT32) override;
+    void setFramebuffer(FramebufferHandle handle) override;
+    void setViewport(const Viewport& viewport) override;
+    void setScissor(const Scissor& scissor) override;
+    void beginRenderPass(RenderPassHandle pass, const void* clearValues, uint32_t clearCount) override;
+    void endRenderPass() override;
+    void beginRendering(const RenderingDesc& desc) override;
+    void endRendering() override;
+    void writeBuffer(BufferHandle handle, const void* data, uint32_t offset, uint32_t size) override;
+    void copyBuffer(BufferHandle src, BufferHandle dst, const BufferCopy& region) override;
+    void copyTexture(TextureHandle srcTexture, TextureHandle dstTexture, const TextureCopy& region) override;
+    void copyBufferToTexture(BufferHandle srcBuffer, TextureHandle dstTexture, const TextureCopy& region) override;
+    void copyTextureToBuffer(TextureHandle srcTexture, BufferHandle dstBuffer, const TextureCopy& region) override;
+    void Barrier(const Memory_Barrier* memoryBarriers,
+                 uint32_t              memoryCount,
+                 const BufferBarrier*  bufferBarriers,
+                 uint32_t              bufferCount,
+                 const TextureBarrier* imageBarriers,
+                 uint32_t              imageCount) override;
+    void drawIndexed(uint32_t indexCount,
+                     int32_t  vertexOffset  = 0,
+                     uint32_t instanceCount = 1,
+                     uint32_t firstIndex    = 0,
+                     uint32_t firstInstance = 0) override;
+    void draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) override;
+    void setDescriptorSet(uint32_t slot, SetHandle set) override;
+    void setDescriptorSets(uint32_t firstSlot, const SetHandle* sets, uint32_t count) override;
+    void setBindlessTable(BindlessTableHandle table) override;
+    void pushConstants(uint32_t slot, const void* data, uint32_t sizeIn32BitWords, uint32_t offsetIn32BitWords = 0) override;
+    void setDescriptorHeaps(DescriptorHeapHandle* heaps, uint32_t count) override;
+    void setInlineCBV(uint32_t slot, BufferHandle buf, uint64_t offset = 0) override;
+    void setInlineSRV(uint32_t slot, BufferHandle buf, uint64_t offset = 0) override;
+    void setInlineUAV(uint32_t slot, BufferHandle buf, uint64_t offset = 0) override;
+    void setDescriptorBufferOffset(uint32_t slot, uint32_t bufferIndex, uint64_t byteOffset) override;
+    void setDynamicOffset(uint32_t slot, uint32_t byteOffset) override;
+    void pushDescriptor(uint32_t slot, const DescriptorWrite* writes, uint32_t count) override;
+
+    using CommandList::setScissor;
+    using CommandList::setViewport;
+
+    // Re-issues every recorded command on `target`. The target must already be
+    // open; the stream never calls open()/close() on it.
+    void Replay(CommandList* target) const;
+
+    // Runs the validation layer over the recorded commands, as if they had been
+    // recorded on a fresh list.
+    void Validate() const;
+
+    void clear();
+
+    // Adopts a previously serialized stream (e.g. from a capture file).
+    // Returns false and leaves the stream empty if the packets are malformed.
+    bool assign(const void* data, size_t size);
+
+    const uint8_t* data() const { return m_Data.data(); }
+    size_t         size() const { return m_Data.size(); }
+    uint32_t       commandCount() const { return m_CommandCount; }
+    bool           empty() const { return m_CommandCount == 0; }
+
+private:
+    // Appends a packet: header, payload, then one optional trailing byte range.
+    // A null payload or extra reserves zeroed space instead of copying, and the
+    // returned payload pointer lets callers fill it in place.
+    void* push(CommandOp op, const void* payload, uint32_t payloadSize, const void* extra = nullptr, uint32_t extraSize = 0);
+
+    template <typename T> void push(CommandOp op, const T& payload, const void* extra = nullptr, uint32_t extraSize = 0) {
+        static_assert(std::is_trivially_copyable_v<T>, "command payloads must be POD");
+        push(op, &payload, sizeof(T), extra, extraSize);
+    }
+
+    std::vector<uint8_t> m_Data;
+    uint32_t             m_CommandCount = 0;
+};
+
+} // namespace Rx
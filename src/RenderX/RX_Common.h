@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -148,6 +149,15 @@ namespace Rx {
                                                                                                                                  \
     /* Pipeline Graphics */                                                                                                      \
     X(PipelineHandle, CreateGraphicsPipeline, (PipelineDesc & desc), (desc))                                                     \
+    /* Compiled on worker threads. The handle is usable at once: until IsPipelineReady, binding it binds */                      \
+    /* `fallback` (same layout), or waits for the compile when there is none */                                                  \
+    X(PipelineHandle, CreateGraphicsPipelineAsync, (const PipelineDesc& desc, PipelineHandle fallback), (desc, fallback))        \
+    /* Same for `count` pipelines, split across the compile workers; each share is one vkCreateGraphicsPipelines */              \
+    X(void,                                                                                                                      \
+      CreateGraphicsPipelinesAsync,                                                                                              \
+      (const PipelineDesc* descs, uint32_t count, PipelineHandle* outPipelines, PipelineHandle fallback),                        \
+      (descs, count, outPipelines, fallback))                                                                                    \
+    X(bool, IsPipelineReady, (PipelineHandle pipeline), (pipeline))                                                              \
                                                                                                                                  \
     X(ShaderHandle, CreateShader, (const ShaderDesc& desc), (desc))                                                              \
                                                                                                                                  \
@@ -173,6 +183,8 @@ namespace Rx {
     X(void, DestroyFramebuffer, (FramebufferHandle & framebuffer), (framebuffer))                                                \
                                                                                                                                  \
     X(void*, MapBuffer, (BufferHandle handle), (handle))                                                                         \
+    /* Balances MapBuffer; persistently mapped buffers stay mapped */                                                            \
+    X(void, UnmapBuffer, (BufferHandle handle), (handle))                                                                        \
                                                                                                                                  \
     X(TextureHandle, CreateTexture, (const TextureDesc& desc), (desc))                                                           \
     X(void, DestroyTexture, (TextureHandle & handle), (handle))                                                                  \
@@ -185,6 +197,15 @@ namespace Rx {
     X(Swapchain*, CreateSwapchain, (const SwapchainDesc& desc), (desc))                                                          \
     X(void, DestroySwapchain, (Swapchain * swapchain), (swapchain))                                                              \
                                                                                                                                  \
+    X(FrameContext*, CreateFrameContext, (const FrameContextDesc& desc), (desc))                                                 \
+    X(void, DestroyFrameContext, (FrameContext * context), (context))                                                            \
+                                                                                                                                 \
+    X(TransientAllocator*, CreateTransientAllocator, (const TransientAllocatorDesc& desc), (desc))                               \
+    X(void, DestroyTransientAllocator, (TransientAllocator * allocator), (allocator))                                            \
+                                                                                                                                 \
+    X(GeometryPool*, CreateGeometryPool, (const GeometryPoolDesc& desc), (desc))                                                 \
+    X(void, DestroyGeometryPool, (GeometryPool * pool), (pool))                                                                  \
+                                                                                                                                 \
     X(DescriptorPoolHandle, CreateDescriptorPool, (const DescriptorPoolDesc& desc), (desc))                                      \
     X(void, DestroyDescriptorPool, (DescriptorPoolHandle & handle), (handle))                                                    \
     X(void, ResetDescriptorPool, (DescriptorPoolHandle handle), (handle))                                                        \
@@ -201,15 +222,44 @@ namespace Rx {
       WriteSets,                                                                                                                 \
       (SetHandle * *sets, const DescriptorWrite** writes, uint32_t setCount, const uint32_t* writeCounts),                       \
       (sets, writes, setCount, writeCounts))                                                                                     \
+    X(void, WriteSetPacked, (SetHandle set, const void* data), (set, data))                                                      \
+    X(SetHandle,                                                                                                                 \
+      AllocateCachedSet,                                                                                                         \
+      (DescriptorPoolHandle pool, SetLayoutHandle layout, const DescriptorWrite* writes, uint32_t writeCount),                   \
+      (pool, layout, writes, writeCount))                                                                                        \
+    X(void, TrimSetCache, (uint32_t maxFrameAge), (maxFrameAge))                                                                 \
     X(DescriptorHeapHandle, CreateDescriptorHeap, (const DescriptorHeapDesc& desc), (desc))                                      \
     X(void, DestroyDescriptorHeap, (DescriptorHeapHandle & handle), (handle))                                                    \
     X(DescriptorPointer, GetDescriptorHeapPtr, (DescriptorHeapHandle heap, uint32_t index), (heap, index))                       \
+    X(SetLayoutMemoryInfo, GetSetLayoutMemoryInfo, (SetLayoutHandle layout), (layout))                                           \
+    X(DescriptorCaps, GetDescriptorCaps, (), ())                                                                                 \
+    X(BindlessTableHandle, CreateBindlessTable, (const BindlessTableDesc& desc), (desc))                                         \
+    X(void, DestroyBindlessTable, (BindlessTableHandle & handle), (handle))                                                      \
+    X(SetLayoutHandle, GetBindlessSetLayout, (BindlessTableHandle table), (table))                                               \
+    X(uint32_t, GetTextureViewBindlessIndex, (TextureViewHandle view), (view))                                                   \
+    X(uint32_t, GetBufferViewBindlessIndex, (BufferViewHandle view), (view))                                                     \
+    X(uint32_t, GetSamplerBindlessIndex, (SamplerHandle sampler), (sampler))                                                     \
     X(SamplerHandle, CreateSampler, (const SamplerDesc& desc), (desc))                                                           \
     X(void, DestroySampler, (SamplerHandle & handle), (handle))                                                                  \
     X(void, DestroyBuffer, (BufferHandle & handle), (handle))                                                                    \
     X(void, DestroyPipeline, (PipelineHandle & handle), (handle))                                                                \
     X(void, DestroyPipelineLayout, (PipelineLayoutHandle & handle), (handle))                                                    \
     X(void, FlushUploads, (), ())                                                                                                \
+    /* Asynchronous uploads: copied to staging now, submitted on the transfer queue by SubmitUploads. */                         \
+    /* False when nothing was queued (invalid request or staging exhausted); the data is not uploaded */                         \
+    X(bool,                                                                                                                      \
+      UploadBuffer,                                                                                                              \
+      (BufferHandle dst, const void* data, uint32_t size, uint32_t dstOffset),                                                   \
+      (dst, data, size, dstOffset))                                                                                              \
+    X(bool,                                                                                                                      \
+      UploadTexture,                                                                                                             \
+      (TextureHandle dst, const void* data, uint32_t size, const TextureCopy& region),                                           \
+      (dst, data, size, region))                                                                                                 \
+    X(Timeline, SubmitUploads, (), ())                                                                                           \
+                                                                                                                                 \
+    X(FormatFeature, GetFormatFeatures, (Format format), (format))                                                               \
+    /* Writes the pipeline cache to InitDesc::pipelineCachePath; false if it could not be written */                             \
+    X(bool, SavePipelineCache, (), ())                                                                                           \
     X(void, PrintHandles, (), ())
 
 // Base Handle Template
@@ -327,7 +377,8 @@ enum class Platform : uint8_t {
 
 enum class WindowSystem {
     X11,
-    WAYLAND
+    WAYLAND,
+    NONE // headless: no surface and no swapchain, offscreen rendering only
 };
 struct NativeWindow {
     WindowSystem type;
@@ -353,6 +404,13 @@ struct InitDesc {
     // vulkan only
     const char** instanceExtensions;
     uint32_t     extensionCount;
+    // Size of each load-time staging chunk; initial data is submitted whenever
+    // a chunk fills. 0 => 64 MB
+    uint32_t uploadChunkBytes = 0;
+    // Compiled pipeline cache, loaded at init when it matches this GPU and
+    // driver, written back at shutdown and by SavePipelineCache.
+    // nullptr => the cache lives only for the session
+    const char* pipelineCachePath = nullptr;
 };
 
 enum class TextureType {
@@ -457,10 +515,30 @@ enum class Format : uint16_t {
     RGBA32_SFLOAT,
     D24_UNORM_S8_UINT,
     D32_SFLOAT,
+    BC1_RGB_UNORM,
+    BC1_RGB_SRGB,
     BC1_RGBA_UNORM,
     BC1_RGBA_SRGB,
     BC3_UNORM,
     BC3_SRGB,
+    BC4_UNORM,
+    BC4_SNORM,
+    BC5_UNORM,
+    BC5_SNORM,
+    BC6H_UFLOAT,
+    BC6H_SFLOAT,
+    BC7_UNORM,
+    BC7_SRGB,
+    ETC2_RGB8_UNORM,
+    ETC2_RGB8_SRGB,
+    ETC2_RGBA8_UNORM,
+    ETC2_RGBA8_SRGB,
+    ASTC_4x4_UNORM,
+    ASTC_4x4_SRGB,
+    ASTC_6x6_UNORM,
+    ASTC_6x6_SRGB,
+    ASTC_8x8_UNORM,
+    ASTC_8x8_SRGB,
 
     // Index Types
     //@note Do not use this format , for buffers creation
@@ -471,6 +549,94 @@ enum class Format : uint16_t {
     UINT16
 };
 
+// Texel block layout of a format. Uncompressed formats are 1x1 blocks.
+struct FormatBlockInfo {
+    uint32_t width  = 1;
+    uint32_t height = 1;
+    uint32_t bytes  = 0; // per block; 0 for UNDEFINED and index types
+};
+
+inline FormatBlockInfo GetFormatBlockInfo(Format format) {
+    switch (format) {
+    case Format::R8_UNORM:
+        return {1, 1, 1};
+    case Format::RG8_UNORM:
+    case Format::R16_SFLOAT:
+        return {1, 1, 2};
+    case Format::RGBA8_UNORM:
+    case Format::RGBA8_SRGB:
+    case Format::BGRA8_UNORM:
+    case Format::BGRA8_SRGB:
+    case Format::RG16_SFLOAT:
+    case Format::R32_SFLOAT:
+    case Format::D24_UNORM_S8_UINT:
+    case Format::D32_SFLOAT:
+        return {1, 1, 4};
+    case Format::RGBA16_SFLOAT:
+    case Format::RG32_SFLOAT:
+        return {1, 1, 8};
+    case Format::RGB32_SFLOAT:
+        return {1, 1, 12};
+    case Format::RGBA32_SFLOAT:
+        return {1, 1, 16};
+    case Format::BC1_RGB_UNORM:
+    case Format::BC1_RGB_SRGB:
+    case Format::BC1_RGBA_UNORM:
+    case Format::BC1_RGBA_SRGB:
+    case Format::BC4_UNORM:
+    case Format::BC4_SNORM:
+    case Format::ETC2_RGB8_UNORM:
+    case Format::ETC2_RGB8_SRGB:
+        return {4, 4, 8};
+    case Format::BC3_UNORM:
+    case Format::BC3_SRGB:
+    case Format::BC5_UNORM:
+    case Format::BC5_SNORM:
+    case Format::BC6H_UFLOAT:
+    case Format::BC6H_SFLOAT:
+    case Format::BC7_UNORM:
+    case Format::BC7_SRGB:
+    case Format::ETC2_RGBA8_UNORM:
+    case Format::ETC2_RGBA8_SRGB:
+    case Format::ASTC_4x4_UNORM:
+    case Format::ASTC_4x4_SRGB:
+        return {4, 4, 16};
+    case Format::ASTC_6x6_UNORM:
+    case Format::ASTC_6x6_SRGB:
+        return {6, 6, 16};
+    case Format::ASTC_8x8_UNORM:
+    case Format::ASTC_8x8_SRGB:
+        return {8, 8, 16};
+    default:
+        return {1, 1, 0};
+    }
+}
+
+inline bool IsCompressedFormat(Format format) {
+    return GetFormatBlockInfo(format).width > 1;
+}
+
+// Bytes of one tightly packed width x height x depth image of `format`
+inline uint64_t GetImageByteSize(Format format, uint32_t width, uint32_t height, uint32_t depth = 1) {
+    const FormatBlockInfo block = GetFormatBlockInfo(format);
+    const uint64_t        cols  = ((width ? width : 1) + block.width - 1) / block.width;
+    const uint64_t        rows  = ((height ? height : 1) + block.height - 1) / block.height;
+    return cols * rows * (depth ? depth : 1) * block.bytes;
+}
+
+// What the active device can do with a format in optimal tiling
+enum class FormatFeature : uint16_t {
+    NONE          = 0,
+    SAMPLED       = 1 << 0,
+    FILTER_LINEAR = 1 << 1,
+    STORAGE       = 1 << 2,
+    RENDER_TARGET = 1 << 3,
+    BLEND         = 1 << 4,
+    DEPTH_STENCIL = 1 << 5,
+    BLIT          = 1 << 6, // source and destination of blits, so generateMips works
+};
+ENABLE_BITMASK_OPERATORS(FormatFeature)
+
 enum class Filter {
     NEAREST,
     LINEAR,
@@ -503,9 +669,21 @@ enum class ResourceType : uint8_t {
     TEXTURE_UAV,              /// Read-write texture (storage image)
     SAMPLER,                  /// Sampler state object
     COMBINED_TEXTURE_SAMPLER, /// Combined (GL-style convenience)
-    ACCELERATION_STRUCTURE    /// Ray tracing TLAS/BLAS
+    ACCELERATION_STRUCTURE,   /// Ray tracing TLAS/BLAS
+    DYNAMIC_CONSTANT_BUFFER,  /// Constant buffer window moved by CommandList::setDynamicOffset
+    DYNAMIC_STORAGE_BUFFER    /// Read-write SSBO window moved by CommandList::setDynamicOffset
 };
 
+inline bool IsBufferResource(ResourceType type) {
+    return type == ResourceType::CONSTANT_BUFFER || type == ResourceType::STORAGE_BUFFER ||
+           type == ResourceType::RW_STORAGE_BUFFER || type == ResourceType::DYNAMIC_CONSTANT_BUFFER ||
+           type == ResourceType::DYNAMIC_STORAGE_BUFFER;
+}
+
+inline bool IsDynamicResource(ResourceType type) {
+    return type == ResourceType::DYNAMIC_CONSTANT_BUFFER || type == ResourceType::DYNAMIC_STORAGE_BUFFER;
+}
+
 /// @brief
 enum class PipelineStage : uint16_t {
     NONE = 0,
@@ -1246,6 +1424,9 @@ struct BufferViewDesc {
     uint64_t     range     = 0; // 0 = whole buffer (VK_WHOLE_SIZE equivalent)
     const char*  debugName = nullptr;
 
+    // Also write the view into this table as a storage buffer
+    BindlessTableHandle bindlessTable;
+
     BufferViewDesc() = default;
 
     explicit BufferViewDesc(BufferHandle buf)
@@ -1263,6 +1444,10 @@ struct BufferViewDesc {
         debugName = name;
         return *this;
     }
+    BufferViewDesc& setBindless(BindlessTableHandle table) {
+        bindlessTable = table;
+        return *this;
+    }
 
     // View the entire buffer from offset 0
     static BufferViewDesc WholeBuffer(BufferHandle buf) { return BufferViewDesc(buf); }
@@ -1306,6 +1491,9 @@ struct SamplerDesc {
     // Unnormalized coordinates — rarely needed, mostly for pixel-exact lookups
     bool unnormalizedCoords = false;
 
+    // Also write the sampler into this table
+    BindlessTableHandle bindlessTable;
+
     const char* debugName = nullptr;
 
     SamplerDesc& setFilter(Filter min, Filter mag) {
@@ -1357,6 +1545,10 @@ struct SamplerDesc {
         debugName = name;
         return *this;
     }
+    SamplerDesc& setBindless(BindlessTableHandle table) {
+        bindlessTable = table;
+        return *this;
+    }
 
     // Trilinear + repeat — good default for most scene textures
     static SamplerDesc Trilinear() {
@@ -1502,6 +1694,8 @@ struct TextureDesc {
         return *this;
     }
 
+    // Blits the full mip chain from initialData at the next FlushUploads;
+    // requires initialData
     TextureDesc& setGeneratedMips() {
         generateMips = true;
         return *this;
@@ -1525,6 +1719,8 @@ struct TextureDesc {
 };
 
 struct TextureViewDesc {
+    static constexpr uint32_t ALL_MIPS = UINT32_MAX; // every level from baseMipLevel on
+
     TextureHandle texture;
     TextureType   viewType = TextureType::TEXTURE_2D;
     Format        format   = Format::UNDEFINED;
@@ -1534,6 +1730,10 @@ struct TextureViewDesc {
     uint32_t      arrayLayerCount;
     const char*   debugName;
 
+    // Also write the view into this table, as TEXTURE_SRV or TEXTURE_UAV
+    BindlessTableHandle bindlessTable;
+    ResourceType        bindlessType = ResourceType::TEXTURE_SRV;
+
     TextureViewDesc& setViewType(TextureType type) {
         viewType = type;
         return *this;
@@ -1556,6 +1756,11 @@ struct TextureViewDesc {
         debugName = name;
         return *this;
     }
+    TextureViewDesc& setBindless(BindlessTableHandle table, ResourceType type = ResourceType::TEXTURE_SRV) {
+        bindlessTable = table;
+        bindlessType  = type;
+        return *this;
+    }
 
     TextureViewDesc()
         : baseMipLevel(0),
@@ -2347,6 +2552,22 @@ struct Binding {
         b.stages = s;
         return b;
     }
+    // The written view is a window (its range) into a larger buffer; each
+    // setDynamicOffset moves the window without touching the set
+    static Binding DynamicConstantBuffer(uint32_t slot, PipelineStage s = PipelineStage::ALL_GRAPHICS) {
+        Binding b;
+        b.slot   = slot;
+        b.type   = ResourceType::DYNAMIC_CONSTANT_BUFFER;
+        b.stages = s;
+        return b;
+    }
+    static Binding DynamicStorageBuffer(uint32_t slot, PipelineStage s = PipelineStage::ALL_GRAPHICS) {
+        Binding b;
+        b.slot   = slot;
+        b.type   = ResourceType::DYNAMIC_STORAGE_BUFFER;
+        b.stages = s;
+        return b;
+    }
     static Binding Texture(uint32_t slot, PipelineStage s = PipelineStage::ALL_GRAPHICS) {
         Binding b;
         b.slot   = slot;
@@ -2404,11 +2625,29 @@ struct SetLayoutDesc {
     uint32_t    count     = 0;
     const char* debugName = nullptr;
 
+    // Sets of this layout live in a DescriptorHeap (DESCRIPTOR_BUFFER pools
+    // only). Requires DescriptorCaps::descriptorBuffer.
+    bool descriptorBuffer = false;
+
+    // Sets of this layout are never allocated: CommandList::pushDescriptor and
+    // setInlineCBV/SRV/UAV record its bindings straight into the command
+    // list. At most one per pipeline layout, and no bindless bindings. Native
+    // when DescriptorCaps::pushDescriptors, emulated with per-list sets otherwise.
+    bool pushDescriptor = false;
+
     SetLayoutDesc& add(const Binding& b) {
         RENDERX_ASSERT_MSG(count < MAX_BINDINGS, "LayoutDesc: exceeded MAX_BINDINGS ({})", MAX_BINDINGS);
         bindings[count++] = b;
         return *this;
     }
+    SetLayoutDesc& setDescriptorBuffer(bool enable = true) {
+        descriptorBuffer = enable;
+        return *this;
+    }
+    SetLayoutDesc& setPushDescriptor(bool enable = true) {
+        pushDescriptor = enable;
+        return *this;
+    }
     SetLayoutDesc& setDebugName(const char* n) {
         debugName = n;
         return *this;
@@ -2469,7 +2708,9 @@ ENABLE_BITMASK_OPERATORS(DescriptorPoolFlags)
  *   MANUAL         → capacity = byte capacity.
  *Descriptor path requirements:
  *  DESCRIPTOR_SETS:
- *       - layout must be valid.
+ *       - layout should be valid: the pool reserves capacity sets of
+ *         exactly that layout. Without one it reserves capacity
+ *         descriptors of every type.
  *       - heap and heapOffset are ignored.
  *  DESCRIPTOR_BUFFER:
  *       - heap must be valid.
@@ -2494,6 +2735,11 @@ struct DescriptorPoolDesc {
     // Ignored for paths that do not support it.
     bool updateAfterBind = false;
 
+    // Chains another block of `capacity` sets whenever the pool runs out
+    // instead of failing the allocation; a reset keeps the grown blocks.
+    // Blocks are sized from `layout`, so give the layout the sets use.
+    bool growable = false;
+
     // ---- DESCRIPTOR_BUFFER specific ----
 
     // Descriptor heap backing this pool.
@@ -2563,6 +2809,10 @@ struct DescriptorPoolDesc {
         debugName = n;
         return *this;
     }
+    DescriptorPoolDesc& setGrowable(bool enable = true) {
+        growable = enable;
+        return *this;
+    }
 };
 
 // -----Heap: raw GPU descriptor memory (for DESCRIPTOR_BUFFER path)------------------------
@@ -2627,33 +2877,207 @@ struct DescriptorCopy {
     uint32_t  dstFirstElement = 0;
 };
 
+// Writes `count` consecutive array elements of a binding, starting at
+// `arrayElement`. With `handles` null every element gets `handle` (and
+// `sampler`); otherwise `handles` holds one raw id per element, or a view id
+// followed by a sampler id per element for COMBINED_TEXTURE_SAMPLER — the same
+// layout WriteSetPacked reads. `handles` is only read during the call.
+//
+//   Rx::DescriptorWrite w = Rx::DescriptorWrite::TextureArray(0, views.data(), (uint32_t)views.size());
+//   Rx::WriteSet(bindlessSet, &w, 1); // one update for the whole table
 struct DescriptorWrite {
-    uint32_t     slot    = 0;
-    ResourceType type    = ResourceType::CONSTANT_BUFFER;
-    uint8_t      _pad[3] = {};
-    uint64_t     handle  = 0; // raw handle id
+    uint32_t        slot         = 0;
+    ResourceType    type         = ResourceType::CONSTANT_BUFFER;
+    uint8_t         _pad[3]      = {};
+    uint64_t        handle       = 0; // raw handle id
+    uint64_t        sampler      = 0; // COMBINED_TEXTURE_SAMPLER: raw SamplerHandle id
+    uint32_t        arrayElement = 0;
+    uint32_t        count        = 1;
+    const uint64_t* handles      = nullptr;
 
     static DescriptorWrite CBV(uint32_t slot, BufferViewHandle h) { return {slot, ResourceType::CONSTANT_BUFFER, {}, h.id}; }
     static DescriptorWrite StorageBuf(uint32_t slot, BufferViewHandle h, bool writable = false) {
         return {slot, writable ? ResourceType::RW_STORAGE_BUFFER : ResourceType::STORAGE_BUFFER, {}, h.id};
     }
+    // `h` must have an explicit range: the size of one window
+    static DescriptorWrite DynamicCBV(uint32_t slot, BufferViewHandle h) {
+        return {slot, ResourceType::DYNAMIC_CONSTANT_BUFFER, {}, h.id};
+    }
+    static DescriptorWrite DynamicStorageBuf(uint32_t slot, BufferViewHandle h) {
+        return {slot, ResourceType::DYNAMIC_STORAGE_BUFFER, {}, h.id};
+    }
     static DescriptorWrite Texture(uint32_t slot, TextureViewHandle h) { return {slot, ResourceType::TEXTURE_SRV, {}, h.id}; }
     static DescriptorWrite StorageTexture(uint32_t slot, TextureViewHandle h) {
         return {slot, ResourceType::TEXTURE_UAV, {}, h.id};
     }
     static DescriptorWrite Sampler(uint32_t slot, SamplerHandle h) { return {slot, ResourceType::SAMPLER, {}, h.id}; }
     static DescriptorWrite CombinedTextureSampler(uint32_t slot, TextureViewHandle tex, SamplerHandle samp) {
-        // Pack both handles — backend unpacks based on type
-        // Use tex.id as primary, samp.id as secondary
-        // Backend must handle COMBINED_TEXTURE_SAMPLER specially
-        return {slot, ResourceType::COMBINED_TEXTURE_SAMPLER, {}, tex.id};
+        return {slot, ResourceType::COMBINED_TEXTURE_SAMPLER, {}, tex.id, samp.id};
+    }
+
+    // Array writes over a contiguous range of handles
+    static DescriptorWrite TextureArray(uint32_t slot, const TextureViewHandle* views, uint32_t count, uint32_t first = 0) {
+        return Array(slot, ResourceType::TEXTURE_SRV, views, count, first);
+    }
+    static DescriptorWrite StorageBufArray(uint32_t slot, const BufferViewHandle* views, uint32_t count, uint32_t first = 0) {
+        return Array(slot, ResourceType::STORAGE_BUFFER, views, count, first);
+    }
+    static DescriptorWrite CBVArray(uint32_t slot, const BufferViewHandle* views, uint32_t count, uint32_t first = 0) {
+        return Array(slot, ResourceType::CONSTANT_BUFFER, views, count, first);
+    }
+    static DescriptorWrite SamplerArray(uint32_t slot, const SamplerHandle* samplers, uint32_t count, uint32_t first = 0) {
+        return Array(slot, ResourceType::SAMPLER, samplers, count, first);
     }
-};
 
-// TODO-----------------------------------------------------------
-// Bindless
-struct DescriptorTable {};
-//---------------------------------------------------------------
+    DescriptorWrite& setArrayElement(uint32_t element) {
+        arrayElement = element;
+        return *this;
+    }
+
+    // Number of raw ids this write reads from `handles`
+    uint32_t handleCount() const { return type == ResourceType::COMBINED_TEXTURE_SAMPLER ? count * 2 : count; }
+
+    // Raw ids of element `e`, counted from `arrayElement`
+    uint64_t handleAt(uint32_t e) const {
+        return handles ? handles[type == ResourceType::COMBINED_TEXTURE_SAMPLER ? e * 2 : e] : handle;
+    }
+    uint64_t samplerAt(uint32_t e) const { return handles ? handles[e * 2 + 1] : sampler; } // combined only
+
+private:
+    template <typename H>
+    static DescriptorWrite Array(uint32_t slot, ResourceType type, const H* items, uint32_t count, uint32_t first) {
+        static_assert(sizeof(H) == sizeof(uint64_t), "handles are read as raw ids");
+        DescriptorWrite w{slot, type};
+        w.arrayElement = first;
+        w.count        = count;
+        w.handles      = reinterpret_cast<const uint64_t*>(items);
+        return w;
+    }
+};
+
+// Splits writes into one single-descriptor write per array element, with the
+// ids copied out of `handles`, for callers that keep writes beyond the call
+// (capture, set caches, recorded command streams). Appends to `out`.
+inline void ExpandDescriptorWrites(const DescriptorWrite* writes, uint32_t writeCount, std::vector<DescriptorWrite>& out) {
+    for (uint32_t i = 0; i < writeCount; i++) {
+        const DescriptorWrite& w = writes[i];
+        for (uint32_t e = 0; e < w.count; e++) {
+            DescriptorWrite single = w;
+            single.handle          = w.handleAt(e);
+            single.sampler         = w.type == ResourceType::COMBINED_TEXTURE_SAMPLER ? w.samplerAt(e) : 0;
+            single.arrayElement    = w.arrayElement + e;
+            single.count           = 1;
+            single.handles         = nullptr;
+            out.push_back(single);
+        }
+    }
+}
+
+// -----Packed writes-----------------------------------------------------------------------
+// WriteSetPacked rewrites every binding of a set from one flat array of raw
+// handle ids instead of a DescriptorWrite list. The ids follow the bindings in
+// the order they were added to the SetLayoutDesc, `count` ids per binding:
+// BufferViewHandle ids for buffers, TextureViewHandle ids for textures,
+// SamplerHandle ids for samplers, and a view id followed by a sampler id for
+// each COMBINED_TEXTURE_SAMPLER descriptor.
+//
+//   struct ObjectSet { uint64_t camera, albedo, sampler; }; // CBV, texture, sampler
+//   ObjectSet ids{cameraView.id, albedoView.id, sampler.id};
+//   Rx::WriteSetPacked(set, &ids);
+//
+// On Vulkan the layout precomputes a descriptor update template, so a packed
+// write is one vkUpdateDescriptorSetWithTemplate; each id is still resolved to
+// its Vulkan handle, but no VkWriteDescriptorSet is built. An invalid id is
+// reported and leaves the set unchanged. Layouts with unbounded (bindless)
+// bindings cannot be written packed.
+
+// Number of uint64_t ids WriteSetPacked reads for a set of this layout
+inline uint32_t GetPackedDescriptorCount(const SetLayoutDesc& desc) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < desc.count; i++) {
+        const Binding& b = desc.bindings[i];
+        count += b.type == ResourceType::COMBINED_TEXTURE_SAMPLER ? b.count * 2 : b.count;
+    }
+    return count;
+}
+
+// Expands packed ids into one DescriptorWrite per binding, for paths that
+// only take DescriptorWrites. The writes point into `data`, which must outlive
+// them. `out` needs room for desc.count writes; returns the number written.
+inline uint32_t UnpackDescriptorWrites(const SetLayoutDesc& desc, const void* data, DescriptorWrite* out) {
+    const uint64_t* ids = static_cast<const uint64_t*>(data);
+    for (uint32_t i = 0; i < desc.count; i++) {
+        const Binding& b = desc.bindings[i];
+        out[i]           = {b.slot, b.type};
+        out[i].count     = b.count;
+        out[i].handles   = ids;
+        ids += out[i].handleCount();
+    }
+    return desc.count;
+}
+
+// -----Cached sets-------------------------------------------------------------------------
+// AllocateCachedSet returns a set holding exactly `writes`, shared by every
+// caller asking for the same layout and writes (in the same order). A hit is
+// one hash lookup: no allocation, no descriptor writes.
+//
+//   SetHandle set = Rx::AllocateCachedSet(pool, materialLayout, writes, 5);
+//   cmd->setDescriptorSet(1, set);
+//
+// The set belongs to the cache — never write to it or free it. `pool` must
+// use the POOL policy; it only matters on a miss. Ask for the set every
+// frame it is bound: TrimSetCache, called once per frame (FrameContext does
+// it when FrameContextDesc::cachedSetLifetime is set), frees sets nobody
+// asked for in the last `maxFrameAge` frames. Destroying a view or sampler
+// drops every cached set that references it. Sets are freed only after the
+// GPU is done with them.
+
+// -----Bindless table---------------------------------------------------------------------
+// One global descriptor set with a large array per resource class. Views and
+// samplers created with setBindless(table) are written into it once and keep
+// a stable index for their lifetime, so shaders reach them by index instead of
+// through per-draw sets:
+//
+//   layout(set = 1, binding = 0) uniform texture2D textures[];
+//   texture(sampler2D(textures[nonuniformEXT(material.albedo)], samp), uv)
+//
+// Put GetBindlessSetLayout(table) into the pipeline layout at setIndex and
+// bind the table with setBindlessTable after setPipeline. A destroyed
+// resource's index is reused only after the GPU has finished with it.
+struct BindlessTableDesc {
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    // Fixed bindings of the table's set layout
+    static constexpr uint32_t TEXTURE_BINDING         = 0; // TEXTURE_SRV
+    static constexpr uint32_t SAMPLER_BINDING         = 1; // SAMPLER
+    static constexpr uint32_t BUFFER_BINDING          = 2; // STORAGE_BUFFER / RW_STORAGE_BUFFER
+    static constexpr uint32_t STORAGE_TEXTURE_BINDING = 3; // TEXTURE_UAV
+    static constexpr uint32_t BINDING_COUNT           = 4;
+
+    // Array sizes; clamped to the device's update-after-bind limits
+    uint32_t    maxTextures        = 16384;
+    uint32_t    maxSamplers        = 256;
+    uint32_t    maxBuffers         = 16384;
+    uint32_t    maxStorageTextures = 1024;
+    uint32_t    setIndex           = 0; // set slot setBindlessTable binds to
+    const char* debugName          = nullptr;
+
+    BindlessTableDesc& setCapacity(uint32_t textures, uint32_t samplers, uint32_t buffers, uint32_t storageTextures = 0) {
+        maxTextures        = textures;
+        maxSamplers        = samplers;
+        maxBuffers         = buffers;
+        maxStorageTextures = storageTextures;
+        return *this;
+    }
+    BindlessTableDesc& setSetIndex(uint32_t index) {
+        setIndex = index;
+        return *this;
+    }
+    BindlessTableDesc& setDebugName(const char* n) {
+        debugName = n;
+        return *this;
+    }
+};
 
 struct PushConstantRange {
     PipelineStage stages = PipelineStage::NONE;
@@ -2827,6 +3251,9 @@ public:
     // Skip descriptor table entirely — bind buffer by GPU address
     // VK:    VK_KHR_push_descriptor → vkCmdPushDescriptorSetKHR
     // D3D12: SetGraphicsRootConstantBufferView / SRV / UAV
+    // GL:    not supported; warns once and binds nothing
+    // `slot` is a binding of the bound pipeline's push descriptor set layout
+    // (SetLayoutDesc::setPushDescriptor); the buffer is bound from `offset` to its end.
     virtual void setDescriptorHeaps(DescriptorHeapHandle* heaps, uint32_t count)    = 0;
     virtual void setInlineCBV(uint32_t slot, BufferHandle buf, uint64_t offset = 0) = 0;
     virtual void setInlineSRV(uint32_t slot, BufferHandle buf, uint64_t offset = 0) = 0;
@@ -2840,12 +3267,24 @@ public:
     //---- Dynamic offset — change offset without full rebind --------------------------
     // VK:    vkCmdBindDescriptorSets with pDynamicOffsets
     // D3D12: SetGraphicsRootConstantBufferView at new offset
+    // GL:    not supported; warns once and binds nothing
+    // Rebinds the set last bound at `slot` with every DYNAMIC_* binding of it
+    // shifted by `byteOffset` (a multiple of the device's min uniform/storage
+    // buffer offset alignment). setDescriptorSet(s) starts a set at offset 0.
+    //
+    //   cmd->setDescriptorSet(1, objectSet); // DynamicCBV over one 256-byte block
+    //   for (uint32_t i = 0; i < objectCount; i++) {
+    //       cmd->setDynamicOffset(1, i * 256);
+    //       cmd->drawIndexed(...);
+    //   }
     virtual void setDynamicOffset(uint32_t slot, uint32_t byteOffset) = 0;
 
     //---- Push descriptor — writes into command stream ----------------------------------
-    // VK:    vkCmdPushDescriptorSetKHR (requires VK_KHR_push_descriptor)
-    //        Check Descriptor::Caps::pushDescriptors before using
+    // VK:    vkCmdPushDescriptorSetKHR (VK_KHR_push_descriptor); without the
+    //        extension, a set from the list's own linear pool
+    //        `slot` is the set index of a push descriptor set layout
     // D3D12: Falls back to inline root descriptor for buffers
+    // GL:    not supported; warns once and binds nothing
     virtual void pushDescriptor(uint32_t slot, const DescriptorWrite* writes, uint32_t count) = 0;
 
     void setViewport(int x, int y, int w, int h, float minDepth = 0.0f, float maxDepth = 1.0f) {
@@ -2874,13 +3313,89 @@ public:
     virtual void         Reset(CommandList* list) = 0;
     virtual void         Free(CommandList* list)  = 0;
     virtual void         Reset()                  = 0;
+
+    // Hands out `count` lists in one call. Backends that pool their lists
+    // override this to grow the pool with a single driver allocation.
+    virtual void AllocateMany(uint32_t count, CommandList** outLists) {
+        for (uint32_t i = 0; i < count; i++)
+            outLists[i] = Allocate();
+    }
+};
+// Small-buffer list used by submit descriptors. The first N entries live
+// inline; only once those run out does the list spill into a std::vector
+// (kept for the lifetime of the list), so the common submit path never
+// touches the heap.
+template <typename T, uint32_t N>
+class InlineList {
+public:
+    InlineList() = default;
+
+    void push_back(const T& value) {
+        if (m_Size < N) {
+            m_Inline[m_Size++] = value;
+            return;
+        }
+        if (m_Size == N) {
+            m_Overflow.reserve(N * 2);
+            m_Overflow.assign(m_Inline, m_Inline + N);
+        }
+        m_Overflow.push_back(value);
+        ++m_Size;
+    }
+
+    void clear() {
+        m_Size = 0;
+        m_Overflow.clear();
+    }
+
+    uint32_t size() const { return m_Size; }
+    bool     empty() const { return m_Size == 0; }
+    bool     spilled() const { return m_Size > N; }
+
+    const T* data() const { return spilled() ? m_Overflow.data() : m_Inline; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + m_Size; }
+    const T& operator[](uint32_t i) const { return data()[i]; }
+
+private:
+    T              m_Inline[N]{};
+    uint32_t       m_Size = 0;
+    std::vector<T> m_Overflow;
 };
+
+// A semaphore owned outside RenderX (interop, a second window's swapchain,
+// a video decoder, ...). nativeHandle is the backend object (VkSemaphore on
+// Vulkan). A value of 0 marks a binary semaphore, anything else is a
+// timeline value.
+struct ExternalSemaphore {
+    uint64_t      nativeHandle = 0;
+    uint64_t      value        = 0;
+    PipelineStage stage        = PipelineStage::NONE; // NONE => all commands
+
+    ExternalSemaphore() = default;
+    ExternalSemaphore(uint64_t handle, uint64_t v = 0, PipelineStage s = PipelineStage::NONE)
+        : nativeHandle(handle),
+          value(v),
+          stage(s) {}
+
+    static ExternalSemaphore Binary(uint64_t handle, PipelineStage s = PipelineStage::NONE) { return {handle, 0, s}; }
+    static ExternalSemaphore TimelinePoint(uint64_t handle, uint64_t v, PipelineStage s = PipelineStage::NONE) {
+        return {handle, v, s};
+    }
+};
+
 // Command List Submission
 struct SubmitInfo {
-    CommandList*                 commandList       = nullptr;
-    uint32_t                     commandListCount  = 0;
-    bool                         writesToSwapchain = false;
-    std::vector<QueueDependency> waitDependencies;
+    static constexpr uint32_t INLINE_WAITS   = 4;
+    static constexpr uint32_t INLINE_SIGNALS = 2;
+
+    CommandList* commandList       = nullptr;
+    uint32_t     commandListCount  = 0;
+    bool         writesToSwapchain = false;
+
+    InlineList<QueueDependency, INLINE_WAITS>     waitDependencies;
+    InlineList<ExternalSemaphore, INLINE_WAITS>   waitSemaphores;
+    InlineList<ExternalSemaphore, INLINE_SIGNALS> signalSemaphores;
 
     SubmitInfo() = default;
 
@@ -2899,6 +3414,16 @@ struct SubmitInfo {
         waitDependencies.push_back(dep);
         return *this;
     }
+
+    SubmitInfo& addWait(const ExternalSemaphore& semaphore) {
+        waitSemaphores.push_back(semaphore);
+        return *this;
+    }
+
+    SubmitInfo& addSignal(const ExternalSemaphore& semaphore) {
+        signalSemaphores.push_back(semaphore);
+        return *this;
+    }
 };
 
 // Queue Capabilities
@@ -2985,4 +3510,252 @@ public:
     virtual TextureViewHandle GetDepthView(uint32_t imageindex) const = 0;
 };
 
-} // namespace Rx
\ No newline at end of file
+// Transient constants
+// One persistently mapped buffer split into a region per frame in flight.
+// allocate() is a bump of an atomic head inside the current region, so
+// per-draw constants cost a pointer increment instead of a buffer, a view and
+// a descriptor set. Bind the buffer once with a dynamic-offset binding and pass
+// the allocation's offset per draw. A region is reused only after the Timeline
+// handed to EndFrame() has completed, along with every compute and transfer
+// submit issued before that EndFrame().
+struct TransientAllocation {
+    void*        cpuPtr = nullptr;
+    BufferHandle buffer;
+    uint64_t     offset = 0;
+    uint64_t     size   = 0;
+
+    bool isValid() const { return cpuPtr != nullptr; }
+};
+
+struct TransientAllocatorDesc {
+    uint64_t    bytesPerFrame  = 4 * 1024 * 1024;
+    uint32_t    framesInFlight = 2;
+    BufferFlags usage          = BufferFlags::UNIFORM | BufferFlags::STORAGE;
+    const char* debugName      = nullptr;
+
+    TransientAllocatorDesc& setBytesPerFrame(uint64_t bytes) {
+        bytesPerFrame = bytes;
+        return *this;
+    }
+    TransientAllocatorDesc& setFramesInFlight(uint32_t count) {
+        framesInFlight = count;
+        return *this;
+    }
+    TransientAllocatorDesc& setUsage(BufferFlags flags) {
+        usage = flags;
+        return *this;
+    }
+    TransientAllocatorDesc& setDebugName(const char* name) {
+        debugName = name;
+        return *this;
+    }
+};
+
+class RENDERX_EXPORT TransientAllocator {
+public:
+    virtual ~TransientAllocator() = default;
+
+    // alignment 0 => the device's minimum offset alignment for the buffer's
+    // usage. Returns an invalid allocation when the frame's region is full.
+    virtual TransientAllocation allocate(uint64_t size, uint64_t alignment = 0) = 0;
+
+    // Moves to the next region, waiting for its previous frame if necessary
+    virtual void BeginFrame() = 0;
+    // Marks the current region in use until `lastUse` and the compute and
+    // transfer work submitted so far complete
+    virtual void EndFrame(Timeline lastUse) = 0;
+
+    virtual BufferHandle GetBuffer() const        = 0;
+    virtual uint64_t     GetBytesPerFrame() const = 0;
+    virtual uint64_t     GetUsedBytes() const     = 0;
+
+    // Allocates and copies `data` in one go
+    TransientAllocation push(const void* data, uint64_t size, uint64_t alignment = 0) {
+        TransientAllocation a = allocate(size, alignment);
+        if (a.isValid())
+            std::memcpy(a.cpuPtr, data, size);
+        return a;
+    }
+    template <typename T> TransientAllocation push(const T& value) { return push(&value, sizeof(T)); }
+};
+
+// Geometry pool
+// One large vertex buffer and one large index buffer shared by many meshes.
+// Ranges are sub-allocated with a TLSF allocator in units of vertices and
+// indices, so a mesh is drawn with the pool bound once and
+// drawIndexed(indexCount, vertexOffset, 1, firstIndex). Uploads go through the
+// load-time staging path and are visible after FlushUploads(). Freed ranges are
+// reused only once the graphics queue has finished every submission made
+// before the free.
+struct GeometryAllocation {
+    uint32_t firstIndex   = 0;
+    int32_t  vertexOffset = 0;
+    uint32_t indexCount   = 0;
+    uint32_t vertexCount  = 0;
+
+    // Backend range handles; opaque
+    uint64_t vertexRange = 0;
+    uint64_t indexRange  = 0;
+
+    bool isValid() const { return vertexRange != 0; }
+};
+
+struct GeometryPoolDesc {
+    uint32_t    vertexStride = 0;
+    uint32_t    maxVertices  = 4 * 1024 * 1024;
+    uint32_t    maxIndices   = 16 * 1024 * 1024;
+    Format      indexFormat  = Format::UINT32; // UINT16 or UINT32
+    const char* debugName    = nullptr;
+
+    GeometryPoolDesc(uint32_t stride = 0)
+        : vertexStride(stride) {}
+
+    GeometryPoolDesc& setVertexStride(uint32_t stride) {
+        vertexStride = stride;
+        return *this;
+    }
+    GeometryPoolDesc& setMaxVertices(uint32_t count) {
+        maxVertices = count;
+        return *this;
+    }
+    GeometryPoolDesc& setMaxIndices(uint32_t count) {
+        maxIndices = count;
+        return *this;
+    }
+    GeometryPoolDesc& setIndexFormat(Format format) {
+        indexFormat = format;
+        return *this;
+    }
+    GeometryPoolDesc& setDebugName(const char* name) {
+        debugName = name;
+        return *this;
+    }
+};
+
+class RENDERX_EXPORT GeometryPool {
+public:
+    virtual ~GeometryPool() = default;
+
+    // Reserves vertex and index ranges. Returns an invalid allocation when
+    // either buffer has no free range large enough. Thread-safe.
+    virtual GeometryAllocation allocate(uint32_t vertexCount, uint32_t indexCount) = 0;
+
+    // Queues `vertices` (vertexCount * stride bytes) and `indices` for upload
+    // into the allocation's ranges; either may be nullptr
+    virtual void upload(const GeometryAllocation& allocation, const void* vertices, const void* indices) = 0;
+
+    // Returns the ranges to the pool once in-flight draws are done with them
+    virtual void free(GeometryAllocation& allocation) = 0;
+
+    virtual BufferHandle GetVertexBuffer() const = 0;
+    virtual BufferHandle GetIndexBuffer() const  = 0;
+    virtual uint32_t     GetVertexStride() const = 0;
+    virtual Format       GetIndexFormat() const  = 0;
+    // Element counts currently allocated, not bytes
+    virtual uint32_t     GetUsedVertices() const = 0;
+    virtual uint32_t     GetUsedIndices() const  = 0;
+
+    // Allocates and uploads in one go
+    GeometryAllocation push(const void* vertices, uint32_t vertexCount, const void* indices, uint32_t indexCount) {
+        GeometryAllocation a = allocate(vertexCount, indexCount);
+        if (a.isValid())
+            upload(a, vertices, indices);
+        return a;
+    }
+
+    // Binds the shared vertex and index buffers
+    void bind(CommandList* cmd) const {
+        cmd->setVertexBuffer(GetVertexBuffer());
+        cmd->setIndexBuffer(GetIndexBuffer(), 0, GetIndexFormat());
+    }
+};
+
+// Frame pacing
+// A FrameContext owns N frames in flight. BeginFrame() blocks only until the
+// GPU has finished the oldest frame on every queue it submitted to (its
+// graphics timeline plus whatever compute and transfer work was submitted
+// before its EndFrame()), then recycles everything that frame used:
+// its command allocators, its linear descriptor pools, its transient constant
+// region, retired staging memory and resources whose destruction was
+// deferred. EndFrame() submits the frame's graphics list and presents.
+// Without a FrameContext, deferred destruction is reclaimed by
+// Swapchain::Present on the frame thread. OpenGL runs each submit to
+// completion, so its FrameContext never blocks and has no transient allocator.
+struct FrameContextDesc {
+    Swapchain* swapchain      = nullptr; // nullptr => headless, no acquire/present
+    uint32_t   framesInFlight = 2;
+    bool       useCompute     = false; // also create a compute allocator per frame
+
+    // One LINEAR pool per entry is created for every frame and reset on BeginFrame
+    std::vector<DescriptorPoolDesc> linearPools;
+
+    // Size of each frame's TransientAllocator region; 0 => no allocator
+    uint64_t transientBytes = 0;
+
+    // BeginFrame calls TrimSetCache(cachedSetLifetime); 0 => the app trims
+    uint32_t cachedSetLifetime = 0;
+
+    FrameContextDesc(Swapchain* sc = nullptr, uint32_t frames = 2)
+        : swapchain(sc),
+          framesInFlight(frames) {}
+
+    FrameContextDesc& setFramesInFlight(uint32_t count) {
+        framesInFlight = count;
+        return *this;
+    }
+
+    FrameContextDesc& setUseCompute(bool enable = true) {
+        useCompute = enable;
+        return *this;
+    }
+
+    FrameContextDesc& addLinearPool(const DescriptorPoolDesc& desc) {
+        linearPools.push_back(desc);
+        return *this;
+    }
+
+    FrameContextDesc& setTransientBytes(uint64_t bytesPerFrame) {
+        transientBytes = bytesPerFrame;
+        return *this;
+    }
+
+    FrameContextDesc& setCachedSetLifetime(uint32_t frames) {
+        cachedSetLifetime = frames;
+        return *this;
+    }
+};
+
+struct FrameInfo {
+    uint32_t            frameIndex        = 0; // slot in [0, framesInFlight)
+    uint64_t            frameNumber       = 0; // monotonically increasing
+    uint32_t            imageIndex        = 0; // acquired swapchain image
+    CommandList*        commandList       = nullptr; // graphics list, already open
+    CommandAllocator*   graphicsAllocator = nullptr; // for extra per-frame lists
+    CommandAllocator*   computeAllocator  = nullptr; // only with useCompute
+    TransientAllocator* transient         = nullptr; // only with transientBytes
+
+    const DescriptorPoolHandle* linearPools     = nullptr;
+    uint32_t                    linearPoolCount = 0;
+
+    DescriptorPoolHandle linearPool(uint32_t index = 0) const {
+        return index < linearPoolCount ? linearPools[index] : DescriptorPoolHandle{};
+    }
+};
+
+class RENDERX_EXPORT FrameContext {
+public:
+    virtual ~FrameContext() = default;
+
+    virtual const FrameInfo& BeginFrame() = 0;
+
+    // Closes and submits the frame's command list. Extra dependencies (e.g. a
+    // compute submit recorded from computeAllocator) are waited on by the
+    // graphics submit, so the frame's timeline covers them as well.
+    virtual Timeline EndFrame(const QueueDependency* waits = nullptr, uint32_t waitCount = 0) = 0;
+
+    virtual const FrameInfo& GetCurrentFrame() const                     = 0;
+    virtual uint32_t         GetFramesInFlight() const                   = 0;
+    virtual Timeline         GetFrameTimeline(uint32_t frameIndex) const = 0;
+};
+
+} // namespace Rx
@@ -0,0 +1,272 @@
+#include "RX_KTX2.h"
+#include "RenderX.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace Rx {
+
+namespace {
+
+constexpr uint8_t KTX2_IDENTIFIER[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+struct KTX2Header {
+    uint8_t  identifier[12];
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint32_t pixelWidth;
+    uint32_t pixelHeight;
+    uint32_t pixelDepth;
+    uint32_t layerCount;
+    uint32_t faceCount;
+    uint32_t levelCount;
+    uint32_t supercompressionScheme;
+    uint32_t dfdByteOffset;
+    uint32_t dfdByteLength;
+    uint32_t kvdByteOffset;
+    uint32_t kvdByteLength;
+    uint64_t sgdByteOffset;
+    uint64_t sgdByteLength;
+};
+static_assert(sizeof(KTX2Header) == 80);
+
+struct KTX2Level {
+    uint64_t byteOffset;
+    uint64_t byteLength;
+    uint64_t uncompressedByteLength;
+};
+
+// KTX2 stores a VkFormat value; mapped by number so the core does not depend
+// on Vulkan headers
+Format FormatFromVkFormat(uint32_t vkFormat) {
+    switch (vkFormat) {
+    case 9:
+        return Format::R8_UNORM;
+    case 16:
+        return Format::RG8_UNORM;
+    case 37:
+        return Format::RGBA8_UNORM;
+    case 43:
+        return Format::RGBA8_SRGB;
+    case 44:
+        return Format::BGRA8_UNORM;
+    case 50:
+        return Format::BGRA8_SRGB;
+    case 76:
+        return Format::R16_SFLOAT;
+    case 83:
+        return Format::RG16_SFLOAT;
+    case 97:
+        return Format::RGBA16_SFLOAT;
+    case 100:
+        return Format::R32_SFLOAT;
+    case 103:
+        return Format::RG32_SFLOAT;
+    case 106:
+        return Format::RGB32_SFLOAT;
+    case 109:
+        return Format::RGBA32_SFLOAT;
+    case 131:
+        return Format::BC1_RGB_UNORM;
+    case 132:
+        return Format::BC1_RGB_SRGB;
+    case 133:
+        return Format::BC1_RGBA_UNORM;
+    case 134:
+        return Format::BC1_RGBA_SRGB;
+    case 137:
+        return Format::BC3_UNORM;
+    case 138:
+        return Format::BC3_SRGB;
+    case 139:
+        return Format::BC4_UNORM;
+    case 140:
+        return Format::BC4_SNORM;
+    case 141:
+        return Format::BC5_UNORM;
+    case 142:
+        return Format::BC5_SNORM;
+    case 143:
+        return Format::BC6H_UFLOAT;
+    case 144:
+        return Format::BC6H_SFLOAT;
+    case 145:
+        return Format::BC7_UNORM;
+    case 146:
+        return Format::BC7_SRGB;
+    case 147:
+        return Format::ETC2_RGB8_UNORM;
+    case 148:
+        return Format::ETC2_RGB8_SRGB;
+    case 151:
+        return Format::ETC2_RGBA8_UNORM;
+    case 152:
+        return Format::ETC2_RGBA8_SRGB;
+    case 157:
+        return Format::ASTC_4x4_UNORM;
+    case 158:
+        return Format::ASTC_4x4_SRGB;
+    case 165:
+        return Format::ASTC_6x6_UNORM;
+    case 166:
+        return Format::ASTC_6x6_SRGB;
+    case 171:
+        return Format::ASTC_8x8_UNORM;
+    case 172:
+        return Format::ASTC_8x8_SRGB;
+    default:
+        return Format::UNDEFINED;
+    }
+}
+
+// [offset, offset + length) lies within `size` bytes, without the sum overflowing
+bool InBounds(uint64_t offset, uint64_t length, uint64_t size) {
+    return offset <= size && length <= size - offset;
+}
+
+bool ParseHeader(const void* data, size_t size, KTX2Header& header, KTX2Info& info) {
+    if (!data || size < sizeof(KTX2Header)) {
+        RENDERX_ERROR("KTX2: file is too small to hold a header");
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(KTX2Header));
+
+    if (std::memcmp(header.identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0) {
+        RENDERX_ERROR("KTX2: missing KTX 20 identifier");
+        return false;
+    }
+    if (header.supercompressionScheme != 0 || header.vkFormat == 0) {
+        RENDERX_ERROR("KTX2: supercompressed files (scheme {}) are not supported, transcode offline",
+                      header.supercompressionScheme);
+        return false;
+    }
+
+    info.format = FormatFromVkFormat(header.vkFormat);
+    if (info.format == Format::UNDEFINED) {
+        RENDERX_ERROR("KTX2: unsupported VkFormat {}", header.vkFormat);
+        return false;
+    }
+
+    if (header.pixelWidth == 0 || (header.faceCount != 1 && header.faceCount != 6)) {
+        RENDERX_ERROR("KTX2: invalid dimensions ({} wide, {} faces)", header.pixelWidth, header.faceCount);
+        return false;
+    }
+    // TextureType has no cube array; a cube would keep only the first layer
+    if (header.faceCount == 6 && header.layerCount > 0) {
+        RENDERX_ERROR("KTX2: cube map arrays ({} layers) are not supported", header.layerCount);
+        return false;
+    }
+
+    info.width       = header.pixelWidth;
+    info.height      = header.pixelHeight ? header.pixelHeight : 1;
+    info.depth       = header.pixelDepth ? header.pixelDepth : 1;
+    info.mipLevels   = header.levelCount ? header.levelCount : 1;
+    info.arrayLayers = (header.layerCount ? header.layerCount : 1) * header.faceCount;
+
+    if (header.faceCount == 6)
+        info.type = TextureType::TEXTURE_CUBE;
+    else if (header.pixelDepth > 0)
+        info.type = TextureType::TEXTURE_3D;
+    else if (header.layerCount > 0)
+        info.type = header.pixelHeight ? TextureType::TEXTURE_2D_ARRAY : TextureType::TEXTURE_1D_ARRAY;
+    else
+        info.type = header.pixelHeight ? TextureType::TEXTURE_2D : TextureType::TEXTURE_1D;
+
+    const uint64_t levelIndexEnd = sizeof(KTX2Header) + (uint64_t)info.mipLevels * sizeof(KTX2Level);
+    if (levelIndexEnd > size) {
+        RENDERX_ERROR("KTX2: truncated level index");
+        return false;
+    }
+
+    // Neither block is read here, but a file pointing them outside itself is corrupt
+    if (!InBounds(header.dfdByteOffset, header.dfdByteLength, size) ||
+        !InBounds(header.kvdByteOffset, header.kvdByteLength, size)) {
+        RENDERX_ERROR("KTX2: data format descriptor or key/value data lies outside the file");
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool ReadKTX2Info(const void* data, size_t size, KTX2Info& outInfo) {
+    KTX2Header header{};
+    return ParseHeader(data, size, header, outInfo);
+}
+
+TextureHandle LoadKTX2FromMemory(const void* data, size_t size, KTX2Info* outInfo, const char* debugName) {
+    KTX2Header header{};
+    KTX2Info   info{};
+    if (!ParseHeader(data, size, header, info))
+        return {};
+
+    if (!Has(GetFormatFeatures(info.format), FormatFeature::SAMPLED)) {
+        RENDERX_ERROR("LoadKTX2: format {} cannot be sampled on this device", (uint32_t)info.format);
+        return {};
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    // Validate every level before creating anything
+    std::vector<KTX2Level> levels(info.mipLevels);
+    std::memcpy(levels.data(), bytes + sizeof(KTX2Header), levels.size() * sizeof(KTX2Level));
+
+    for (uint32_t level = 0; level < info.mipLevels; level++) {
+        const uint32_t w        = std::max(1u, info.width >> level);
+        const uint32_t h        = std::max(1u, info.height >> level);
+        const uint32_t d        = std::max(1u, info.depth >> level);
+        const uint64_t expected = GetImageByteSize(info.format, w, h, d) * info.arrayLayers;
+
+        if (!InBounds(levels[level].byteOffset, levels[level].byteLength, size) || levels[level].byteLength < expected) {
+            RENDERX_ERROR("LoadKTX2: level {} is truncated ({} of {} bytes)", level, levels[level].byteLength, expected);
+            return {};
+        }
+    }
+
+    TextureDesc desc(info.width, info.height, info.format, info.type);
+    desc.depth       = info.depth;
+    desc.arrayLayers = info.arrayLayers;
+    desc.usage       = TextureUsage::SAMPLED | TextureUsage::TRANSFER_DST;
+    desc.setMips(info.mipLevels).setDebugName(debugName);
+
+    TextureHandle texture = CreateTexture(desc);
+    if (!texture.isValid())
+        return {};
+
+    // Each level holds its layers and faces back to back
+    for (uint32_t level = 0; level < info.mipLevels; level++) {
+        const uint32_t w         = std::max(1u, info.width >> level);
+        const uint32_t h         = std::max(1u, info.height >> level);
+        const uint32_t d         = std::max(1u, info.depth >> level);
+        const uint64_t imageSize = GetImageByteSize(info.format, w, h, d);
+
+        for (uint32_t layer = 0; layer < info.arrayLayers; layer++) {
+            TextureCopy region{};
+            region.setDstMip(level).setDstLayer(layer).setExtent(w, h, d);
+            UploadTexture(texture, bytes + levels[level].byteOffset + layer * imageSize, (uint32_t)imageSize, region);
+        }
+    }
+
+    if (outInfo)
+        *outInfo = info;
+    return texture;
+}
+
+TextureHandle LoadKTX2(const char* path, KTX2Info* outInfo, const char* debugName) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        RENDERX_ERROR("LoadKTX2: failed to open '{}'", path);
+        return {};
+    }
+
+    std::vector<uint8_t> bytes((size_t)file.tellg());
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(bytes.data()), (std::streamsize)bytes.size());
+
+    TextureHandle texture = LoadKTX2FromMemory(bytes.data(), bytes.size(), outInfo, debugName ? debugName : path);
+    if (!texture.isValid())
+        RENDERX_ERROR("LoadKTX2: '{}' could not be loaded", path);
+    return texture;
+}
+
+} // namespace Rx
@@ -0,0 +1,45 @@
+#pragma once
+#include "RX_Common.h"
+
+//------------------------------------------------------------------------------
+// KTX2 TEXTURES
+//------------------------------------------------------------------------------
+// Creates a texture from a KTX2 container and uploads every mip level, array
+// layer and cube face exactly as stored — block-compressed data (BC, ETC2,
+// ASTC) goes to the GPU without being decoded.
+//
+//   Rx::KTX2Info info;
+//   Rx::TextureHandle tex = Rx::LoadKTX2("assets/rock_albedo.ktx2", &info);
+//   ...
+//   Rx::GetGpuQueue(Rx::QueueType::TRANSFER)->Wait(Rx::SubmitUploads());
+//
+// Uploads are queued through Rx::UploadTexture, so the data is resident once
+// the Timeline returned by the next Rx::SubmitUploads() completes.
+//
+// Supercompressed files (BasisLZ, Zstandard) are rejected; transcode them
+// offline to a block format. Formats the device cannot sample are rejected
+// too — check Rx::GetFormatFeatures first to pick a fallback file.
+//------------------------------------------------------------------------------
+
+namespace Rx {
+
+struct KTX2Info {
+    Format      format      = Format::UNDEFINED;
+    TextureType type        = TextureType::TEXTURE_2D;
+    uint32_t    width       = 0;
+    uint32_t    height      = 0;
+    uint32_t    depth       = 0;
+    uint32_t    mipLevels   = 0;
+    uint32_t    arrayLayers = 0; // includes the six faces of a cubemap
+};
+
+// Reads only the header; no texture is created
+RENDERX_EXPORT bool ReadKTX2Info(const void* data, size_t size, KTX2Info& outInfo);
+
+RENDERX_EXPORT TextureHandle LoadKTX2(const char* path, KTX2Info* outInfo = nullptr, const char* debugName = nullptr);
+RENDERX_EXPORT TextureHandle LoadKTX2FromMemory(const void* data,
+                                                size_t      size,
+                                                KTX2Info*   outInfo   = nullptr,
+                                                const char* debugName = nullptr);
+
+} // namespace Rx
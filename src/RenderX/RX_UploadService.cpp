@@ -0,0 +1,207 @@
+#include "RX_UploadService.h"
+#include "RenderX.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace Rx {
+
+UploadService::UploadService(const UploadServiceDesc& desc)
+    : m_Desc(desc) {
+    if (m_Desc.bytesPerFrame == 0) {
+        RENDERX_WARN("UploadService: bytesPerFrame is 0, using 1 MB");
+        m_Desc.bytesPerFrame = 1024 * 1024;
+    }
+}
+
+void UploadService::enqueue(UploadPriority priority, Request&& request) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_QueuedBytes += request.data.size();
+    m_Queues[(size_t)priority].push_back(std::move(request));
+}
+
+void UploadService::UploadBuffer(
+    BufferHandle dst, const void* data, uint64_t size, uint64_t dstOffset, UploadPriority priority, UploadCallback onComplete) {
+    if (!dst.isValid() || !data || size == 0 || priority >= UploadPriority::COUNT) {
+        RENDERX_WARN("UploadService::UploadBuffer: invalid request ignored");
+        return;
+    }
+    // Rx::UploadBuffer takes 32-bit offsets; every piece must land below 4 GB
+    if (size > MAX_BUFFER_END || dstOffset > MAX_BUFFER_END - size) {
+        RENDERX_ERROR("UploadService::UploadBuffer: range [{}, +{}) ends past 4 GB", dstOffset, size);
+        return;
+    }
+
+    Request request;
+    request.buffer     = dst;
+    request.dstOffset  = dstOffset;
+    request.onComplete = std::move(onComplete);
+    request.data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    enqueue(priority, std::move(request));
+}
+
+void UploadService::UploadTexture(TextureHandle      dst,
+                                  const void*        data,
+                                  uint32_t           size,
+                                  const TextureCopy& region,
+                                  UploadPriority     priority,
+                                  UploadCallback     onComplete) {
+    if (!dst.isValid() || !data || size == 0 || priority >= UploadPriority::COUNT) {
+        RENDERX_WARN("UploadService::UploadTexture: invalid request ignored");
+        return;
+    }
+
+    Request request;
+    request.texture    = dst;
+    request.region     = region;
+    request.onComplete = std::move(onComplete);
+    request.data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    enqueue(priority, std::move(request));
+}
+
+void UploadService::complete(uint64_t completedValue) {
+    // Callbacks may queue new uploads, so they run without the lock held
+    std::vector<UploadCallback> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        while (!m_InFlight.empty() && m_InFlight.front().value <= completedValue) {
+            if (m_InFlight.front().onComplete)
+                ready.push_back(std::move(m_InFlight.front().onComplete));
+            m_InFlight.pop_front();
+        }
+    }
+    for (auto& callback : ready)
+        callback(Timeline(completedValue));
+}
+
+Timeline UploadService::drain(uint64_t byteBudget, float msBudget) {
+    using Clock      = std::chrono::steady_clock;
+    const auto start = Clock::now();
+
+    std::vector<UploadCallback> finished;
+    std::vector<UploadCallback> dropped;
+    uint64_t                    spent = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // Stops the whole frame, not just the current priority: skipping ahead
+        // to a lower priority would let it overtake the item that did not fit
+        bool full = false;
+        for (auto& queue : m_Queues) {
+            while (!queue.empty() && !full) {
+                if (spent >= byteBudget ||
+                    (msBudget > 0.0f && spent > 0 &&
+                     std::chrono::duration<float, std::milli>(Clock::now() - start).count() >= msBudget)) {
+                    full = true;
+                    break;
+                }
+
+                Request&       request   = queue.front();
+                const uint64_t remaining = request.data.size() - request.consumed;
+
+                uint64_t piece = remaining;
+                bool     queued;
+                if (request.texture.isValid()) {
+                    // Subresources go whole; only the first item may overrun the budget
+                    if (spent > 0 && spent + remaining > byteBudget) {
+                        full = true;
+                        break;
+                    }
+                    queued = Rx::UploadTexture(request.texture, request.data.data(), (uint32_t)remaining, request.region);
+                } else {
+                    piece  = std::min<uint64_t>({remaining, byteBudget - spent, std::numeric_limits<uint32_t>::max()});
+                    queued = Rx::UploadBuffer(request.buffer,
+                                              request.data.data() + request.consumed,
+                                              (uint32_t)piece,
+                                              (uint32_t)(request.dstOffset + request.consumed));
+                }
+
+                if (!queued) {
+                    // Usually staging is full until earlier copies complete: the
+                    // request keeps its place so nothing behind it overtakes it
+                    if (++request.attempts < MAX_ATTEMPTS) {
+                        full = true;
+                        break;
+                    }
+                    RENDERX_ERROR("UploadService: dropping an upload that could not be staged {} times", MAX_ATTEMPTS);
+                    m_QueuedBytes -= std::min(m_QueuedBytes, remaining);
+                    dropped.push_back(std::move(request.onComplete));
+                    queue.pop_front();
+                    continue;
+                }
+                request.attempts = 0;
+                request.consumed += piece;
+                spent += piece;
+
+                if (request.consumed < request.data.size()) {
+                    full = true; // budget exhausted midway through a buffer
+                    break;
+                }
+
+                finished.push_back(std::move(request.onComplete));
+                queue.pop_front();
+            }
+            if (full)
+                break;
+        }
+        m_QueuedBytes -= std::min(m_QueuedBytes, spent);
+    }
+
+    for (auto& callback : dropped) {
+        if (callback)
+            callback(Timeline(0));
+    }
+
+    if (spent == 0)
+        return Timeline(0);
+
+    const Timeline submitted = Rx::SubmitUploads();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (auto& callback : finished)
+        m_InFlight.push_back({submitted.value, std::move(callback)});
+    return submitted;
+}
+
+Timeline UploadService::Process() {
+    complete(GetGpuQueue(QueueType::TRANSFER)->Completed().value);
+    return drain(m_Desc.bytesPerFrame, m_Desc.millisecondsPerFrame);
+}
+
+void UploadService::Flush() {
+    CommandQueue* transfer = GetGpuQueue(QueueType::TRANSFER);
+
+    // Every pass stages something or counts a failed attempt against the
+    // request at the front, so the loop ends once failures are dropped
+    Timeline last(0);
+    while (GetQueuedCount() > 0) {
+        const Timeline submitted = drain(std::numeric_limits<uint32_t>::max(), 0.0f);
+        if (submitted.value)
+            last = submitted;
+        else if (last.value)
+            transfer->Wait(last); // frees the staging of everything submitted so far
+    }
+    if (last.value)
+        transfer->Wait(last);
+    complete(transfer->Completed().value);
+}
+
+uint64_t UploadService::GetQueuedBytes() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_QueuedBytes;
+}
+
+uint32_t UploadService::GetQueuedCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    uint32_t count = 0;
+    for (const auto& queue : m_Queues)
+        count += (uint32_t)queue.size();
+    return count;
+}
+
+uint32_t UploadService::GetInFlightCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return (uint32_t)m_InFlight.size();
+}
+
+} // namespace Rx
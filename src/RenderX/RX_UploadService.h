@@ -0,0 +1,125 @@
+#pragma once
+#include "RX_Common.h"
+#include <deque>
+#include <functional>
+#include <mutex>
+
+//------------------------------------------------------------------------------
+// UPLOAD SERVICE
+//------------------------------------------------------------------------------
+// Prioritized, budgeted streaming on top of Rx::UploadBuffer/UploadTexture.
+// Requests are queued from any thread with a priority and drained by
+// Process() once per frame, up to a byte budget and an optional CPU-time
+// budget, so streaming never turns into a frame spike.
+//
+//   Rx::UploadService uploads(UploadServiceDesc().setBytesPerFrame(8 << 20));
+//   uploads.UploadTexture(tex, pixels, size, region, UploadPriority::HIGH,
+//                         [](Timeline) { /* texture is resident */ });
+//   ...
+//   Timeline uploaded = uploads.Process();           // once per frame
+//   QueueDependency dep(QueueType::TRANSFER, uploaded);
+//   frames->EndFrame(&dep, uploaded.value ? 1 : 0);
+//
+// Data is copied when a request is queued. Buffer requests larger than the
+// remaining budget are split across frames; a texture subresource is always
+// copied whole, and the first request of a frame may exceed the budget so
+// large items still make progress. Completion callbacks run inside Process(),
+// on the calling thread, once the transfer queue has finished the copy.
+// A request that cannot be staged keeps its place and is retried next frame;
+// after MAX_ATTEMPTS failed tries it is dropped and its callback gets
+// Timeline(0) instead of the copy's completion value.
+//------------------------------------------------------------------------------
+
+namespace Rx {
+
+enum class UploadPriority : uint8_t {
+    CRITICAL, // needed this frame (e.g. the LOD the camera is looking at)
+    HIGH,
+    NORMAL,
+    LOW, // prefetch
+    COUNT
+};
+
+using UploadCallback = std::function<void(Timeline completed)>;
+
+struct UploadServiceDesc {
+    uint64_t bytesPerFrame        = 8 * 1024 * 1024;
+    float    millisecondsPerFrame = 0.0f; // CPU time spent draining; 0 => bytes only
+
+    UploadServiceDesc& setBytesPerFrame(uint64_t bytes) {
+        bytesPerFrame = bytes;
+        return *this;
+    }
+    UploadServiceDesc& setMillisecondsPerFrame(float ms) {
+        millisecondsPerFrame = ms;
+        return *this;
+    }
+};
+
+class RENDERX_EXPORT UploadService {
+public:
+    explicit UploadService(const UploadServiceDesc& desc = {});
+    ~UploadService() = default;
+
+    UploadService(const UploadService&)            = delete;
+    UploadService& operator=(const UploadService&) = delete;
+
+    void UploadBuffer(BufferHandle   dst,
+                      const void*    data,
+                      uint64_t       size,
+                      uint64_t       dstOffset  = 0,
+                      UploadPriority priority   = UploadPriority::NORMAL,
+                      UploadCallback onComplete = {});
+
+    void UploadTexture(TextureHandle      dst,
+                       const void*        data,
+                       uint32_t           size,
+                       const TextureCopy& region,
+                       UploadPriority     priority   = UploadPriority::NORMAL,
+                       UploadCallback     onComplete = {});
+
+    // Runs callbacks for finished copies, then submits up to one frame's budget
+    // of queued work. Returns the transfer Timeline of that submit, 0 if idle.
+    Timeline Process();
+
+    // Drains every queued request regardless of budget and waits for it
+    void Flush();
+
+    uint64_t GetQueuedBytes() const;
+    uint32_t GetQueuedCount() const;
+    uint32_t GetInFlightCount() const;
+
+private:
+    struct Request {
+        BufferHandle         buffer;
+        TextureHandle        texture;
+        TextureCopy          region{};
+        uint64_t             dstOffset = 0;
+        uint64_t             consumed  = 0; // bytes already submitted
+        uint32_t             attempts  = 0; // consecutive drains that could not stage it
+        std::vector<uint8_t> data;
+        UploadCallback       onComplete;
+    };
+
+    struct Completion {
+        uint64_t       value = 0; // transfer timeline value
+        UploadCallback onComplete;
+    };
+
+    // Exclusive end of any buffer range; Rx::UploadBuffer offsets are 32-bit
+    static constexpr uint64_t MAX_BUFFER_END = 1ull << 32;
+    // Failed drains before a request is dropped
+    static constexpr uint32_t MAX_ATTEMPTS = 8;
+
+    void     enqueue(UploadPriority priority, Request&& request);
+    Timeline drain(uint64_t byteBudget, float msBudget);
+    void     complete(uint64_t completedValue);
+
+    UploadServiceDesc      m_Desc;
+    std::deque<Request>    m_Queues[(size_t)UploadPriority::COUNT];
+    std::deque<Completion> m_InFlight;
+    uint64_t               m_QueuedBytes = 0;
+    mutable std::mutex     m_Mutex;
+};
+
+} // namespace Rx
@@ -1124,6 +1124,16 @@ void ValidationLayer::ValidateQueueSubmit(QueueType queue, const SubmitInfo& inf
     if (info.commandListCount == 0) {
         Report(ValidationSeverity::WARNING, ValidationCategory::SYNCHRONIZATION, "Queue submit with 0 command list count");
     }
+
+    for (const auto& sem : info.waitSemaphores) {
+        if (sem.nativeHandle == 0)
+            Report(ValidationSeverity::_ERROR, ValidationCategory::SYNCHRONIZATION, "Queue submit waits on a null external semaphore");
+    }
+
+    for (const auto& sem : info.signalSemaphores) {
+        if (sem.nativeHandle == 0)
+            Report(ValidationSeverity::_ERROR, ValidationCategory::SYNCHRONIZATION, "Queue submit signals a null external semaphore");
+    }
 }
 
 void ValidationLayer::ValidateQueueWait(QueueType queue, Timeline value) {
@@ -55,6 +55,13 @@ BufferHandle VKCreateBuffer(const BufferDesc& desc) {
                                      &vulkanBuffer.allocInfo))
         return BufferHandle{};
 
+    if (Has(desc.usage, BufferFlags::UNIFORM) || Has(desc.usage, BufferFlags::STORAGE)) {
+        VkBufferDeviceAddressInfo addrInfo{};
+        addrInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+        addrInfo.buffer      = vulkanBuffer.buffer;
+        vulkanBuffer.address = vkGetBufferDeviceAddress(ctx.device->logical(), &addrInfo);
+    }
+
     // Upload initial data if provided
     if (desc.initialData) {
         if (desc.memoryType == MemoryType::GPU_ONLY) {
@@ -112,7 +119,10 @@ void VKDestroyBuffer(BufferHandle& handle) {
     }
 
     if (buffer->buffer != VK_NULL_HANDLE) {
-        ctx.allocator->destroyBuffer(buffer->buffer, buffer->allocation);
+        for (; buffer->mapCount > 0; buffer->mapCount--)
+            ctx.allocator->unmap(buffer->allocation);
+        // In-flight frames may still read the buffer
+        ctx.deletionQueue->destroyBuffer(buffer->buffer, buffer->allocation);
         g_BufferPool.free(handle);
     } else {
         RENDERX_WARN("VKDestroyBuffer: buffer handle already null");
@@ -146,23 +156,46 @@ BufferViewHandle VKCreateBufferView(const BufferViewDesc& desc) {
 
     Hash64 hash = ComputeBufferViewHash(desc);
 
-    auto it = g_BufferViewCache.find(hash);
-    if (it != g_BufferViewCache.end())
-        return it->second;
-
-    VulkanBufferView bufferview{};
-    bufferview.buffer  = desc.buffer;
-    bufferview.range   = desc.range;
-    bufferview.offset  = desc.offset;
-    bufferview.hash    = hash;
-    bufferview.isValid = true;
+    BufferViewHandle handle;
+    auto             it = g_BufferViewCache.find(hash);
+    if (it != g_BufferViewCache.end()) {
+        handle = it->second;
+    } else {
+        VulkanBufferView bufferview{};
+        bufferview.buffer  = desc.buffer;
+        bufferview.range   = desc.range;
+        bufferview.offset  = desc.offset;
+        bufferview.hash    = hash;
+        bufferview.isValid = true;
+
+        handle                  = g_BufferViewPool.allocate(bufferview);
+        g_BufferViewCache[hash] = handle;
+    }
 
-    auto handle             = g_BufferViewPool.allocate(bufferview);
-    g_BufferViewCache[hash] = handle;
+    // A cached view keeps the index it was first registered with
+    auto* view = g_BufferViewPool.get(handle);
+    if (desc.bindlessTable.isValid() && view->bindlessIndex == BindlessTableDesc::INVALID_INDEX) {
+        view->bindlessTable = desc.bindlessTable;
+        view->bindlessIndex = RegisterBindlessDescriptor(desc.bindlessTable, ResourceType::STORAGE_BUFFER, handle.id);
+    } else if (desc.bindlessTable.isValid() && view->bindlessTable != desc.bindlessTable) {
+        RENDERX_WARN("VKCreateBufferView: view is already registered with another bindless table");
+    }
     return handle;
 }
 
 void VKDestroyBufferView(BufferViewHandle& handle) {
+    auto* view = g_BufferViewPool.get(handle);
+    if (!view)
+        return;
+
+    if (view->bindlessIndex != BindlessTableDesc::INVALID_INDEX) {
+        GetVulkanContext().deletionQueue->releaseBindlessIndex(
+            view->bindlessTable, ResourceType::STORAGE_BUFFER, view->bindlessIndex);
+    }
+    InvalidateCachedSets(ResourceType::CONSTANT_BUFFER, handle.id);
+
+    // Later views of the same range must not resolve to this dead handle
+    g_BufferViewCache.erase(view->hash);
     g_BufferViewPool.free(handle);
 }
 
@@ -192,10 +225,197 @@ void* VKMapBuffer(BufferHandle handle) {
         return buffer->allocInfo.pMappedData;
     }
 
-    // Consider: attempt ctx.allocator->map() here if mapping is needed
-    RENDERX_WARN("Failed to map buffer: id: {}", handle.id);
-    return nullptr;
+    // Host-visible but not persistently mapped: map until UnmapBuffer
+    void* ptr = GetVulkanContext().allocator->map(buffer->allocation);
+    if (!ptr) {
+        RENDERX_WARN("Failed to map buffer: id: {}", handle.id);
+        return nullptr;
+    }
+    buffer->mapCount++;
+    return ptr;
 }
+
+void VKUnmapBuffer(BufferHandle handle) {
+    auto* buffer = g_BufferPool.get(handle);
+    if (!buffer) {
+        RENDERX_WARN("VKUnmapBuffer: invalid buffer handle");
+        return;
+    }
+
+    // Persistent mappings live as long as the buffer
+    if (buffer->mapCount == 0)
+        return;
+    GetVulkanContext().allocator->unmap(buffer->allocation);
+    buffer->mapCount--;
+}
+
+// VulkanGeometryPool Implementation
+
+static VmaVirtualBlock CreateGeometryBlock(uint32_t units) {
+    VmaVirtualBlockCreateInfo info{};
+    info.size = units; // default algorithm is TLSF
+
+    VmaVirtualBlock block = VK_NULL_HANDLE;
+    if (vmaCreateVirtualBlock(&info, &block) != VK_SUCCESS)
+        RENDERX_ERROR("VulkanGeometryPool: failed to create virtual block of {} units", units);
+    return block;
+}
+
+VulkanGeometryPool::VulkanGeometryPool(VulkanContext& ctx, const GeometryPoolDesc& desc)
+    : m_Ctx(ctx),
+      m_VertexStride(desc.vertexStride),
+      m_IndexSize(desc.indexFormat == Format::UINT16 ? 2 : 4),
+      m_IndexFormat(desc.indexFormat) {
+    const char* name = desc.debugName ? desc.debugName : "GeometryPool";
+
+    m_VertexBuffer = VKCreateBuffer(
+        BufferDesc::VertexBuffer((size_t)desc.maxVertices * m_VertexStride).setDebugName(name));
+    m_IndexBuffer =
+        VKCreateBuffer(BufferDesc::IndexBuffer((size_t)desc.maxIndices * m_IndexSize).setDebugName(name));
+
+    m_VertexBlock = CreateGeometryBlock(desc.maxVertices);
+    m_IndexBlock  = CreateGeometryBlock(desc.maxIndices);
+}
+
+VulkanGeometryPool::~VulkanGeometryPool() {
+    // Outstanding ranges die with the pool
+    if (m_VertexBlock) {
+        vmaClearVirtualBlock(m_VertexBlock);
+        vmaDestroyVirtualBlock(m_VertexBlock);
+    }
+    if (m_IndexBlock) {
+        vmaClearVirtualBlock(m_IndexBlock);
+        vmaDestroyVirtualBlock(m_IndexBlock);
+    }
+    VKDestroyBuffer(m_VertexBuffer);
+    VKDestroyBuffer(m_IndexBuffer);
+}
+
+void VulkanGeometryPool::retire() {
+    const uint64_t graphics = m_Ctx.graphicsQueue->Completed().value;
+    while (!m_Retired.empty() && m_Retired.front().graphics <= graphics) {
+        const Retired& r = m_Retired.front();
+        vmaVirtualFree(m_VertexBlock, r.vertexRange);
+        if (r.indexRange != VK_NULL_HANDLE)
+            vmaVirtualFree(m_IndexBlock, r.indexRange);
+        m_Retired.pop_front();
+    }
+}
+
+GeometryAllocation VulkanGeometryPool::allocate(uint32_t vertexCount, uint32_t indexCount) {
+    if (vertexCount == 0 || !m_VertexBlock || !m_IndexBlock) {
+        RENDERX_ERROR("GeometryPool::allocate: vertexCount must be non-zero");
+        return {};
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    retire();
+
+    VmaVirtualAllocationCreateInfo info{};
+    info.size = vertexCount;
+
+    VmaVirtualAllocation vertexRange  = VK_NULL_HANDLE;
+    VkDeviceSize         vertexOffset = 0;
+    if (vmaVirtualAllocate(m_VertexBlock, &info, &vertexRange, &vertexOffset) != VK_SUCCESS) {
+        RENDERX_ERROR("GeometryPool::allocate: no free range for {} vertices", vertexCount);
+        return {};
+    }
+
+    VmaVirtualAllocation indexRange = VK_NULL_HANDLE;
+    VkDeviceSize         firstIndex = 0;
+    if (indexCount > 0) {
+        info.size = indexCount;
+        if (vmaVirtualAllocate(m_IndexBlock, &info, &indexRange, &firstIndex) != VK_SUCCESS) {
+            RENDERX_ERROR("GeometryPool::allocate: no free range for {} indices", indexCount);
+            vmaVirtualFree(m_VertexBlock, vertexRange);
+            return {};
+        }
+    }
+
+    GeometryAllocation allocation;
+    allocation.firstIndex   = (uint32_t)firstIndex;
+    allocation.vertexOffset = (int32_t)vertexOffset;
+    allocation.indexCount   = indexCount;
+    allocation.vertexCount  = vertexCount;
+    allocation.vertexRange  = (uint64_t)vertexRange;
+    allocation.indexRange   = (uint64_t)indexRange;
+    return allocation;
+}
+
+void VulkanGeometryPool::upload(const GeometryAllocation& allocation, const void* vertices, const void* indices) {
+    if (!allocation.isValid()) {
+        RENDERX_WARN("GeometryPool::upload: invalid allocation");
+        return;
+    }
+
+    // Byte ranges are computed in 64 bits; VKCreateGeometryPool keeps both
+    // buffers under 4 GB, so the results fit the uploader's 32-bit offsets
+    if (vertices) {
+        VkBuffer       dst    = g_BufferPool.get(m_VertexBuffer)->buffer;
+        const uint64_t size   = (uint64_t)allocation.vertexCount * m_VertexStride;
+        const uint64_t offset = (uint64_t)allocation.vertexOffset * m_VertexStride;
+        m_Ctx.loadTimeStagingUploader->uploadBuffer(dst, vertices, (uint32_t)size, (uint32_t)offset);
+    }
+    if (indices && allocation.indexCount > 0) {
+        VkBuffer       dst    = g_BufferPool.get(m_IndexBuffer)->buffer;
+        const uint64_t size   = (uint64_t)allocation.indexCount * m_IndexSize;
+        const uint64_t offset = (uint64_t)allocation.firstIndex * m_IndexSize;
+        m_Ctx.loadTimeStagingUploader->uploadBuffer(dst, indices, (uint32_t)size, (uint32_t)offset);
+    }
+}
+
+void VulkanGeometryPool::free(GeometryAllocation& allocation) {
+    if (!allocation.isValid())
+        return;
+
+    Retired retired;
+    retired.vertexRange = (VmaVirtualAllocation)allocation.vertexRange;
+    retired.indexRange  = (VmaVirtualAllocation)allocation.indexRange;
+    // Draws submitted up to now may still read the ranges
+    retired.graphics = m_Ctx.graphicsQueue->Submitted().value;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Retired.push_back(retired);
+    allocation = {};
+}
+
+// The virtual blocks are sized in elements, so their "bytes" are counts
+uint32_t VulkanGeometryPool::GetUsedVertices() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    VmaStatistics stats{};
+    vmaGetVirtualBlockStatistics(m_VertexBlock, &stats);
+    return (uint32_t)stats.allocationBytes;
+}
+
+uint32_t VulkanGeometryPool::GetUsedIndices() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    VmaStatistics stats{};
+    vmaGetVirtualBlockStatistics(m_IndexBlock, &stats);
+    return (uint32_t)stats.allocationBytes;
+}
+
+GeometryPool* VKCreateGeometryPool(const GeometryPoolDesc& desc) {
+    if (desc.vertexStride == 0 || desc.maxVertices == 0 || desc.maxIndices == 0) {
+        RENDERX_ERROR("VKCreateGeometryPool: vertexStride, maxVertices and maxIndices must be non-zero");
+        return nullptr;
+    }
+    if (desc.indexFormat != Format::UINT16 && desc.indexFormat != Format::UINT32) {
+        RENDERX_ERROR("VKCreateGeometryPool: indexFormat must be UINT16 or UINT32");
+        return nullptr;
+    }
+    const uint64_t indexSize = desc.indexFormat == Format::UINT16 ? 2 : 4;
+    if ((uint64_t)desc.maxVertices * desc.vertexStride > UINT32_MAX ||
+        (uint64_t)desc.maxIndices * indexSize > UINT32_MAX || desc.maxVertices > INT32_MAX) {
+        RENDERX_ERROR("VKCreateGeometryPool: vertex and index buffers must each stay under 4 GB");
+        return nullptr;
+    }
+    return new VulkanGeometryPool(GetVulkanContext(), desc);
+}
+
+void VKDestroyGeometryPool(GeometryPool* pool) {
+    delete pool;
+}
+
 } // namespace RxVK
 
-} // namespace Rx
\ No newline at end of file
+} // namespace Rx
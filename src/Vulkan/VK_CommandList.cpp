@@ -1,39 +1,121 @@
 #include "VK_Common.h"
 #include "VK_RenderX.h"
+#include <algorithm>
 
 namespace Rx {
 
 namespace RxVK {
 
 // command allocator
-CommandList* VulkanCommandAllocator::Allocate() {
+void VulkanCommandAllocator::grow(uint32_t count) {
+    m_GrowScratch.resize(count);
+
     VkCommandBufferAllocateInfo allocInfo{};
-    VkCommandBuffer             buffer;
     allocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.commandBufferCount = 1;
+    allocInfo.commandBufferCount = count;
     allocInfo.commandPool        = m_Pool;
     allocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    VK_CHECK(vkAllocateCommandBuffers(m_device, &allocInfo, &buffer));
-    return new VulkanCommandList(buffer, m_QueueType);
+    VK_CHECK(vkAllocateCommandBuffers(m_device, &allocInfo, m_GrowScratch.data()));
+
+    m_Lists.reserve(m_Lists.size() + count);
+    m_FreeLists.reserve(m_Lists.size() + count);
+    for (VkCommandBuffer buffer : m_GrowScratch) {
+        m_Lists.push_back(std::make_unique<VulkanCommandList>(buffer, m_QueueType));
+        m_Lists.back()->m_Free = true;
+        m_FreeLists.push_back(m_Lists.back().get());
+    }
+}
+
+CommandList* VulkanCommandAllocator::Allocate() {
+    if (m_FreeLists.empty())
+        grow(std::max<uint32_t>(MIN_GROW, (uint32_t)m_Lists.size()));
+
+    VulkanCommandList* list = m_FreeLists.back();
+    m_FreeLists.pop_back();
+    list->m_Free = false;
+    return list;
+}
+
+void VulkanCommandAllocator::AllocateMany(uint32_t count, CommandList** outLists) {
+    if (m_FreeLists.size() < count)
+        grow(std::max<uint32_t>(MIN_GROW, count - (uint32_t)m_FreeLists.size()));
+
+    for (uint32_t i = 0; i < count; i++) {
+        m_FreeLists.back()->m_Free = false;
+        outLists[i]                = m_FreeLists.back();
+        m_FreeLists.pop_back();
+    }
 }
 
 void VulkanCommandAllocator::Free(CommandList* list) {
-    VulkanCommandList* list1 = reinterpret_cast<VulkanCommandList*>(list);
-    vkFreeCommandBuffers(m_device, m_Pool, 1, &list1->m_CommandBuffer);
-    delete list;
+    // The command buffer stays allocated from m_Pool; the pool is created with
+    // RESET_COMMAND_BUFFER_BIT so the next open() implicitly resets it.
+    VulkanCommandList* vkList = static_cast<VulkanCommandList*>(list);
+    if (!vkList || vkList->m_Free) {
+        // Pushing it twice would hand the same list to two callers
+        RENDERX_ERROR("CommandAllocator::Free: '{}' got a null or already freed command list",
+                      m_DebugName ? m_DebugName : "unnamed");
+        return;
+    }
+    vkList->resetState();
+    vkList->m_Free = true;
+    m_FreeLists.push_back(vkList);
 }
 
 void VulkanCommandAllocator::Reset(CommandList* list) {
-    VulkanCommandList* list1 = reinterpret_cast<VulkanCommandList*>(list);
-    VK_CHECK(vkResetCommandBuffer(list1->m_CommandBuffer, 0));
+    VulkanCommandList* vkList = static_cast<VulkanCommandList*>(list);
+    VK_CHECK(vkResetCommandBuffer(vkList->m_CommandBuffer, 0));
+    vkList->resetState();
 }
 
 void VulkanCommandAllocator::Reset() {
     VK_CHECK(vkResetCommandPool(m_device, m_Pool, 0));
+
+    // Every list goes back onto the free stack. Lists handed out before the
+    // reset must not be used afterwards without calling Allocate() again.
+    m_FreeLists.clear();
+    for (auto it = m_Lists.rbegin(); it != m_Lists.rend(); ++it) {
+        (*it)->resetState();
+        (*it)->m_Free = true;
+        m_FreeLists.push_back(it->get());
+    }
 }
 
 // command list
+VulkanCommandList::~VulkanCommandList() {
+    if (m_PushFallbackPool.isValid())
+        VKDestroyDescriptorPool(m_PushFallbackPool);
+}
+
+void VulkanCommandList::resetState() {
+    m_CurrentPipelineHandle       = {};
+    m_CurrentPipelineLayoutHandle = {};
+    m_BoundPipelineLayout         = VK_NULL_HANDLE;
+    m_PushRangeCount              = 0;
+    m_HasMultiplePushRanges       = false;
+    m_PushConstantStages          = 0;
+    m_VertexBuffer                = {};
+    m_VertexBufferOffset          = 0;
+    m_IndexBuffer                 = {};
+    m_IndexBufferOffset           = 0;
+    m_BoundHeapCount              = 0;
+    for (BoundSet& bound : m_BoundSets)
+        bound = {};
+
+    // clear() keeps capacity, so a recycled list records without reallocating
+    m_LocalTextures.clear();
+    m_LocalBuffers.clear();
+    m_ImageBarriers.clear();
+    m_BufferBarriers.clear();
+}
+
 void VulkanCommandList::open() {
+    // Reopening means the GPU is done with the previous recording, and with
+    // the emulated push sets it bound
+    if (m_PushFallbackPool.isValid())
+        VKResetDescriptorPool(m_PushFallbackPool);
+    m_PushFallbackSet    = VK_NULL_HANDLE;
+    m_PushFallbackLayout = {};
 
     VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
     bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -47,12 +129,25 @@ void VulkanCommandList::close() {
 
 void VulkanCommandList::setPipeline(const PipelineHandle& pipeline) {
 
-    auto* p = g_PipelinePool.get(pipeline);
-    if (p == nullptr || p->vkPipeline == VK_NULL_HANDLE) {
+    auto*      p          = g_PipelinePool.get(pipeline);
+    VkPipeline vkPipeline = p ? p->ready() : VK_NULL_HANDLE;
+    if (vkPipeline == VK_NULL_HANDLE && p && p->compile) {
+        // Still compiling (or failed): bind the fallback, or wait for the
+        // compile when there is none
+        auto* fallback = p->fallback.isValid() ? g_PipelinePool.get(p->fallback) : nullptr;
+        if (fallback && fallback->ready() != VK_NULL_HANDLE) {
+            p          = fallback;
+            vkPipeline = fallback->ready();
+        } else {
+            p->compile->done.wait(false, std::memory_order_acquire);
+            vkPipeline = p->ready();
+        }
+    }
+    if (vkPipeline == VK_NULL_HANDLE) {
         RENDERX_WARN("VulkanCommandList::setPipeline: invalid pipeline handle");
         return;
     }
-    vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, p->vkPipeline);
+    vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
     m_CurrentPipelineHandle       = pipeline;
     m_CurrentPipelineLayoutHandle = p->layout;
 
@@ -62,8 +62,10 @@ void VKPrintHandles() {
 
     RENDERX_INFO("---- Shaders ----");
     g_ShaderPool.ForEachAlive([](VulkanShader& shader, ShaderHandle handle) {
-        RENDERX_INFO(
-            "Shader[{}] | VkShaderModule={} | EntryPoint={}", handle.id, fmt::ptr(shader.shaderModule), shader.entryPoint);
+        RENDERX_INFO("Shader[{}] | VkShaderModule={} | EntryPoint={}",
+                     handle.id,
+                     fmt::ptr(shader.shaderModule->handle),
+                     shader.entryPoint);
     });
 
     RENDERX_INFO("---- Pipeline Layouts ----");
@@ -73,7 +75,7 @@ void VKPrintHandles() {
 
     RENDERX_INFO("---- Pipelines ----");
     g_PipelinePool.ForEachAlive([](VulkanPipeline& pipe, PipelineHandle handle) {
-        RENDERX_INFO("Pipeline[{}] | VkPipeline={}", handle.id, fmt::ptr(pipe.vkPipeline));
+        RENDERX_INFO("Pipeline[{}] | VkPipeline={}", handle.id, fmt::ptr(pipe.ready()));
     });
 
     RENDERX_INFO("---- Render Passes ----");
@@ -89,6 +91,7 @@ void VKPrintHandles() {
     g_SetPool.ForEachAlive([](VulkanSet& set, SetHandle handle) {
         RENDERX_INFO("DescriptorSet[{}] | VkDescriptorSet={}", handle.id, fmt::ptr(set.vkSet));
     });
+    RENDERX_INFO("Cached sets: {}", g_SetCache.size());
 
     RENDERX_INFO("---- Descriptor Set Layouts ----");
     g_SetLayoutPool.ForEachAlive([](VulkanSetLayout& layout, SetLayoutHandle handle) {
@@ -97,7 +100,7 @@ void VKPrintHandles() {
 
     RENDERX_INFO("---- Descriptor Pools ----");
     g_DescriptorPoolPool.ForEachAlive([](VulkanDescriptorPool& pool, DescriptorPoolHandle handle) {
-        RENDERX_INFO("DescriptorPool[{}] | VkDescriptorPool={}", handle.id, fmt::ptr(pool.vkPool));
+        RENDERX_INFO("DescriptorPool[{}] | VkDescriptorPool={} | chain={}", handle.id, fmt::ptr(pool.vkPool), pool.vkPools.size());
     });
 
     RENDERX_INFO("---- Descriptor Heaps ----");
@@ -109,6 +112,17 @@ void VKPrintHandles() {
     g_SamplerPool.ForEachAlive([](VulkanSampler& sampler, SamplerHandle handle) {
         RENDERX_INFO("Sampler[{}] | VkSampler={}", handle.id, fmt::ptr(sampler.vkSampler));
     });
+
+    RENDERX_INFO("---- Bindless Tables ----");
+    g_BindlessTablePool.ForEachAlive([](VulkanBindlessTable& table, BindlessTableHandle handle) {
+        RENDERX_INFO("BindlessTable[{}] | VkDescriptorSet={} | textures={}/{} | buffers={}/{}",
+                     handle.id,
+                     fmt::ptr(table.vkSet),
+                     table.ranges[BindlessTableDesc::TEXTURE_BINDING].next,
+                     table.ranges[BindlessTableDesc::TEXTURE_BINDING].capacity,
+                     table.ranges[BindlessTableDesc::BUFFER_BINDING].next,
+                     table.ranges[BindlessTableDesc::BUFFER_BINDING].capacity);
+    });
 }
 
 void freeAllVulkanResources() {
@@ -163,10 +177,7 @@ void freeAllVulkanResources() {
     });
 
     g_ShaderPool.ForEach([&](VulkanShader& shader) {
-        if (shader.shaderModule != VK_NULL_HANDLE) {
-            vkDestroyShaderModule(g_Device, shader.shaderModule, nullptr);
-            shader.shaderModule = VK_NULL_HANDLE;
-        }
+        shader.shaderModule.reset();
 
         shader.entryPoint.clear();
     });
@@ -179,9 +190,10 @@ void freeAllVulkanResources() {
     });
 
     g_PipelinePool.ForEach([&](VulkanPipeline& pipeline) {
-        if (pipeline.vkPipeline != VK_NULL_HANDLE) {
-            vkDestroyPipeline(g_Device, pipeline.vkPipeline, nullptr);
+        if (VkPipeline vkPipeline = pipeline.ready(); vkPipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(g_Device, vkPipeline, nullptr);
             pipeline.vkPipeline = VK_NULL_HANDLE;
+            pipeline.compile.reset();
         }
     });
     g_RenderPassPool.ForEach([&](VulkanRenderPass& rp) {
@@ -200,7 +212,19 @@ void freeAllVulkanResources() {
 
     g_SetPool.ForEach([](VulkanSet& set) { set.vkSet = VK_NULL_HANDLE; });
 
+    g_BindlessTablePool.ForEach([&](VulkanBindlessTable& table) {
+        if (table.vkPool != VK_NULL_HANDLE) {
+            vkDestroyDescriptorPool(g_Device, table.vkPool, nullptr);
+            table.vkPool = VK_NULL_HANDLE;
+            table.vkSet  = VK_NULL_HANDLE;
+        }
+    });
+
     g_SetLayoutPool.ForEach([&](VulkanSetLayout& layout) {
+        if (layout.updateTemplate != VK_NULL_HANDLE) {
+            vkDestroyDescriptorUpdateTemplate(g_Device, layout.updateTemplate, nullptr);
+            layout.updateTemplate = VK_NULL_HANDLE;
+        }
         if (layout.vkLayout != VK_NULL_HANDLE) {
             vkDestroyDescriptorSetLayout(g_Device, layout.vkLayout, nullptr);
             layout.vkLayout = VK_NULL_HANDLE;
@@ -208,10 +232,10 @@ void freeAllVulkanResources() {
     });
 
     g_DescriptorPoolPool.ForEach([&](VulkanDescriptorPool& pool) {
-        if (pool.vkPool != VK_NULL_HANDLE) {
-            vkDestroyDescriptorPool(g_Device, pool.vkPool, nullptr);
-            pool.vkPool = VK_NULL_HANDLE;
-        }
+        for (VkDescriptorPool vkPool : pool.vkPools)
+            vkDestroyDescriptorPool(g_Device, vkPool, nullptr);
+        pool.vkPools.clear();
+        pool.vkPool = VK_NULL_HANDLE;
     });
 
     g_DescriptorHeapPool.ForEach([&](VulkanDescriptorHeap& heap) {
@@ -237,27 +261,38 @@ void freeAllVulkanResources() {
     g_BufferViewPool.clear();
     g_RenderPassPool.clear();
     g_BufferViewCache.clear();
+    g_SetCache.clear();
+    g_SetCacheRefs.clear();
     g_FramebufferPool.clear();
     g_PipelineLayoutPool.clear();
     g_DescriptorPoolPool.clear();
     g_SetLayoutPool.clear();
+    g_BindlessTablePool.clear();
 }
 
 void VKShutdownCommon() {
     auto& ctx = GetVulkanContext();
     vkDeviceWaitIdle(ctx.device->logical());
+    // Pending compiles finish first so their pipelines are destroyed below
+    delete ctx.pipelineCompiler;
+    ctx.pipelineCompiler = nullptr;
+    ctx.deletionQueue->flush();
     freeAllVulkanResources();
+    ctx.pipelineCache->save();
 
     //---------------------------------------
     // must follow this destruction order
-    delete ctx.stagingAllocator;
+    delete ctx.deletionQueue;
+    ctx.deletionQueue = nullptr; // queue submits poll it while it exists
     delete ctx.deferredUploader;
     delete ctx.immediateUploader;
     delete ctx.loadTimeStagingUploader;
+    delete ctx.stagingAllocator;
     delete ctx.graphicsQueue;
     delete ctx.computeQueue;
     delete ctx.transferQueue;
     delete ctx.allocator;
+    delete ctx.pipelineCache;
     delete ctx.device;
     delete ctx.instance;
     //---------------------------------------
@@ -7,14 +7,18 @@
 #include <vulkan/vulkan.h>
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <deque>
 #include <limits>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <random>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -178,6 +182,8 @@ struct DescriptorPoolSizes {
     uint32_t storageImageCount         = 0;
     uint32_t samplerCount              = 0;
     uint32_t combinedImageSamplerCount = 0;
+    uint32_t uniformBufferDynamicCount = 0;
+    uint32_t storageBufferDynamicCount = 0;
     uint32_t maxSets                   = 0;
     DescriptorPoolSizes(uint32_t max) {
         uniformBufferCount        = max;
@@ -186,6 +192,8 @@ struct DescriptorPoolSizes {
         storageImageCount         = max;
         samplerCount              = max;
         combinedImageSamplerCount = max;
+        uniformBufferDynamicCount = max;
+        storageBufferDynamicCount = max;
         maxSets                   = max;
     }
 };
@@ -219,11 +227,34 @@ struct VulkanPipelineLayout {
     std::vector<Hash64>                setHashs;
     StoredPushRange                    pushRanges[MAX_PUSH_RANGES] = {};
     uint32_t                           pushRangeCount;
+    bool                               descriptorBuffer = false; // built from DESCRIPTOR_BUFFER set layouts
+
+    // Set index and layout of the push descriptor set, if any
+    uint32_t        pushSetIndex = UINT32_MAX;
+    SetLayoutHandle pushSetLayout;
+};
+
+// Result slot of an async compile, shared between the pipeline and the worker
+struct VulkanPipelineCompile {
+    VkPipeline        vkPipeline = VK_NULL_HANDLE; // written before `done` is set
+    std::atomic<bool> done       = false;
 };
 
 struct VulkanPipeline {
     VkPipeline           vkPipeline;
     PipelineLayoutHandle layout;
+
+    // CreateGraphicsPipeline(s)Async: vkPipeline stays null and the result
+    // arrives in `compile`; setPipeline binds `fallback` until then
+    std::shared_ptr<VulkanPipelineCompile> compile;
+    PipelineHandle                         fallback;
+
+    // Null while compiling or when compilation failed
+    VkPipeline ready() const {
+        if (vkPipeline != VK_NULL_HANDLE || !compile)
+            return vkPipeline;
+        return compile->done.load(std::memory_order_acquire) ? compile->vkPipeline : VK_NULL_HANDLE;
+    }
 };
 
 struct VulkanBufferConfig {
@@ -261,19 +292,23 @@ struct VulkanBuffer {
     VmaAllocation     allocation   = VK_NULL_HANDLE;
     VmaAllocationInfo allocInfo    = {};
     VkDeviceSize      size         = 0;
+    VkDeviceAddress   address      = 0; // UNIFORM / STORAGE buffers only
     uint32_t          bindingCount = 1;
+    uint32_t          mapCount     = 0; // MapBuffer calls on a non-persistent mapping not yet unmapped
     BufferFlags       flags;
     const char*       debugName = nullptr;
     VulkanAccessState state;
 };
 
 struct VulkanBufferView {
-    BufferHandle buffer;
-    uint32_t     offset;
-    uint32_t     range;
-    Hash64       hash;
-    bool         isValid   = false;
-    const char*  debugName = nullptr;
+    BufferHandle        buffer;
+    uint32_t            offset;
+    uint32_t            range;
+    Hash64              hash;
+    bool                isValid   = false;
+    const char*         debugName = nullptr;
+    BindlessTableHandle bindlessTable;
+    uint32_t            bindlessIndex = BindlessTableDesc::INVALID_INDEX;
 };
 
 struct VulkanTexture {
@@ -299,16 +334,36 @@ struct VulkanTextureView {
     uint32_t        baseArrayLayer  = 0;
     uint32_t        arrayLayerCount = 1;
     const char*     debugName       = nullptr;
+
+    BindlessTableHandle bindlessTable;
+    ResourceType        bindlessType  = ResourceType::TEXTURE_SRV;
+    uint32_t            bindlessIndex = BindlessTableDesc::INVALID_INDEX;
 };
 
 struct VulkanSampler {
-    VkSampler vkSampler;
+    VkSampler           vkSampler;
+    BindlessTableHandle bindlessTable;
+    uint32_t            bindlessIndex = BindlessTableDesc::INVALID_INDEX;
+};
+// Owns a VkShaderModule. Async compile jobs keep a reference, so destroying
+// the shader never frees a module a worker is still compiling from.
+struct VulkanShaderModule {
+    VkDevice       device = VK_NULL_HANDLE;
+    VkShaderModule handle = VK_NULL_HANDLE;
+
+    VulkanShaderModule(VkDevice dev, VkShaderModule module)
+        : device(dev),
+          handle(module) {}
+    VulkanShaderModule(const VulkanShaderModule&)            = delete;
+    VulkanShaderModule& operator=(const VulkanShaderModule&) = delete;
+    ~VulkanShaderModule() { vkDestroyShaderModule(device, handle, nullptr); }
 };
+
 struct VulkanShader {
-    std::string    entryPoint;
-    PipelineStage  type;
-    VkShaderModule shaderModule = VK_NULL_HANDLE;
-    const char*    debugName    = nullptr;
+    std::string                         entryPoint;
+    PipelineStage                       type;
+    std::shared_ptr<VulkanShaderModule> shaderModule;
+    const char*                         debugName = nullptr;
 };
 
 struct SwapchainSupportDetails {
@@ -353,11 +408,13 @@ struct VulkanSetLayout {
     // and when computing pool sizes at arena creation
     struct BindingInfo {
         uint32_t           slot;
+        ResourceType       type;
         VkDescriptorType   vkType;
         uint32_t           count;
         VkShaderStageFlags stages;
         bool               updateAfterBind;
         bool               partiallyBound;
+        uint64_t           byteOffset; // DESCRIPTOR_BUFFER: offset of the binding inside a set
     };
 
     static constexpr uint32_t MAX_BINDINGS = 32;
@@ -365,28 +422,66 @@ struct VulkanSetLayout {
     uint32_t                  bindingCount       = 0;
     bool                      hasUpdateAfterBind = false;
 
+    // DESCRIPTOR_BUFFER layouts: size of one set in heap memory, as reported
+    // by vkGetDescriptorSetLayoutSizeEXT
+    bool     descriptorBuffer     = false;
+    uint64_t descriptorBufferSize = 0;
+
+    // Written by pushDescriptor / setInline*. A real push layout with
+    // VK_KHR_push_descriptor, a plain one fed by per-list sets without it.
+    bool pushDescriptor = false;
+
+    // DYNAMIC_* descriptors, each taking one pDynamicOffsets entry at bind
+    // time, and the alignment those offsets must keep
+    static constexpr uint32_t MAX_DYNAMIC_DESCRIPTORS = 16;
+    uint32_t                  dynamicCount            = 0;
+    uint32_t                  dynamicAlignment        = 1;
+
     // Total descriptor count across all bindings
     // Used when computing how many slots an allocation takes
     uint32_t totalDescriptorCount = 0;
 
+    // Covers every binding, one VulkanPackedDescriptor per descriptor; fed by
+    // WriteSetPacked. Not created for descriptor-buffer layouts or layouts
+    // above MAX_TEMPLATE_DESCRIPTORS (unbounded arrays).
+    static constexpr uint32_t  MAX_TEMPLATE_DESCRIPTORS = 1024;
+    VkDescriptorUpdateTemplate updateTemplate           = VK_NULL_HANDLE;
+
     const char* debugName = nullptr;
 };
 
+// One descriptor of a WriteSetPacked update, at the template's stride
+union VulkanPackedDescriptor {
+    VkDescriptorImageInfo  image;
+    VkDescriptorBufferInfo buffer;
+};
+
 // Stored per DescriptorPoolHandle
 // One pool can back many sets (LINEAR) or individual sets (POOL)
 struct VulkanDescriptorPool {
 
     DescriptorPoolFlags   flags;
-    VkDescriptorPool      vkPool = VK_NULL_HANDLE;
+    VkDescriptorPool      vkPool = VK_NULL_HANDLE; // the pool of the chain sets are allocated from
     DescriptorHeapHandle  heapHandle;
     uint64_t              heapBaseOffset = 0; // byte offset into the heap where this pool starts
-    uint64_t              writePtr       = 0; // current allocation position in bytes (LINEAR)
+    uint64_t              writePtr       = 0; // LINEAR: bytes handed out, relative to heapBaseOffset
     std::vector<uint32_t> freeSlots;
     SetLayoutHandle       layout;
     uint64_t              stridePerSet    = 0;
     uint32_t              capacity        = 0; // max sets
     bool                  updateAfterBind = false;
     const char*           debugName       = nullptr;
+
+    //---- DESCRIPTOR_SETS path -------------------------------------------
+    // Every VkDescriptorPool of the pool, each sized for `capacity` sets.
+    // Growable pools append one when the active pool runs out; a reset
+    // keeps them all and starts again from the first.
+    std::vector<VkDescriptorPool> vkPools;
+    uint32_t                      activePool = 0;
+    bool                          growable   = false;
+
+    // LINEAR: sets handed out since the last reset, released by the reset
+    std::vector<SetHandle> linearSets;
 };
 
 // Stored per SetHandle
@@ -394,7 +489,8 @@ struct VulkanSet {
     DescriptorPoolFlags poolFlags; // which path this set came from
 
     //---- DESCRIPTOR_SETS path -------------------------------------------
-    VkDescriptorSet vkSet = VK_NULL_HANDLE;
+    VkDescriptorSet  vkSet  = VK_NULL_HANDLE;
+    VkDescriptorPool vkPool = VK_NULL_HANDLE; // member of the owning pool's chain
 
     //---- DESCRIPTOR_BUFFER path -----------------------------------------
     // The set is just a location in a heap buffer.
@@ -412,6 +508,41 @@ struct VulkanSet {
     const char* debugName = nullptr;
 };
 
+// Entry of the AllocateCachedSet cache, keyed by a hash of layout and writes.
+// The writes are kept to tell colliding entries apart and to unlink the entry
+// from the per-resource index when it goes away.
+struct VulkanCachedSet {
+    SetHandle                    set;
+    DescriptorPoolHandle         pool;
+    SetLayoutHandle              layout;
+    std::vector<DescriptorWrite> writes;
+    uint64_t                     lastUsed = 0; // cache frame of the last request
+};
+
+// One cache entry: its hash, plus its set to pick it out among collisions
+struct VulkanCachedSetRef {
+    Hash64   hash = 0;
+    uint64_t set  = 0;
+};
+
+// Stored per BindlessTableHandle
+// One update-after-bind set for the whole table; every binding hands out
+// array indices from its own free list
+struct VulkanBindlessTable {
+    struct Range {
+        uint32_t              capacity = 0;
+        uint32_t              next     = 0; // indices below this were handed out at least once
+        std::vector<uint32_t> freeList;
+    };
+
+    SetLayoutHandle  layout;
+    VkDescriptorPool vkPool   = VK_NULL_HANDLE;
+    VkDescriptorSet  vkSet    = VK_NULL_HANDLE;
+    uint32_t         setIndex = 0;
+    Range            ranges[BindlessTableDesc::BINDING_COUNT];
+    const char*      debugName = nullptr;
+};
+
 // Stored per DescriptorHeapHandle
 // Only used for the DESCRIPTOR_BUFFER path.
 // On the DESCRIPTOR_SETS path the user never creates a heap —
@@ -428,8 +559,9 @@ struct VulkanDescriptorHeap {
     // GPU virtual address — used in vkCmdBindDescriptorBuffersEXT
     VkDeviceAddress gpuAddress = 0;
 
-    uint32_t capacity       = 0; // number of descriptors
-    uint32_t descriptorSize = 0; // hardware size per descriptor for this heap type
+    uint32_t     capacity       = 0; // number of descriptors
+    uint32_t     descriptorSize = 0; // hardware size per descriptor for this heap type
+    VkDeviceSize size           = 0; // capacity * descriptorSize
 
     DescriptorHeapType type;
     bool               shaderVisible = true;
@@ -474,7 +606,20 @@ inline VkDescriptorPoolSizeList ComputePoolSizes(const VulkanSetLayout& layout,
 
 // Write a single descriptor directly into CPU-mapped heap memory
 // Used for the DESCRIPTOR_BUFFER path
-void WriteRawDescriptorToMemory(uint8_t* destCpuPtr, VkDevice device, ResourceType type, uint64_t resourceHandle);
+void WriteRawDescriptorToMemory(
+    uint8_t* destCpuPtr, VkDevice device, ResourceType type, uint64_t resourceHandle, uint64_t samplerHandle = 0);
+
+// Writes a view or sampler into a bindless table and returns its index, or
+// BindlessTableDesc::INVALID_INDEX. Indices go back to the table through the
+// deletion queue so a slot is never reused while the GPU may still read it.
+uint32_t RegisterBindlessDescriptor(BindlessTableHandle table, ResourceType type, uint64_t resourceHandle);
+void     FreeBindlessIndex(BindlessTableHandle table, ResourceType type, uint32_t index);
+
+// Drop cached sets that reference a destroyed view or sampler, or that came
+// from a destroyed pool. Sets still in a live pool are freed through the
+// deletion queue.
+void InvalidateCachedSets(ResourceType type, uint64_t resourceHandle);
+void DropCachedSetsFromPool(DescriptorPoolHandle pool);
 
 // Write a descriptor into a VkDescriptorSet
 // Used for the DESCRIPTOR_SETS path
@@ -716,6 +861,20 @@ struct DeviceInfo {
     int                                  index;
 };
 
+// Entry points of optional device extensions, loaded with vkGetDeviceProcAddr.
+// A pointer is null when its extension was not enabled.
+struct VulkanExtensionFunctions {
+    // VK_EXT_descriptor_buffer
+    PFN_vkGetDescriptorSetLayoutSizeEXT          getDescriptorSetLayoutSize          = nullptr;
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT getDescriptorSetLayoutBindingOffset = nullptr;
+    PFN_vkGetDescriptorEXT                       getDescriptor                       = nullptr;
+    PFN_vkCmdBindDescriptorBuffersEXT            cmdBindDescriptorBuffers            = nullptr;
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT       cmdSetDescriptorBufferOffsets       = nullptr;
+
+    // VK_KHR_push_descriptor
+    PFN_vkCmdPushDescriptorSetKHR cmdPushDescriptorSet = nullptr;
+};
+
 class VulkanDevice {
 public:
     VulkanDevice(VkInstance                      instance,
@@ -733,7 +892,26 @@ public:
     uint32_t                          computeFamily() const { return m_ComputeFamily; }
     uint32_t                          transferFamily() const { return m_TransferFamily; }
     const VkPhysicalDeviceLimits&     limits() const { return m_VkLimits; }
-    const VkPhysicalDeviceProperties& VkProperties() { return m_VkProperties; }
+    const VkPhysicalDeviceProperties& VkProperties() const { return m_VkProperties; }
+    const VulkanExtensionFunctions&   ext() const { return m_Ext; }
+
+    // Device and driver UUIDs, used to validate the on-disk pipeline cache
+    const VkPhysicalDeviceVulkan11Properties& vulkan11Properties() const { return m_Vulkan11Props; }
+    // Update-after-bind descriptor limits, used to size bindless tables
+    const VkPhysicalDeviceVulkan12Properties& vulkan12Properties() const { return m_Vulkan12Props; }
+
+    // VK_EXT_descriptor_buffer — descriptor sizes and offset alignment
+    bool hasDescriptorBuffer() const { return m_HasDescriptorBuffer; }
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& descriptorBufferProperties() const { return m_DescriptorBufferProps; }
+    // Bytes vkGetDescriptorEXT writes for one descriptor of `type`
+    uint32_t descriptorSize(VkDescriptorType type) const;
+
+    // VK_KHR_push_descriptor — otherwise push layouts are emulated
+    bool hasPushDescriptor() const { return m_HasPushDescriptor; }
+
+    // Lock for every vkQueue* call on `queue`. Families that fall back to the
+    // graphics family get its VkQueue, so wrappers sharing a handle share a lock.
+    std::mutex& queueMutex(VkQueue queue);
 
 private:
     DeviceInfo gatherDeviceInfo(VkPhysicalDevice device) const;
@@ -741,8 +919,10 @@ private:
     uint32_t   scoreDevice(const DeviceInfo& info) const;
     int        selectDevice(const std::vector<DeviceInfo>& devices) const;
     bool       isDeviceSuitable(VkPhysicalDevice device) const;
+    bool supportsExtension(const char* name) const;
     void createLogicalDevice(const std::vector<const char*>& requiredExtensions, const std::vector<const char*>& requiredLayers);
     void queryLimits();
+    void loadExtensionFunctions();
 
 private:
     VkInstance                 m_Instance       = VK_NULL_HANDLE;
@@ -757,6 +937,70 @@ private:
     uint32_t                   m_TransferFamily = UINT32_MAX;
     VkPhysicalDeviceLimits     m_VkLimits{};
     VkPhysicalDeviceProperties m_VkProperties{};
+    VulkanExtensionFunctions   m_Ext{};
+
+    VkPhysicalDeviceVulkan11Properties            m_Vulkan11Props{};
+    VkPhysicalDeviceVulkan12Properties            m_Vulkan12Props{};
+    bool                                          m_RobustBufferAccess  = false;
+    bool                                          m_HasDescriptorBuffer = false;
+    bool                                          m_HasPushDescriptor   = false;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT m_DescriptorBufferProps{};
+
+    std::mutex m_GraphicsQueueMutex;
+    std::mutex m_ComputeQueueMutex;
+    std::mutex m_TransferQueueMutex;
+};
+
+// Device-wide VkPipelineCache every pipeline is created through. With a path
+// it is seeded from that file and written back by save(); the file wraps the
+// driver's blob in a header naming the GPU and driver that produced it, and a
+// blob from any other is discarded rather than handed to the driver.
+class VulkanPipelineCache {
+public:
+    VulkanPipelineCache(const VulkanDevice& device, const char* path);
+    ~VulkanPipelineCache();
+
+    VulkanPipelineCache(const VulkanPipelineCache&)            = delete;
+    VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+
+    VkPipelineCache handle() const { return m_Cache; }
+
+    // Skips the write when nothing was added since the last load or save
+    bool save();
+
+private:
+    bool load(std::vector<uint8_t>& outBlob) const;
+
+    const VulkanDevice& m_Device;
+    std::string         m_Path;
+    VkPipelineCache     m_Cache     = VK_NULL_HANDLE;
+    uint64_t            m_SavedHash = 0; // hash of the blob on disk, 0 if none
+    std::mutex          m_SaveMutex;
+};
+
+// Worker threads behind CreateGraphicsPipeline(s)Async. Create infos are
+// built on the calling thread, so a job touches no resource pool; it only
+// runs vkCreateGraphicsPipelines against the shared pipeline cache.
+class VulkanPipelineCompiler {
+public:
+    explicit VulkanPipelineCompiler(uint32_t threadCount);
+    // Finishes every queued job before joining, so no compile is left pending
+    ~VulkanPipelineCompiler();
+
+    VulkanPipelineCompiler(const VulkanPipelineCompiler&)            = delete;
+    VulkanPipelineCompiler& operator=(const VulkanPipelineCompiler&) = delete;
+
+    void     submit(std::function<void()> job);
+    uint32_t workerCount() const { return (uint32_t)m_Workers.size(); }
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread>          m_Workers;
+    std::deque<std::function<void()>> m_Jobs;
+    std::mutex                        m_Mutex;
+    std::condition_variable           m_Wake;
+    bool                              m_Stop = false;
 };
 
 class VulkanAllocator {
@@ -790,76 +1034,78 @@ private:
     VmaAllocator m_Allocator = VK_NULL_HANDLE;
 };
 
-// Per-frame staging allocation
+// Staging allocation handed out by VulkanStagingAllocator. Every allocation
+// must be handed back with release() once the copy reading it is submitted.
 struct StagingAllocation {
-    VkBuffer buffer       = VK_NULL_HANDLE;
-    uint32_t offset       = 0;
-    uint32_t size         = 0;
-    uint8_t* mappedPtr    = nullptr;
-    uint64_t submissionID = 0; // Track when it was submitted
-};
-
-// Large staging buffer chunk
-struct StagingChunk {
-    VkBuffer      buffer           = VK_NULL_HANDLE;
-    VmaAllocation allocation       = VK_NULL_HANDLE;
-    uint8_t*      mappedPtr        = nullptr;
-    uint32_t      size             = 0;
-    uint32_t      currentOffset    = 0;
-    uint64_t      lastSubmissionID = 0; // Last submission that used this chunk
-
-    // Reset for reuse
-    void reset() {
-        currentOffset    = 0;
-        lastSubmissionID = 0;
-    }
-
-    // Check if there's enough space for an allocation
-    bool canAllocate(uint32_t requestedSize, uint32_t alignment = 256) const {
-        uint32_t alignedOffset = (currentOffset + alignment - 1) & ~(alignment - 1);
-        return (alignedOffset + requestedSize) <= size;
-    }
-
-    // Suballocate from this chunk
-    StagingAllocation allocate(uint32_t requestedSize, uint32_t alignment = 256) {
-        StagingAllocation alloc{};
-        uint32_t          alignedOffset = (currentOffset + alignment - 1) & ~(alignment - 1);
-        if (!(alignedOffset + requestedSize <= size)) {
-            RENDERX_ERROR(
-                "Staging allocation exceeds chunk size requested size {}, size {}", alignedOffset + requestedSize, size);
-        }
+    VkBuffer buffer    = VK_NULL_HANDLE;
+    uint32_t offset    = 0;
+    uint32_t size      = 0;
+    uint8_t* mappedPtr = nullptr;
 
-        alloc.buffer    = buffer;
-        alloc.offset    = alignedOffset;
-        alloc.size      = requestedSize;
-        alloc.mappedPtr = mappedPtr + alignedOffset;
-        currentOffset   = alignedOffset + requestedSize;
-        return alloc;
-    }
+    // [ringBegin, ringEnd) in the ring's monotonic byte stream, padding included
+    uint64_t      ringBegin = 0;
+    uint64_t      ringEnd   = 0;
+    VmaAllocation dedicated = VK_NULL_HANDLE; // oversized fallback, outside the ring
 };
 
+// One persistently mapped ring buffer shared by every uploader. allocate() is a
+// CAS on an atomic head, so producer threads never take a lock. release() tags
+// a range with the transfer-queue timeline value of the copy reading it, and
+// retire() advances the tail over completed ranges in ring order. Requests
+// larger than half the ring, or made while the ring is full of unreleased
+// ranges, get a dedicated buffer bounded by `dedicatedBudget`.
 class VulkanStagingAllocator {
 public:
-    VulkanStagingAllocator(VulkanContext& ctx, uint32_t chunkSize = 64 * 1024 * 1024); // 64MB default
+    VulkanStagingAllocator(VulkanContext& ctx,
+                           uint64_t       ringSize        = 64 * 1024 * 1024,
+                           uint64_t       dedicatedBudget = 256 * 1024 * 1024);
     ~VulkanStagingAllocator();
+
     StagingAllocation allocate(uint32_t size, uint32_t alignment = 256);
-    void              submit(uint64_t submissionID);
-    void              retire(uint64_t completedSubmissionID);
+    // `transferValue` is the transfer timeline value of the last copy reading
+    // the allocation; 0 if that copy has already completed
+    void              release(const StagingAllocation& allocation, uint64_t transferValue);
+    void              retire(uint64_t completedTransferValue);
     void              cleanup();
 
-private:
-    StagingChunk* getOrCreateChunk(uint32_t requiredSize);
-    StagingChunk  createChunk(uint32_t size);
-    void          destroyChunk(StagingChunk& chunk);
+    uint64_t capacity() const { return m_Capacity; }
+    uint64_t usedBytes() const { return m_Head.load(std::memory_order_relaxed) - m_Tail.load(std::memory_order_relaxed); }
 
 private:
-    VulkanContext&           m_Ctx;
-    uint32_t                 m_ChunkSize;
-    StagingChunk*            m_CurrentChunk = nullptr;
-    std::deque<StagingChunk> m_InFlightChunks;
-    std::deque<StagingChunk> m_FreeChunks;
-    std::deque<StagingChunk> m_AllChunks;
-    std::mutex               m_Mutex;
+    struct Released {
+        uint64_t ringEnd       = 0;
+        uint64_t transferValue = 0;
+    };
+
+    struct Dedicated {
+        VkBuffer      buffer        = VK_NULL_HANDLE;
+        VmaAllocation allocation    = VK_NULL_HANDLE;
+        uint32_t      size          = 0;
+        uint64_t      transferValue = 0;
+    };
+
+    StagingAllocation allocateDedicated(uint32_t size);
+    // Frees ring space for a blocked producer; false if nothing can be freed
+    // without waiting on another producer's release()
+    bool              reclaim();
+    void              retireLocked(uint64_t completedTransferValue);
+
+    VulkanContext& m_Ctx;
+    VkBuffer       m_Buffer     = VK_NULL_HANDLE;
+    VmaAllocation  m_Allocation = VK_NULL_HANDLE;
+    uint8_t*       m_Mapped     = nullptr;
+    uint64_t       m_Capacity   = 0;
+
+    std::atomic<uint64_t> m_Head{0};
+    std::atomic<uint64_t> m_Tail{0};
+
+    uint64_t              m_DedicatedBudget = 0;
+    std::atomic<uint64_t> m_DedicatedBytes{0};
+
+    std::map<uint64_t, Released> m_Released; // keyed by ringBegin
+    std::vector<Dedicated>       m_DedicatedReleased;
+    std::mutex                   m_RetireMutex;
+    uint64_t                     m_StuckTail = UINT64_MAX; // last tail reported as pinned
 };
 
 struct ImmediateUploadContext {
@@ -886,14 +1132,23 @@ private:
     void            endSingleTimeCommands(VkCommandBuffer cmd);
 
 private:
-    VulkanContext&         m_Ctx;
-    ImmediateUploadContext m_ImmediateCtx;
-    std::mutex             m_Mutex; // Protect immediate uploads
+    VulkanContext&                 m_Ctx;
+    ImmediateUploadContext         m_ImmediateCtx;
+    std::vector<StagingAllocation> m_BatchStaging; // released by endBatch()
+    std::mutex                     m_Mutex;        // Protect immediate uploads
 };
 
+// Load-time uploads for CreateBuffer/CreateTexture initial data. Data is
+// written straight into one of CHUNK_COUNT persistently mapped staging chunks;
+// when a chunk fills, its copies are submitted on the transfer queue and
+// packing continues in the next chunk while the GPU drains the previous one.
+// Peak staging memory is CHUNK_COUNT * chunkSize no matter how large the scene.
 class VulkanLoadTimeStagingUploader {
 public:
-    explicit VulkanLoadTimeStagingUploader(VulkanContext& ctx);
+    static constexpr uint32_t CHUNK_COUNT        = 2;
+    static constexpr uint32_t DEFAULT_CHUNK_SIZE = 64 * 1024 * 1024;
+
+    explicit VulkanLoadTimeStagingUploader(VulkanContext& ctx, uint32_t chunkSize = DEFAULT_CHUNK_SIZE);
     ~VulkanLoadTimeStagingUploader();
 
     // Non-copyable, non-movable
@@ -902,22 +1157,32 @@ public:
     VulkanLoadTimeStagingUploader(VulkanLoadTimeStagingUploader&&)                 = delete;
     VulkanLoadTimeStagingUploader& operator=(VulkanLoadTimeStagingUploader&&)      = delete;
 
-    // Queue a buffer upload — data is copied to CPU-side staging immediately
+    // Queue a buffer upload — data is copied into mapped staging immediately.
+    // Uploads larger than a chunk are split across chunks. Across queue
+    // families the written range is released to the graphics family.
     void uploadBuffer(VkBuffer dst, const void* data, uint32_t size, uint32_t dstOffset = 0);
 
-    // Queue a texture upload — data is copied to CPU-side staging immediately
-    void uploadTexture(VkImage dst, const void* data, uint32_t size, const TextureCopy& region);
-
-    // Execute all queued uploads in a single GPU submission, then free staging memory.
-    // Call once after all assets are queued. Safe to call on empty queue (no-op).
+    // Queue a texture upload — data is copied into mapped staging immediately.
+    // A texture larger than a chunk gets a one-off staging buffer. A mipSource
+    // upload is left in TRANSFER_SRC_OPTIMAL for generateMips. Either way the
+    // subresource is released to the graphics family across queue families.
+    // Returns false if nothing was queued.
+    bool uploadTexture(
+        VkImage dst, VkFormat format, const void* data, uint32_t size, const TextureCopy& region, bool mipSource = false);
+
+    // Queue blit-chain generation of levels 1..mipLevels-1 from level 0, which
+    // must already have been queued with uploadTexture as a mipSource. Every
+    // request is recorded into one graphics command list at the next flush.
+    void generateMips(VkImage image, VkExtent3D extent, uint32_t mipLevels, uint32_t arrayLayers, VkFilter filter);
+
+    // Submits the partially filled chunk, generates queued mip chains and waits
+    // for every outstanding copy. Safe to call with nothing queued (no-op).
     void flush();
 
-    // Returns total bytes queued so far (before flush)
-    uint32_t pendingBytes() const { return m_TotalSize; }
+    // Returns bytes queued but not yet submitted
+    uint32_t pendingBytes() const { return m_Chunks[m_Current].head; }
 
 private:
-    uint32_t pushData(const void* data, uint32_t size, uint32_t alignment = 256);
-
     struct BufferUpload {
         VkBuffer dst;
         uint32_t stagingOffset;
@@ -927,21 +1192,66 @@ private:
 
     struct TextureUpload {
         VkImage     dst;
+        VkFormat    format;
         uint32_t    stagingOffset;
         uint32_t    size;
         TextureCopy region;
+        bool        mipSource; // handed to the graphics queue for generateMips
     };
 
-    VulkanContext& m_Ctx;
+    struct MipRequest {
+        VkImage    image;
+        VkExtent3D extent;
+        uint32_t   mipLevels;
+        uint32_t   arrayLayers;
+        VkFilter   filter;
+    };
 
-    VkCommandPool   m_Pool  = VK_NULL_HANDLE;
-    VkCommandBuffer m_Cmd   = VK_NULL_HANDLE;
-    VkFence         m_Fence = VK_NULL_HANDLE;
+    struct Chunk {
+        VkBuffer      buffer     = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        uint8_t*      mapped     = nullptr;
+        uint32_t      size       = 0;
+        uint32_t      head       = 0;
+        CommandList*  cmd        = nullptr;
+        uint64_t      value      = 0; // transfer timeline value of the last submit
+
+        std::vector<BufferUpload>  bufferUploads;
+        std::vector<TextureUpload> textureUploads;
+    };
 
-    std::vector<uint8_t>       m_CPUData; // all upload data packed linearly
-    std::vector<BufferUpload>  m_BufferUploads;
-    std::vector<TextureUpload> m_TextureUploads;
-    uint32_t                   m_TotalSize = 0;
+    bool createChunk(Chunk& chunk, uint32_t size);
+    void destroyChunk(Chunk& chunk);
+    // Returns an offset in the current chunk with `size` bytes free, submitting
+    // and rotating chunks as needed
+    uint32_t reserve(uint32_t size, uint32_t alignment);
+    // Records and submits every copy staged in `chunk`
+    void submit(Chunk& chunk);
+    // Moves to the next chunk, waiting until the GPU is done with it
+    void advance();
+    // Records the acquire half of every release made by submit() and every
+    // queued mip chain on the graphics queue behind `transferValue`
+    uint64_t submitGraphics(uint64_t transferValue);
+
+    VulkanContext&          m_Ctx;
+    CommandAllocator*       m_Allocator = nullptr;
+    Chunk                   m_Chunks[CHUNK_COUNT];
+    std::vector<Chunk>      m_Oversized;              // one-off chunks for textures larger than a chunk
+    CommandAllocator*       m_MipAllocator = nullptr; // graphics: transfer queues cannot blit
+    CommandList*            m_MipCmd       = nullptr;
+    std::vector<MipRequest> m_MipRequests;
+    uint32_t                m_Current                = 0;
+    uint64_t                m_Submitted              = 0; // bytes submitted since the last flush
+    bool                    m_NeedsOwnershipTransfer = false;
+    std::mutex              m_Mutex;
+
+    // Acquire halves of the releases recorded by submit(), for the next flush
+    std::vector<VkBufferMemoryBarrier2> m_AcquireBufferBarriers;
+    std::vector<VkImageMemoryBarrier2>  m_AcquireImageBarriers;
+
+    // Scratch reused by submit()
+    std::vector<VkImageMemoryBarrier2>  m_ImageBarriers;
+    std::vector<VkBufferMemoryBarrier2> m_BufferBarriers;
 };
 
 struct DeferredUpload {
@@ -949,37 +1259,78 @@ struct DeferredUpload {
     BufferHandle      dstBuffer;
     uint32_t          dstOffset;
     uint32_t          size;
-    uint64_t          submissionID;
 };
 
 struct DeferredTextureUpload {
     StagingAllocation staging;
     TextureHandle     dstTexture;
     TextureCopy       region;
-    uint64_t          submissionID;
 };
 
+// Asynchronous uploads on the dedicated transfer queue. upload*() copies into
+// the staging ring straight away; flush() records every pending copy into one
+// pooled transfer list, submits it without waiting and returns its transfer
+// Timeline, which graphics submits wait on through
+// QueueDependency(QueueType::TRANSFER, timeline). When the transfer queue
+// lives in another family, ownership is released on the transfer list and
+// acquired by a small graphics list submitted right behind it, so later
+// graphics work never sees a resource still owned by the transfer family.
 class VulkanDeferredUploader {
 public:
     VulkanDeferredUploader(VulkanContext& ctx);
     ~VulkanDeferredUploader();
-    void     uploadBuffer(BufferHandle dstBuffer, const void* data, uint32_t size, uint32_t dstOffset = 0);
-    void     uploadTexture(TextureHandle dstTexture, const void* data, uint32_t size, const TextureCopy& region);
+    // False if nothing was queued: invalid request or no staging memory
+    bool     uploadBuffer(BufferHandle dstBuffer, const void* data, uint32_t size, uint32_t dstOffset = 0);
+    bool     uploadTexture(TextureHandle dstTexture, const void* data, uint32_t size, const TextureCopy& region);
     Timeline flush();
     void     retire(uint64_t completedSubmission);
 
 private:
+    struct InFlight {
+        CommandList* transfer     = nullptr;
+        CommandList* acquire      = nullptr; // graphics list, only across families
+        CommandList* reclaim      = nullptr; // graphics release of live subresources, precedes `acquire`
+        uint64_t     value        = 0;       // transfer timeline value
+        uint64_t     acquireValue = 0;       // graphics timeline value of `acquire`
+    };
+
+    // A destination range written by a copy in the flush being recorded
+    struct CopyWrite {
+        uint64_t resource; // VkBuffer or VkImage
+        uint64_t begin;    // bytes for buffers, subresource indices for images
+        uint64_t end;
+    };
+
+    // Returns lists whose submissions have completed to their allocators
+    void recycle(uint64_t completedTransferValue);
+    // Puts a barrier before a copy whose destination overlaps an earlier copy
+    void orderCopy(VkCommandBuffer cmd, uint64_t resource, uint64_t begin, uint64_t end);
+
     VulkanContext&                     m_Ctx;
+    CommandAllocator*                  m_TransferAllocator      = nullptr;
+    CommandAllocator*                  m_AcquireAllocator       = nullptr;
+    bool                               m_NeedsOwnershipTransfer = false;
     std::vector<DeferredUpload>        m_PendingBufferUploads;
     std::vector<DeferredTextureUpload> m_PendingTextureUploads;
+    std::deque<InFlight>               m_InFlight;
     std::mutex                         m_Mutex;
+
+    // Scratch reused by flush()
+    std::vector<VkBufferMemoryBarrier2> m_BufferBarriers;
+    std::vector<VkImageMemoryBarrier2>  m_ImageBarriers;
+    std::vector<VkImageMemoryBarrier2>  m_ReclaimBarriers;
+    std::vector<VkBufferMemoryBarrier2> m_ReclaimBufferBarriers;
+    std::vector<CopyWrite>              m_CopyWrites;
 };
 
 class VulkanCommandList : public CommandList {
 public:
     VulkanCommandList(VkCommandBuffer cmdBuffer, QueueType queueType)
         : m_CommandBuffer(cmdBuffer),
-          m_QueueType(queueType) {}
+          m_QueueType(queueType) {
+        resetState();
+    }
+    ~VulkanCommandList();
     void open() override;
     void close() override;
     void setPipeline(const PipelineHandle& pipeline) override;
@@ -1026,8 +1377,21 @@ public:
     // friends
     friend class VulkanCommandAllocator;
     friend class VulkanCommandQueue;
+    friend class VulkanDeferredUploader;
+    friend class VulkanLoadTimeStagingUploader;
 
 private:
+    // Clears per-recording CPU state so a pooled list can be handed out again
+    void resetState();
+    // Position of `heap` in the last setDescriptorHeaps call, UINT32_MAX if absent
+    uint32_t boundHeapIndex(DescriptorHeapHandle heap) const;
+    // Records `writes` (dstSet ignored) into the push set of `layout`
+    void pushWrites(const VulkanPipelineLayout& layout, VkWriteDescriptorSet* writes, uint32_t count);
+    void pushInlineBuffer(uint32_t slot, BufferHandle buf, uint64_t offset, VkDescriptorType type);
+    // Remembers what vkCmdBindDescriptorSets put at `slot`; `layout` null for
+    // sets with no dynamic descriptors or that setDynamicOffset cannot rebind
+    void trackBoundSet(uint32_t slot, VkDescriptorSet set, const VulkanSetLayout* layout);
+
     // TODO----------------------------------------
     //  void TransitionTexture(
     //  	TextureHandle handle,
@@ -1071,42 +1435,79 @@ private:
     std::vector<VkImageMemoryBarrier2>  m_ImageBarriers;
     std::vector<VkBufferMemoryBarrier2> m_BufferBarriers;
 
+    // Descriptor heaps bound by setDescriptorHeaps, in buffer-index order
+    DescriptorHeapHandle m_BoundHeaps[2];
+    uint32_t             m_BoundHeapCount = 0;
+
+    // Classic sets bound per slot, for setDynamicOffset to rebind
+    struct BoundSet {
+        VkDescriptorSet vkSet            = VK_NULL_HANDLE;
+        uint32_t        dynamicCount     = 0;
+        uint32_t        dynamicAlignment = 1;
+    };
+    static constexpr uint32_t MAX_BOUND_SETS = 32;
+    BoundSet                  m_BoundSets[MAX_BOUND_SETS];
+
+    // Push descriptor emulation without VK_KHR_push_descriptor: every push
+    // takes a set from this LINEAR pool, reset by open(), seeded from the
+    // previous push set so untouched bindings keep their values
+    static constexpr uint32_t PUSH_FALLBACK_SETS = 64;
+    DescriptorPoolHandle      m_PushFallbackPool;
+    VkDescriptorSet           m_PushFallbackSet = VK_NULL_HANDLE;
+    SetLayoutHandle           m_PushFallbackLayout;
+
     // Currently bound vertex/index buffers (handles) and offsets
     BufferHandle m_VertexBuffer;
     uint64_t     m_VertexBufferOffset = 0;
     BufferHandle m_IndexBuffer;
     uint64_t     m_IndexBufferOffset = 0;
+
+    // Set while the list sits on its allocator's free stack
+    bool m_Free = false;
 };
 
+// Owns every VulkanCommandList (and its VkCommandBuffer) it ever hands out.
+// Free() and Reset() return lists to the free stack instead of releasing them,
+// so steady-state recording performs no driver or heap allocations.
 class VulkanCommandAllocator : public CommandAllocator {
 public:
-    VulkanCommandAllocator(VkCommandPool pool, VkDevice device, const char* debugName = nullptr)
-        : m_device(device),
-          m_Pool(pool) {};
+    VulkanCommandAllocator(VkCommandPool pool, VkDevice device, QueueType queueType, const char* debugName = nullptr)
+        : m_DebugName(debugName),
+          m_QueueType(queueType),
+          m_Pool(pool),
+          m_device(device) {};
 
     ~VulkanCommandAllocator() = default;
     CommandList* Allocate() override;
+    void         AllocateMany(uint32_t count, CommandList** outLists) override;
     void         Free(CommandList* list) override;
     void         Reset(CommandList* list) override;
     void         Reset() override;
     friend class VulkanCommandQueue;
 
 private:
+    // Allocates `count` new command buffers in one vkAllocateCommandBuffers call
+    // and pushes their lists onto the free stack.
+    void grow(uint32_t count);
+
+    static constexpr uint32_t MIN_GROW = 4;
+
     const char*   m_DebugName;
     QueueType     m_QueueType;
     VkCommandPool m_Pool;
     VkDevice      m_device;
+
+    std::vector<std::unique_ptr<VulkanCommandList>> m_Lists;
+    std::vector<VulkanCommandList*>                 m_FreeLists;
+    std::vector<VkCommandBuffer>                    m_GrowScratch;
 };
 
 class VulkanCommandQueue : public CommandQueue {
 public:
-    VulkanCommandQueue(VkDevice device, VkQueue queue, uint32_t family, QueueType type);
+    VulkanCommandQueue(VkDevice device, VkQueue queue, uint32_t family, QueueType type, std::mutex& submitMutex);
     ~VulkanCommandQueue();
 
 private:
-    void        addWait(VkSemaphore semaphore, uint64_t value, VkPipelineStageFlags stage);
-    void        addWait2(VkSemaphore semaphore, uint64_t value, VkPipelineStageFlags2 stage);
-    void        addSignal2(VkSemaphore semaphore, uint64_t value, VkPipelineStageFlags2 stage);
     VkQueue     Queue();
     VkSemaphore Semaphore() { return m_TimelineSemaphore; }
 
@@ -1117,19 +1518,13 @@ private:
 
     VkSemaphore m_TimelineSemaphore = VK_NULL_HANDLE;
 
-    uint64_t m_Submitted = 0;
-    uint64_t m_Completed = 0;
-
-    uint32_t              m_WaitCount = 0;
-    uint64_t              m_WaitValues[4];
-    VkSemaphore           m_WaitSemaphores[4];
-    VkPipelineStageFlags  m_WaitStages[4];
-    VkSemaphoreSubmitInfo m_WaitInfos[4];
-
-    VkSemaphore           m_SignalSemaphores[2];
-    uint64_t              m_SignalValues[2];
-    VkSemaphoreSubmitInfo m_SignalInfos[2];
-    uint32_t              m_SignalCount = 0;
+    // Submit() builds its semaphore lists on the stack; the only shared state
+    // is the timeline counter and the VkQueue itself (externally synchronized).
+    // The lock is the device's per-VkQueue mutex, shared with any other
+    // wrapper whose family resolved to the same queue.
+    std::mutex&           m_SubmitMutex;
+    std::atomic<uint64_t> m_Submitted{0};
+    std::atomic<uint64_t> m_Completed{0};
     friend class VulkanSwapchain;
 
 public:
@@ -1143,6 +1538,179 @@ public:
     Timeline          Completed() override;
     Timeline          Submitted() const override;
     float             TimestampFrequency() const override;
+
+    // Raw submit and present for paths outside Submit(). They take the same
+    // lock, since the VkQueue is externally synchronized; neither advances
+    // the timeline.
+    void     SubmitUntracked(const VkSubmitInfo& info, VkFence fence);
+    VkResult Present(const VkPresentInfoKHR& info);
+};
+
+// Destroys Vulkan objects only after every queue has finished the work that was
+// submitted before they were released. Entries are tagged with each queue's
+// submitted timeline value, so they retire strictly in push order.
+class VulkanDeletionQueue {
+public:
+    VulkanDeletionQueue(VulkanContext& ctx);
+    ~VulkanDeletionQueue();
+
+    void destroyBuffer(VkBuffer buffer, VmaAllocation allocation);
+    void destroyImage(VkImage image, VmaAllocation allocation);
+    void destroyImageView(VkImageView view);
+    void destroySampler(VkSampler sampler);
+    void releaseBindlessIndex(BindlessTableHandle table, ResourceType type, uint32_t index);
+    void freeSet(DescriptorPoolHandle pool, SetHandle set);
+    void destroyDescriptorPool(VkDescriptorPool pool);
+    void destroySetLayout(SetLayoutHandle layout);
+
+    // Destroys everything the GPU is done with. Runs on the frame thread only:
+    // FrameContext::BeginFrame calls it, and so does Swapchain::Present for
+    // apps that drive frames without a FrameContext.
+    void retire();
+    // Destroys everything; the caller guarantees the device is idle
+    void flush();
+
+private:
+    enum class Kind : uint8_t {
+        BUFFER,
+        IMAGE,
+        IMAGE_VIEW,
+        SAMPLER,
+        BINDLESS_INDEX,
+        DESCRIPTOR_SET,
+        DESCRIPTOR_POOL,
+        SET_LAYOUT
+    };
+
+    struct Entry {
+        Kind                 kind;
+        VkBuffer             buffer     = VK_NULL_HANDLE;
+        VkImage              image      = VK_NULL_HANDLE;
+        VkImageView          view       = VK_NULL_HANDLE;
+        VkSampler            sampler    = VK_NULL_HANDLE;
+        VmaAllocation        allocation = VK_NULL_HANDLE;
+        BindlessTableHandle  bindlessTable;
+        ResourceType         bindlessType  = ResourceType::TEXTURE_SRV;
+        uint32_t             bindlessIndex = 0;
+        DescriptorPoolHandle setPool;
+        SetHandle            set;
+        VkDescriptorPool     descriptorPool = VK_NULL_HANDLE;
+        SetLayoutHandle      setLayout;
+        uint64_t             graphics = 0;
+        uint64_t             compute  = 0;
+        uint64_t             transfer = 0;
+    };
+
+    void push(Entry entry);
+    void retireLocked();
+    void destroy(const Entry& entry);
+
+    VulkanContext&    m_Ctx;
+    std::deque<Entry> m_Entries;
+    std::mutex        m_Mutex;
+};
+
+class VulkanTransientAllocator : public TransientAllocator {
+public:
+    VulkanTransientAllocator(VulkanContext& ctx, const TransientAllocatorDesc& desc);
+    ~VulkanTransientAllocator();
+
+    TransientAllocation allocate(uint64_t size, uint64_t alignment = 0) override;
+    void                BeginFrame() override;
+    void                EndFrame(Timeline lastUse) override;
+    BufferHandle        GetBuffer() const override { return m_Buffer; }
+    uint64_t            GetBytesPerFrame() const override { return m_RegionSize; }
+    uint64_t            GetUsedBytes() const override;
+
+private:
+    // Last value each queue was signaled with while the region was in use
+    struct RegionUse {
+        uint64_t graphics = 0;
+        uint64_t compute  = 0;
+        uint64_t transfer = 0;
+    };
+
+    VulkanContext&         m_Ctx;
+    BufferHandle           m_Buffer;
+    uint8_t*               m_Mapped      = nullptr;
+    uint64_t               m_RegionSize  = 0;
+    uint64_t               m_MinAlign    = 1;
+    uint32_t               m_RegionIndex = 0;
+    std::vector<RegionUse> m_Regions;
+    std::atomic<uint64_t>  m_Head{0}; // offset within the current region
+    std::atomic<bool>      m_OverflowReported{false};
+};
+
+class VulkanGeometryPool : public GeometryPool {
+public:
+    VulkanGeometryPool(VulkanContext& ctx, const GeometryPoolDesc& desc);
+    ~VulkanGeometryPool();
+
+    GeometryAllocation allocate(uint32_t vertexCount, uint32_t indexCount) override;
+    void               upload(const GeometryAllocation& allocation, const void* vertices, const void* indices) override;
+    void               free(GeometryAllocation& allocation) override;
+    BufferHandle       GetVertexBuffer() const override { return m_VertexBuffer; }
+    BufferHandle       GetIndexBuffer() const override { return m_IndexBuffer; }
+    uint32_t           GetVertexStride() const override { return m_VertexStride; }
+    Format             GetIndexFormat() const override { return m_IndexFormat; }
+    uint32_t           GetUsedVertices() const override;
+    uint32_t           GetUsedIndices() const override;
+
+private:
+    struct Retired {
+        VmaVirtualAllocation vertexRange = VK_NULL_HANDLE;
+        VmaVirtualAllocation indexRange  = VK_NULL_HANDLE;
+        uint64_t             graphics    = 0;
+    };
+
+    // Returns freed ranges whose last draws have completed. Caller holds m_Mutex.
+    void retire();
+
+    VulkanContext&      m_Ctx;
+    BufferHandle        m_VertexBuffer;
+    BufferHandle        m_IndexBuffer;
+    VmaVirtualBlock     m_VertexBlock  = VK_NULL_HANDLE; // units of vertices
+    VmaVirtualBlock     m_IndexBlock   = VK_NULL_HANDLE; // units of indices
+    uint32_t            m_VertexStride = 0;
+    uint32_t            m_IndexSize    = 4;
+    Format              m_IndexFormat  = Format::UINT32;
+    std::deque<Retired> m_Retired;
+    mutable std::mutex  m_Mutex;
+};
+
+class VulkanFrameContext : public FrameContext {
+public:
+    VulkanFrameContext(VulkanContext& ctx, const FrameContextDesc& desc);
+    ~VulkanFrameContext();
+
+    const FrameInfo& BeginFrame() override;
+    Timeline         EndFrame(const QueueDependency* waits = nullptr, uint32_t waitCount = 0) override;
+    const FrameInfo& GetCurrentFrame() const override { return m_Current; }
+    uint32_t         GetFramesInFlight() const override { return (uint32_t)m_Slots.size(); }
+    Timeline         GetFrameTimeline(uint32_t frameIndex) const override { return m_Slots[frameIndex].timeline; }
+
+private:
+    struct Slot {
+        CommandAllocator*                 graphicsAllocator = nullptr;
+        CommandAllocator*                 computeAllocator  = nullptr;
+        std::vector<DescriptorPoolHandle> linearPools;
+        Timeline                          timeline;     // the frame's graphics submit
+        uint64_t                          compute  = 0; // compute work submitted before EndFrame
+        uint64_t                          transfer = 0; // transfer work submitted before EndFrame
+    };
+
+    // Blocks until every queue the slot's frame submitted to is past it
+    void waitSlot(const Slot& slot) const;
+
+    VulkanContext&            m_Ctx;
+    Swapchain*                m_Swapchain = nullptr;
+    VulkanTransientAllocator* m_Transient = nullptr;
+    std::vector<Slot>         m_Slots;
+    FrameInfo                 m_Current{};
+    uint32_t                  m_SlotIndex         = 0;
+    uint64_t                  m_FrameNumber       = 0;
+    bool                      m_InFrame           = false;
+    uint32_t                  m_CachedSetLifetime = 0;
 };
 
 struct VulkanContext {
@@ -1159,6 +1727,9 @@ struct VulkanContext {
     VulkanImmediateUploader*       immediateUploader;
     VulkanDeferredUploader*        deferredUploader;
     VulkanLoadTimeStagingUploader* loadTimeStagingUploader;
+    VulkanDeletionQueue*           deletionQueue;
+    VulkanPipelineCache*           pipelineCache;
+    VulkanPipelineCompiler*        pipelineCompiler; // created by the first async pipeline
 };
 
 // Global Resource Pools
@@ -1176,10 +1747,14 @@ extern ResourcePool<VulkanSetLayout, SetLayoutHandle>           g_SetLayoutPool;
 extern ResourcePool<VulkanDescriptorPool, DescriptorPoolHandle> g_DescriptorPoolPool;
 extern ResourcePool<VulkanDescriptorHeap, DescriptorHeapHandle> g_DescriptorHeapPool;
 extern ResourcePool<VulkanSampler, SamplerHandle>               g_SamplerPool;
+extern ResourcePool<VulkanBindlessTable, BindlessTableHandle>   g_BindlessTablePool;
 
 // Global Hash Storage
 // TODO implement better cache managenet
 extern std::unordered_map<Hash64, BufferViewHandle> g_BufferViewCache;
+extern std::unordered_multimap<Hash64, VulkanCachedSet>    g_SetCache;
+extern std::unordered_multimap<Hash64, VulkanCachedSetRef> g_SetCacheRefs; // resource key -> g_SetCache entry
+extern std::mutex                                          g_SetCacheMutex; // guards both maps
 
 // Context & Cleanup Functions
 VulkanContext& GetVulkanContext();
@@ -1187,22 +1762,11 @@ void           freeAllVulkanResources();
 void           VKShutdownCommon();
 
 // Create a Descriptor Pool
-inline VkDescriptorPool CreateDescriptorPool(const DescriptorPoolSizes& sizes, bool allowFree, bool updateAfterBind) {
-    std::vector<VkDescriptorPoolSize> poolSizes;
-    auto&                             ctx = GetVulkanContext();
-
-    if (sizes.uniformBufferCount > 0)
-        poolSizes.push_back({VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, sizes.uniformBufferCount});
-    if (sizes.storageBufferCount > 0)
-        poolSizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, sizes.storageBufferCount});
-    if (sizes.sampledImageCount > 0)
-        poolSizes.push_back({VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, sizes.sampledImageCount});
-    if (sizes.storageImageCount > 0)
-        poolSizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, sizes.storageImageCount});
-    if (sizes.samplerCount > 0)
-        poolSizes.push_back({VK_DESCRIPTOR_TYPE_SAMPLER, sizes.samplerCount});
-    if (sizes.combinedImageSamplerCount > 0)
-        poolSizes.push_back({VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, sizes.combinedImageSamplerCount});
+inline VkDescriptorPool CreateDescriptorPool(const VkDescriptorPoolSizeList& sizes,
+                                             uint32_t                        maxSets,
+                                             bool                            allowFree,
+                                             bool                            updateAfterBind) {
+    auto& ctx = GetVulkanContext();
 
     VkDescriptorPoolCreateFlags flags = 0;
     if (allowFree)
@@ -1212,9 +1776,9 @@ inline VkDescriptorPool CreateDescriptorPool(const DescriptorPoolSizes& sizes, b
     VkDescriptorPoolCreateInfo poolInfo = {};
     poolInfo.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     poolInfo.flags                      = flags;
-    poolInfo.maxSets                    = sizes.maxSets;
-    poolInfo.poolSizeCount              = static_cast<uint32_t>(poolSizes.size());
-    poolInfo.pPoolSizes                 = poolSizes.data();
+    poolInfo.maxSets                    = maxSets;
+    poolInfo.poolSizeCount              = sizes.count;
+    poolInfo.pPoolSizes                 = sizes.sizes;
 
     VkDescriptorPool pool;
     VkResult         result = vkCreateDescriptorPool(ctx.device->logical(), &poolInfo, nullptr, &pool);
@@ -1222,6 +1786,24 @@ inline VkDescriptorPool CreateDescriptorPool(const DescriptorPoolSizes& sizes, b
     return (result == VK_SUCCESS) ? pool : VK_NULL_HANDLE;
 }
 
+// Same count of every type, for pools not tied to one layout
+inline VkDescriptorPool CreateDescriptorPool(const DescriptorPoolSizes& sizes, bool allowFree, bool updateAfterBind) {
+    VkDescriptorPoolSizeList list;
+    auto                     add = [&](VkDescriptorType type, uint32_t count) {
+        if (count > 0)
+            list.sizes[list.count++] = {type, count};
+    };
+    add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, sizes.uniformBufferCount);
+    add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, sizes.storageBufferCount);
+    add(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, sizes.sampledImageCount);
+    add(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, sizes.storageImageCount);
+    add(VK_DESCRIPTOR_TYPE_SAMPLER, sizes.samplerCount);
+    add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, sizes.combinedImageSamplerCount);
+    add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, sizes.uniformBufferDynamicCount);
+    add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, sizes.storageBufferDynamicCount);
+    return CreateDescriptorPool(list, sizes.maxSets, allowFree, updateAfterBind);
+}
+
 // VMA Memory Allocation Conversion
 /// Convert RenderX MemoryType to VMA allocation info
 inline VmaAllocationCreateInfo ToVmaAllocationCreateInfo(MemoryType type, BufferFlags flags) {
@@ -1463,6 +2045,10 @@ inline VkFormat ToVulkanFormat(Format format) {
         return VK_FORMAT_D24_UNORM_S8_UINT;
     case Format::D32_SFLOAT:
         return VK_FORMAT_D32_SFLOAT;
+    case Format::BC1_RGB_UNORM:
+        return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+    case Format::BC1_RGB_SRGB:
+        return VK_FORMAT_BC1_RGB_SRGB_BLOCK;
     case Format::BC1_RGBA_UNORM:
         return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
     case Format::BC1_RGBA_SRGB:
@@ -1471,6 +2057,42 @@ inline VkFormat ToVulkanFormat(Format format) {
         return VK_FORMAT_BC3_UNORM_BLOCK;
     case Format::BC3_SRGB:
         return VK_FORMAT_BC3_SRGB_BLOCK;
+    case Format::BC4_UNORM:
+        return VK_FORMAT_BC4_UNORM_BLOCK;
+    case Format::BC4_SNORM:
+        return VK_FORMAT_BC4_SNORM_BLOCK;
+    case Format::BC5_UNORM:
+        return VK_FORMAT_BC5_UNORM_BLOCK;
+    case Format::BC5_SNORM:
+        return VK_FORMAT_BC5_SNORM_BLOCK;
+    case Format::BC6H_UFLOAT:
+        return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+    case Format::BC6H_SFLOAT:
+        return VK_FORMAT_BC6H_SFLOAT_BLOCK;
+    case Format::BC7_UNORM:
+        return VK_FORMAT_BC7_UNORM_BLOCK;
+    case Format::BC7_SRGB:
+        return VK_FORMAT_BC7_SRGB_BLOCK;
+    case Format::ETC2_RGB8_UNORM:
+        return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+    case Format::ETC2_RGB8_SRGB:
+        return VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK;
+    case Format::ETC2_RGBA8_UNORM:
+        return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+    case Format::ETC2_RGBA8_SRGB:
+        return VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK;
+    case Format::ASTC_4x4_UNORM:
+        return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+    case Format::ASTC_4x4_SRGB:
+        return VK_FORMAT_ASTC_4x4_SRGB_BLOCK;
+    case Format::ASTC_6x6_UNORM:
+        return VK_FORMAT_ASTC_6x6_UNORM_BLOCK;
+    case Format::ASTC_6x6_SRGB:
+        return VK_FORMAT_ASTC_6x6_SRGB_BLOCK;
+    case Format::ASTC_8x8_UNORM:
+        return VK_FORMAT_ASTC_8x8_UNORM_BLOCK;
+    case Format::ASTC_8x8_SRGB:
+        return VK_FORMAT_ASTC_8x8_SRGB_BLOCK;
 
     case Format::UINT32: {
         RENDERX_ERROR("Using indesx type as the buffer format");
@@ -1740,6 +2362,10 @@ inline VkDescriptorType ToVulkanDescriptorType(ResourceType type) {
         return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     case ResourceType::ACCELERATION_STRUCTURE:
         return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+    case ResourceType::DYNAMIC_CONSTANT_BUFFER:
+        return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    case ResourceType::DYNAMIC_STORAGE_BUFFER:
+        return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
     default:
         return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     }
@@ -1753,10 +2379,11 @@ inline VkBufferUsageFlags ToVulkanBufferUsage(BufferFlags flags) {
         usage |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
     if (Has(flags, BufferFlags::INDEX))
         usage |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    // Descriptor buffers and inline descriptors address these by device address
     if (Has(flags, BufferFlags::UNIFORM))
-        usage |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        usage |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
     if (Has(flags, BufferFlags::STORAGE))
-        usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
     if (Has(flags, BufferFlags::INDIRECT))
         usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
     if (Has(flags, BufferFlags::TRANSFER_SRC))
@@ -1854,6 +2481,38 @@ inline VkImageAspectFlags GetImageAspect(Format format) {
     return VK_IMAGE_ASPECT_COLOR_BIT;
 }
 
+inline bool IsDepthFormat(VkFormat format) {
+    return format == VK_FORMAT_D16_UNORM || format == VK_FORMAT_D32_SFLOAT || format == VK_FORMAT_D24_UNORM_S8_UINT ||
+           format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+
+inline bool IsStencilFormat(VkFormat format) {
+    return format == VK_FORMAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT || format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+
+inline bool IsDepthStencilFormat(VkFormat format) {
+    return IsDepthFormat(format) || IsStencilFormat(format);
+}
+
+// Every aspect of the format; what a layout transition must name
+inline VkImageAspectFlags GetImageAspect(VkFormat format) {
+    VkImageAspectFlags aspect = 0;
+    if (IsDepthFormat(format))
+        aspect |= VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (IsStencilFormat(format))
+        aspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    return aspect ? aspect : VK_IMAGE_ASPECT_COLOR_BIT;
+}
+
+// Buffer<->image copies address a single aspect; depth wins on combined formats
+inline VkImageAspectFlags GetCopyAspect(VkFormat format) {
+    if (IsDepthFormat(format))
+        return VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (IsStencilFormat(format))
+        return VK_IMAGE_ASPECT_STENCIL_BIT;
+    return VK_IMAGE_ASPECT_COLOR_BIT;
+}
+
 inline VkImageViewType ToVulkanViewType(TextureType type) {
     switch (type) {
     case TextureType::TEXTURE_1D:
@@ -1924,6 +2583,10 @@ inline const char* FormatToString(Format format) {
         return "D24_UNORM_S8_UINT";
     case Format::D32_SFLOAT:
         return "D32_SFLOAT";
+    case Format::BC1_RGB_UNORM:
+        return "BC1_RGB_UNORM";
+    case Format::BC1_RGB_SRGB:
+        return "BC1_RGB_SRGB";
     case Format::BC1_RGBA_UNORM:
         return "BC1_RGBA_UNORM";
     case Format::BC1_RGBA_SRGB:
@@ -1932,6 +2595,42 @@ inline const char* FormatToString(Format format) {
         return "BC3_UNORM";
     case Format::BC3_SRGB:
         return "BC3_SRGB";
+    case Format::BC4_UNORM:
+        return "BC4_UNORM";
+    case Format::BC4_SNORM:
+        return "BC4_SNORM";
+    case Format::BC5_UNORM:
+        return "BC5_UNORM";
+    case Format::BC5_SNORM:
+        return "BC5_SNORM";
+    case Format::BC6H_UFLOAT:
+        return "BC6H_UFLOAT";
+    case Format::BC6H_SFLOAT:
+        return "BC6H_SFLOAT";
+    case Format::BC7_UNORM:
+        return "BC7_UNORM";
+    case Format::BC7_SRGB:
+        return "BC7_SRGB";
+    case Format::ETC2_RGB8_UNORM:
+        return "ETC2_RGB8_UNORM";
+    case Format::ETC2_RGB8_SRGB:
+        return "ETC2_RGB8_SRGB";
+    case Format::ETC2_RGBA8_UNORM:
+        return "ETC2_RGBA8_UNORM";
+    case Format::ETC2_RGBA8_SRGB:
+        return "ETC2_RGBA8_SRGB";
+    case Format::ASTC_4x4_UNORM:
+        return "ASTC_4x4_UNORM";
+    case Format::ASTC_4x4_SRGB:
+        return "ASTC_4x4_SRGB";
+    case Format::ASTC_6x6_UNORM:
+        return "ASTC_6x6_UNORM";
+    case Format::ASTC_6x6_SRGB:
+        return "ASTC_6x6_SRGB";
+    case Format::ASTC_8x8_UNORM:
+        return "ASTC_8x8_UNORM";
+    case Format::ASTC_8x8_SRGB:
+        return "ASTC_8x8_SRGB";
     default:
         return "UNKNOWN_FORMAT";
     }
@@ -1971,6 +2670,10 @@ inline Format VkFormatToFormat(VkFormat format) {
         return Format::D24_UNORM_S8_UINT;
     case VK_FORMAT_D32_SFLOAT:
         return Format::D32_SFLOAT;
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+        return Format::BC1_RGB_UNORM;
+    case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        return Format::BC1_RGB_SRGB;
     case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
         return Format::BC1_RGBA_UNORM;
     case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
@@ -1979,6 +2682,42 @@ inline Format VkFormatToFormat(VkFormat format) {
         return Format::BC3_UNORM;
     case VK_FORMAT_BC3_SRGB_BLOCK:
         return Format::BC3_SRGB;
+    case VK_FORMAT_BC4_UNORM_BLOCK:
+        return Format::BC4_UNORM;
+    case VK_FORMAT_BC4_SNORM_BLOCK:
+        return Format::BC4_SNORM;
+    case VK_FORMAT_BC5_UNORM_BLOCK:
+        return Format::BC5_UNORM;
+    case VK_FORMAT_BC5_SNORM_BLOCK:
+        return Format::BC5_SNORM;
+    case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+        return Format::BC6H_UFLOAT;
+    case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+        return Format::BC6H_SFLOAT;
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+        return Format::BC7_UNORM;
+    case VK_FORMAT_BC7_SRGB_BLOCK:
+        return Format::BC7_SRGB;
+    case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
+        return Format::ETC2_RGB8_UNORM;
+    case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:
+        return Format::ETC2_RGB8_SRGB;
+    case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+        return Format::ETC2_RGBA8_UNORM;
+    case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+        return Format::ETC2_RGBA8_SRGB;
+    case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
+        return Format::ASTC_4x4_UNORM;
+    case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:
+        return Format::ASTC_4x4_SRGB;
+    case VK_FORMAT_ASTC_6x6_UNORM_BLOCK:
+        return Format::ASTC_6x6_UNORM;
+    case VK_FORMAT_ASTC_6x6_SRGB_BLOCK:
+        return Format::ASTC_6x6_SRGB;
+    case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
+        return Format::ASTC_8x8_UNORM;
+    case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:
+        return Format::ASTC_8x8_SRGB;
     default:
         return Format::UNDEFINED;
     }
@@ -2176,14 +2915,13 @@ inline VulkanSubresourceState& GetSubresourceState(SparseTextureState& sparse, u
     return sparse.global;
 }
 
-// TODO----------------------------------------------------
-//  inline void SetSubresourceState(
-//  	SparseTextureState& sparse,
-//  	uint32_t subresource,
-//  	const VulkanAccessState& newState) {
-//  	sparse.overrides[subresource] = newState;
-//  }
-//---------------------------------------------------------
+inline uint32_t SubresourceIndex(const VulkanTexture& texture, uint32_t mipLevel, uint32_t arrayLayer) {
+    return mipLevel * texture.arrayLayers + arrayLayer;
+}
+
+inline void SetSubresourceState(SparseTextureState& sparse, uint32_t subresource, const VulkanSubresourceState& newState) {
+    sparse.overrides[subresource] = newState;
+}
 
 inline VkAccessFlags2 MapAccess(AccessFlags access) {
     VkAccessFlags2 result = 0;
@@ -1,6 +1,7 @@
 ﻿#include "VK_Common.h"
 #include "VK_RenderX.h"
 
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <set>
@@ -106,7 +107,8 @@ void VulkanDevice::logDeviceInfo(uint32_t index, const DeviceInfo& info) const {
             capabilities += "SparseBinding ";
 
         VkBool32 presentSupport = VK_FALSE;
-        vkGetPhysicalDeviceSurfaceSupportKHR(info.device, i, m_Surface, &presentSupport);
+        if (m_Surface != VK_NULL_HANDLE)
+            vkGetPhysicalDeviceSurfaceSupportKHR(info.device, i, m_Surface, &presentSupport);
         if (presentSupport)
             capabilities += "Present ";
 
@@ -290,12 +292,27 @@ bool VulkanDevice::isDeviceSuitable(VkPhysicalDevice device) const {
             hasGraphics = true;
 
         VkBool32 present = VK_FALSE;
-        vkGetPhysicalDeviceSurfaceSupportKHR(device, i, m_Surface, &present);
+        if (m_Surface != VK_NULL_HANDLE)
+            vkGetPhysicalDeviceSurfaceSupportKHR(device, i, m_Surface, &present);
         if (present)
             hasPresent = true;
     }
 
-    return hasGraphics && hasPresent;
+    // Headless devices never present
+    return hasGraphics && (hasPresent || m_Surface == VK_NULL_HANDLE);
+}
+
+bool VulkanDevice::supportsExtension(const char* name) const {
+    uint32_t count = 0;
+    vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &count, nullptr);
+    std::vector<VkExtensionProperties> extensions(count);
+    vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &count, extensions.data());
+
+    for (const auto& ext : extensions) {
+        if (std::strcmp(ext.extensionName, name) == 0)
+            return true;
+    }
+    return false;
 }
 
 void VulkanDevice::createLogicalDevice(const std::vector<const char*>& requiredExtensions,
@@ -365,8 +382,36 @@ void VulkanDevice::createLogicalDevice(const std::vector<const char*>& requiredE
     features11.pNext = &features12;
     features12.pNext = &features13;
 
+    // Optional extensions are enabled only when the device reports both the
+    // extension and its feature bit
+    std::vector<const char*> extensions = requiredExtensions;
+
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures{};
+    descriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+    const bool descriptorBufferExt = supportsExtension(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    if (descriptorBufferExt)
+        features13.pNext = &descriptorBufferFeatures;
+
     vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &features2);
 
+    // Every supported core feature is enabled below, robustness included
+    m_RobustBufferAccess  = features2.features.robustBufferAccess;
+    m_HasDescriptorBuffer = descriptorBufferExt && descriptorBufferFeatures.descriptorBuffer;
+    if (m_HasDescriptorBuffer) {
+        extensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+        descriptorBufferFeatures.descriptorBufferCaptureReplay      = VK_FALSE;
+        descriptorBufferFeatures.descriptorBufferImageLayoutIgnored = VK_FALSE;
+        descriptorBufferFeatures.descriptorBufferPushDescriptors    = VK_FALSE;
+    } else {
+        features13.pNext = nullptr;
+    }
+
+    // Has no feature bit; the extension alone enables it
+    m_HasPushDescriptor = supportsExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    if (m_HasPushDescriptor)
+        extensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+
     features2.features.samplerAnisotropy = VK_TRUE;
 
     features13.dynamicRendering = VK_TRUE;
@@ -386,8 +431,8 @@ void VulkanDevice::createLogicalDevice(const std::vector<const char*>& requiredE
     info.pQueueCreateInfos       = queues.data();
     info.pEnabledFeatures        = nullptr;
     info.pNext                   = &features2; // important;
-    info.enabledExtensionCount   = uint32_t(requiredExtensions.size());
-    info.ppEnabledExtensionNames = requiredExtensions.data();
+    info.enabledExtensionCount   = uint32_t(extensions.size());
+    info.ppEnabledExtensionNames = extensions.data();
     info.enabledLayerCount       = uint32_t(requiredLayers.size());
     info.ppEnabledLayerNames     = requiredLayers.data();
 
@@ -397,14 +442,82 @@ void VulkanDevice::createLogicalDevice(const std::vector<const char*>& requiredE
     vkGetDeviceQueue(m_Device, m_ComputeFamily, 0, &m_ComputeQueue);
     vkGetDeviceQueue(m_Device, m_TransferFamily, 0, &m_TransferQueue);
 
+    RENDERX_INFO("Descriptor buffer: {}", m_HasDescriptorBuffer ? "enabled" : "not supported");
+    RENDERX_INFO("Push descriptors: {}", m_HasPushDescriptor ? "enabled" : "emulated");
     RENDERX_INFO("Logical device created successfully");
     RENDERX_INFO("Queues retrieved successfully\n");
 }
 
 void VulkanDevice::queryLimits() {
-    VkPhysicalDeviceProperties props{};
-    vkGetPhysicalDeviceProperties(m_PhysicalDevice, &props);
-    m_VkLimits = props.limits;
+    m_DescriptorBufferProps       = {};
+    m_DescriptorBufferProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+
+    m_Vulkan12Props       = {};
+    m_Vulkan12Props.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+    if (m_HasDescriptorBuffer)
+        m_Vulkan12Props.pNext = &m_DescriptorBufferProps;
+
+    m_Vulkan11Props       = {};
+    m_Vulkan11Props.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES;
+    m_Vulkan11Props.pNext = &m_Vulkan12Props;
+
+    VkPhysicalDeviceProperties2 props2{};
+    props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    props2.pNext = &m_Vulkan11Props;
+
+    vkGetPhysicalDeviceProperties2(m_PhysicalDevice, &props2);
+    m_VkProperties = props2.properties;
+    m_VkLimits     = props2.properties.limits;
+}
+
+uint32_t VulkanDevice::descriptorSize(VkDescriptorType type) const {
+    const auto& p = m_DescriptorBufferProps;
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+        return (uint32_t)p.samplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return (uint32_t)p.combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        return (uint32_t)p.sampledImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return (uint32_t)p.storageImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return (uint32_t)(m_RobustBufferAccess ? p.robustUniformBufferDescriptorSize : p.uniformBufferDescriptorSize);
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return (uint32_t)(m_RobustBufferAccess ? p.robustStorageBufferDescriptorSize : p.storageBufferDescriptorSize);
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        return (uint32_t)(m_RobustBufferAccess ? p.robustUniformTexelBufferDescriptorSize : p.uniformTexelBufferDescriptorSize);
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return (uint32_t)(m_RobustBufferAccess ? p.robustStorageTexelBufferDescriptorSize : p.storageTexelBufferDescriptorSize);
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        return (uint32_t)p.inputAttachmentDescriptorSize;
+    default:
+        return 0;
+    }
+}
+
+void VulkanDevice::loadExtensionFunctions() {
+#define RX_LOAD_DEVICE_PROC(member, name) m_Ext.member = reinterpret_cast<PFN_##name>(vkGetDeviceProcAddr(m_Device, #name))
+
+    if (m_HasDescriptorBuffer) {
+        RX_LOAD_DEVICE_PROC(getDescriptorSetLayoutSize, vkGetDescriptorSetLayoutSizeEXT);
+        RX_LOAD_DEVICE_PROC(getDescriptorSetLayoutBindingOffset, vkGetDescriptorSetLayoutBindingOffsetEXT);
+        RX_LOAD_DEVICE_PROC(getDescriptor, vkGetDescriptorEXT);
+        RX_LOAD_DEVICE_PROC(cmdBindDescriptorBuffers, vkCmdBindDescriptorBuffersEXT);
+        RX_LOAD_DEVICE_PROC(cmdSetDescriptorBufferOffsets, vkCmdSetDescriptorBufferOffsetsEXT);
+    }
+    if (m_HasPushDescriptor)
+        RX_LOAD_DEVICE_PROC(cmdPushDescriptorSet, vkCmdPushDescriptorSetKHR);
+
+#undef RX_LOAD_DEVICE_PROC
+}
+
+std::mutex& VulkanDevice::queueMutex(VkQueue queue) {
+    if (queue == m_GraphicsQueue)
+        return m_GraphicsQueueMutex;
+    if (queue == m_ComputeQueue)
+        return m_ComputeQueueMutex;
+    return m_TransferQueueMutex;
 }
 
 VulkanDevice::VulkanDevice(VkInstance                      instance,
@@ -432,6 +545,7 @@ VulkanDevice::VulkanDevice(VkInstance                      instance,
 
     createLogicalDevice(requiredExtensions, requiredLayers);
     queryLimits();
+    loadExtensionFunctions();
 }
 
 VulkanDevice::~VulkanDevice() {
@@ -0,0 +1,383 @@
+#include "VK_Common.h"
+#include "VK_RenderX.h"
+#include <algorithm>
+
+namespace Rx {
+namespace RxVK {
+
+// VulkanDeletionQueue Implementation
+
+VulkanDeletionQueue::VulkanDeletionQueue(VulkanContext& ctx)
+    : m_Ctx(ctx) {}
+
+VulkanDeletionQueue::~VulkanDeletionQueue() {
+    flush();
+}
+
+void VulkanDeletionQueue::destroyBuffer(VkBuffer buffer, VmaAllocation allocation) {
+    Entry e{};
+    e.kind       = Kind::BUFFER;
+    e.buffer     = buffer;
+    e.allocation = allocation;
+    push(e);
+}
+
+void VulkanDeletionQueue::destroyImage(VkImage image, VmaAllocation allocation) {
+    Entry e{};
+    e.kind       = Kind::IMAGE;
+    e.image      = image;
+    e.allocation = allocation;
+    push(e);
+}
+
+void VulkanDeletionQueue::destroyImageView(VkImageView view) {
+    Entry e{};
+    e.kind = Kind::IMAGE_VIEW;
+    e.view = view;
+    push(e);
+}
+
+void VulkanDeletionQueue::destroySampler(VkSampler sampler) {
+    Entry e{};
+    e.kind    = Kind::SAMPLER;
+    e.sampler = sampler;
+    push(e);
+}
+
+void VulkanDeletionQueue::releaseBindlessIndex(BindlessTableHandle table, ResourceType type, uint32_t index) {
+    Entry e{};
+    e.kind          = Kind::BINDLESS_INDEX;
+    e.bindlessTable = table;
+    e.bindlessType  = type;
+    e.bindlessIndex = index;
+    push(e);
+}
+
+void VulkanDeletionQueue::freeSet(DescriptorPoolHandle pool, SetHandle set) {
+    Entry e{};
+    e.kind    = Kind::DESCRIPTOR_SET;
+    e.setPool = pool;
+    e.set     = set;
+    push(e);
+}
+
+void VulkanDeletionQueue::destroyDescriptorPool(VkDescriptorPool pool) {
+    Entry e{};
+    e.kind           = Kind::DESCRIPTOR_POOL;
+    e.descriptorPool = pool;
+    push(e);
+}
+
+void VulkanDeletionQueue::destroySetLayout(SetLayoutHandle layout) {
+    Entry e{};
+    e.kind      = Kind::SET_LAYOUT;
+    e.setLayout = layout;
+    push(e);
+}
+
+void VulkanDeletionQueue::push(Entry entry) {
+    // Anything submitted up to now may still reference the object. Sampled
+    // under the lock so entries stay in submission order for retire().
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    entry.graphics = m_Ctx.graphicsQueue->Submitted().value;
+    entry.compute  = m_Ctx.computeQueue->Submitted().value;
+    entry.transfer = m_Ctx.transferQueue->Submitted().value;
+    m_Entries.push_back(entry);
+}
+
+void VulkanDeletionQueue::retire() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    retireLocked();
+}
+
+void VulkanDeletionQueue::retireLocked() {
+    if (m_Entries.empty())
+        return;
+
+    const uint64_t graphics = m_Ctx.graphicsQueue->Completed().value;
+    const uint64_t compute  = m_Ctx.computeQueue->Completed().value;
+    const uint64_t transfer = m_Ctx.transferQueue->Completed().value;
+
+    while (!m_Entries.empty()) {
+        const Entry& e = m_Entries.front();
+        if (e.graphics > graphics || e.compute > compute || e.transfer > transfer)
+            break;
+
+        destroy(e);
+        m_Entries.pop_front();
+    }
+}
+
+void VulkanDeletionQueue::flush() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const auto& e : m_Entries)
+        destroy(e);
+    m_Entries.clear();
+}
+
+void VulkanDeletionQueue::destroy(const Entry& e) {
+    VkDevice device = m_Ctx.device->logical();
+
+    switch (e.kind) {
+    case Kind::BUFFER:
+        m_Ctx.allocator->destroyBuffer(e.buffer, e.allocation);
+        break;
+    case Kind::IMAGE:
+        m_Ctx.allocator->destroyImage(e.image, e.allocation);
+        break;
+    case Kind::IMAGE_VIEW:
+        vkDestroyImageView(device, e.view, nullptr);
+        break;
+    case Kind::SAMPLER:
+        vkDestroySampler(device, e.sampler, nullptr);
+        break;
+    case Kind::BINDLESS_INDEX:
+        FreeBindlessIndex(e.bindlessTable, e.bindlessType, e.bindlessIndex);
+        break;
+    case Kind::DESCRIPTOR_SET: {
+        // A no-op when the pool was destroyed in the meantime
+        SetHandle set = e.set;
+        VKFreeSet(e.setPool, set);
+        break;
+    }
+    case Kind::DESCRIPTOR_POOL:
+        vkDestroyDescriptorPool(device, e.descriptorPool, nullptr);
+        break;
+    case Kind::SET_LAYOUT: {
+        SetLayoutHandle layout = e.setLayout;
+        VKDestroySetLayout(layout);
+        break;
+    }
+    }
+}
+
+// VulkanTransientAllocator Implementation
+
+VulkanTransientAllocator::VulkanTransientAllocator(VulkanContext& ctx, const TransientAllocatorDesc& desc)
+    : m_Ctx(ctx) {
+    m_MinAlign = std::max<uint64_t>(GetMinVulkanAlignment(desc.usage), 16);
+
+    // Regions start on an aligned boundary so offsets stay aligned across them
+    m_RegionSize = (desc.bytesPerFrame + m_MinAlign - 1) & ~(m_MinAlign - 1);
+    m_Regions.resize(desc.framesInFlight);
+
+    BufferDesc bufferDesc;
+    bufferDesc.usage      = desc.usage;
+    bufferDesc.memoryType = MemoryType::CPU_TO_GPU;
+    bufferDesc.size       = (size_t)(m_RegionSize * desc.framesInFlight);
+    bufferDesc.debugName  = desc.debugName ? desc.debugName : "TransientAllocator";
+
+    m_Buffer = VKCreateBuffer(bufferDesc);
+    m_Mapped = static_cast<uint8_t*>(VKMapBuffer(m_Buffer));
+    RENDERX_ASSERT_MSG(m_Mapped, "VulkanTransientAllocator: ring buffer is not host visible");
+
+    // Start on the last region so the first BeginFrame lands on region 0
+    m_RegionIndex = desc.framesInFlight - 1;
+}
+
+VulkanTransientAllocator::~VulkanTransientAllocator() {
+    // Destruction is deferred until every queue is past the last frame
+    VKDestroyBuffer(m_Buffer);
+}
+
+TransientAllocation VulkanTransientAllocator::allocate(uint64_t size, uint64_t alignment) {
+    alignment = std::max(alignment, m_MinAlign);
+    RENDERX_ASSERT_MSG((alignment & (alignment - 1)) == 0, "TransientAllocator::allocate: alignment must be a power of two");
+
+    // Bump the head with a CAS so several threads can record concurrently
+    uint64_t head = m_Head.load(std::memory_order_relaxed);
+    uint64_t offset;
+    do {
+        offset = (head + alignment - 1) & ~(alignment - 1);
+        if (offset + size > m_RegionSize) {
+            if (!m_OverflowReported.exchange(true))
+                RENDERX_ERROR("TransientAllocator: frame region of {} bytes exhausted (requested {})", m_RegionSize, size);
+            return {};
+        }
+    } while (!m_Head.compare_exchange_weak(head, offset + size, std::memory_order_relaxed));
+
+    const uint64_t base = (uint64_t)m_RegionIndex * m_RegionSize + offset;
+
+    TransientAllocation allocation;
+    allocation.cpuPtr = m_Mapped + base;
+    allocation.buffer = m_Buffer;
+    allocation.offset = base;
+    allocation.size   = size;
+    return allocation;
+}
+
+void VulkanTransientAllocator::BeginFrame() {
+    m_RegionIndex = (m_RegionIndex + 1) % (uint32_t)m_Regions.size();
+
+    // Free when driven by a FrameContext: it has already waited on this slot.
+    // Constants may have been read by compute or transfer work of that frame
+    // too, so the graphics timeline alone does not free the region.
+    const RegionUse& region = m_Regions[m_RegionIndex];
+    m_Ctx.graphicsQueue->Wait(region.graphics);
+    m_Ctx.computeQueue->Wait(region.compute);
+    m_Ctx.transferQueue->Wait(region.transfer);
+
+    m_Head.store(0, std::memory_order_relaxed);
+    m_OverflowReported.store(false, std::memory_order_relaxed);
+}
+
+void VulkanTransientAllocator::EndFrame(Timeline lastUse) {
+    RegionUse& region = m_Regions[m_RegionIndex];
+    region.graphics   = lastUse.value;
+    region.compute    = m_Ctx.computeQueue->Submitted().value;
+    region.transfer   = m_Ctx.transferQueue->Submitted().value;
+}
+
+uint64_t VulkanTransientAllocator::GetUsedBytes() const {
+    return m_Head.load(std::memory_order_relaxed);
+}
+
+// VulkanFrameContext Implementation
+
+VulkanFrameContext::VulkanFrameContext(VulkanContext& ctx, const FrameContextDesc& desc)
+    : m_Ctx(ctx),
+      m_Swapchain(desc.swapchain),
+      m_CachedSetLifetime(desc.cachedSetLifetime) {
+    RENDERX_ASSERT_MSG(desc.framesInFlight > 0, "VulkanFrameContext: framesInFlight must be at least 1");
+
+    m_Slots.resize(desc.framesInFlight);
+    for (auto& slot : m_Slots) {
+        slot.graphicsAllocator = m_Ctx.graphicsQueue->CreateCommandAllocator("FrameGraphicsAllocator");
+        if (desc.useCompute)
+            slot.computeAllocator = m_Ctx.computeQueue->CreateCommandAllocator("FrameComputeAllocator");
+
+        slot.linearPools.reserve(desc.linearPools.size());
+        for (const auto& poolDesc : desc.linearPools) {
+            RENDERX_ASSERT_MSG(Has(poolDesc.flags, DescriptorPoolFlags::LINEAR),
+                               "VulkanFrameContext: per-frame descriptor pools must be LINEAR");
+            slot.linearPools.push_back(VKCreateDescriptorPool(poolDesc));
+        }
+    }
+
+    if (desc.transientBytes > 0) {
+        m_Transient = new VulkanTransientAllocator(m_Ctx,
+                                                   TransientAllocatorDesc()
+                                                       .setBytesPerFrame(desc.transientBytes)
+                                                       .setFramesInFlight(desc.framesInFlight)
+                                                       .setDebugName("FrameTransientAllocator"));
+    }
+}
+
+VulkanFrameContext::~VulkanFrameContext() {
+    for (auto& slot : m_Slots) {
+        waitSlot(slot);
+
+        for (auto& pool : slot.linearPools)
+            VKDestroyDescriptorPool(pool);
+
+        if (slot.computeAllocator)
+            m_Ctx.computeQueue->DestroyCommandAllocator(slot.computeAllocator);
+        m_Ctx.graphicsQueue->DestroyCommandAllocator(slot.graphicsAllocator);
+    }
+
+    delete m_Transient;
+}
+
+void VulkanFrameContext::waitSlot(const Slot& slot) const {
+    m_Ctx.graphicsQueue->Wait(slot.timeline);
+    m_Ctx.computeQueue->Wait(slot.compute);
+    m_Ctx.transferQueue->Wait(slot.transfer);
+}
+
+const FrameInfo& VulkanFrameContext::BeginFrame() {
+    RENDERX_ASSERT_MSG(!m_InFrame, "VulkanFrameContext::BeginFrame: previous frame was not ended");
+
+    Slot& slot = m_Slots[m_SlotIndex];
+
+    // The slot is reused every framesInFlight frames, so this only blocks when
+    // the CPU is a full ring ahead of the GPU.
+    waitSlot(slot);
+
+    slot.graphicsAllocator->Reset();
+    if (slot.computeAllocator)
+        slot.computeAllocator->Reset();
+    for (auto& pool : slot.linearPools)
+        VKResetDescriptorPool(pool);
+    if (m_Transient)
+        m_Transient->BeginFrame();
+    if (m_CachedSetLifetime)
+        VKTrimSetCache(m_CachedSetLifetime);
+
+    // Staging ranges are tagged with transfer-queue timeline values
+    m_Ctx.stagingAllocator->retire(m_Ctx.transferQueue->Completed().value);
+    m_Ctx.deletionQueue->retire();
+
+    m_Current                   = {};
+    m_Current.frameIndex        = m_SlotIndex;
+    m_Current.frameNumber       = m_FrameNumber;
+    m_Current.graphicsAllocator = slot.graphicsAllocator;
+    m_Current.computeAllocator  = slot.computeAllocator;
+    m_Current.transient         = m_Transient;
+    m_Current.linearPools       = slot.linearPools.data();
+    m_Current.linearPoolCount   = (uint32_t)slot.linearPools.size();
+
+    if (m_Swapchain)
+        m_Current.imageIndex = m_Swapchain->AcquireNextImage();
+
+    m_Current.commandList = slot.graphicsAllocator->Allocate();
+    m_Current.commandList->open();
+
+    m_InFrame = true;
+    return m_Current;
+}
+
+Timeline VulkanFrameContext::EndFrame(const QueueDependency* waits, uint32_t waitCount) {
+    RENDERX_ASSERT_MSG(m_InFrame, "VulkanFrameContext::EndFrame: BeginFrame was not called");
+
+    m_Current.commandList->close();
+
+    SubmitInfo submit = SubmitInfo::Single(m_Current.commandList);
+    for (uint32_t i = 0; i < waitCount; i++)
+        submit.addDependency(waits[i]);
+    if (m_Swapchain)
+        submit.setSwapchainWrite();
+
+    // Compute and transfer submits made during the frame (including ones not
+    // passed as waits) may still use its allocators and transient region
+    Slot& slot    = m_Slots[m_SlotIndex];
+    slot.timeline = m_Ctx.graphicsQueue->Submit(submit);
+    slot.compute  = m_Ctx.computeQueue->Submitted().value;
+    slot.transfer = m_Ctx.transferQueue->Submitted().value;
+    if (m_Transient)
+        m_Transient->EndFrame(slot.timeline);
+
+    if (m_Swapchain)
+        m_Swapchain->Present(m_Current.imageIndex);
+
+    m_SlotIndex = (m_SlotIndex + 1) % (uint32_t)m_Slots.size();
+    m_FrameNumber++;
+    m_InFrame = false;
+    return slot.timeline;
+}
+
+FrameContext* VKCreateFrameContext(const FrameContextDesc& desc) {
+    if (desc.framesInFlight == 0) {
+        RENDERX_ERROR("VKCreateFrameContext: framesInFlight must be at least 1");
+        return nullptr;
+    }
+    return new VulkanFrameContext(GetVulkanContext(), desc);
+}
+
+void VKDestroyFrameContext(FrameContext* context) {
+    delete context;
+}
+
+TransientAllocator* VKCreateTransientAllocator(const TransientAllocatorDesc& desc) {
+    if (desc.framesInFlight == 0 || desc.bytesPerFrame == 0) {
+        RENDERX_ERROR("VKCreateTransientAllocator: framesInFlight and bytesPerFrame must be non-zero");
+        return nullptr;
+    }
+    return new VulkanTransientAllocator(GetVulkanContext(), desc);
+}
+
+void VKDestroyTransientAllocator(TransientAllocator* allocator) {
+    delete allocator;
+}
+
+} // namespace RxVK
+} // namespace Rx
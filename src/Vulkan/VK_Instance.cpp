@@ -65,6 +65,12 @@ void VulkanInstance::createInstance(const InitDesc& window) {
 }
 
 void VulkanInstance::createSurface(const InitDesc& desc) {
+    // Headless: offscreen rendering only, no swapchain
+    if (desc.window.type == WindowSystem::NONE) {
+        m_Surface = VK_NULL_HANDLE;
+        return;
+    }
+
 #if defined(RX_PLATFORM_WINDOWS)
     VkWin32SurfaceCreateInfoKHR ci{};
     ci.sType     = VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR;
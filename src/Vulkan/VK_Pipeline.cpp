@@ -1,5 +1,8 @@
 #include "VK_Common.h"
 #include "VK_RenderX.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 
 namespace Rx {
 
@@ -8,6 +11,174 @@ namespace RxVK {
 ResourcePool<VulkanPipelineLayout, PipelineLayoutHandle> g_PipelineLayoutPool;
 ResourcePool<VulkanPipeline, PipelineHandle>             g_PipelinePool;
 
+//------------------------------------------------------------------------------
+// Pipeline cache
+//------------------------------------------------------------------------------
+
+namespace {
+
+// Precedes the driver's blob in the cache file. The driver validates its own
+// header too, but not every driver rejects a foreign blob gracefully.
+struct PipelineCacheFileHeader {
+    static constexpr uint32_t MAGIC   = 0x43505852; // "RXPC"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic         = MAGIC;
+    uint32_t version       = VERSION;
+    uint32_t vendorID      = 0;
+    uint32_t deviceID      = 0;
+    uint32_t driverVersion = 0;
+    uint32_t _pad          = 0;
+    uint8_t  pipelineCacheUUID[VK_UUID_SIZE]{};
+    uint8_t  driverUUID[VK_UUID_SIZE]{};
+    uint64_t dataSize = 0;
+    uint64_t dataHash = 0; // FNV-1a of the blob
+};
+
+PipelineCacheFileHeader MakeCacheHeader(const VulkanDevice& device) {
+    const VkPhysicalDeviceProperties& props = device.VkProperties();
+
+    PipelineCacheFileHeader header{};
+    header.vendorID      = props.vendorID;
+    header.deviceID      = props.deviceID;
+    header.driverVersion = props.driverVersion;
+    std::memcpy(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE);
+    std::memcpy(header.driverUUID, device.vulkan11Properties().driverUUID, VK_UUID_SIZE);
+    return header;
+}
+
+uint64_t HashBlob(const std::vector<uint8_t>& blob) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (uint8_t byte : blob) {
+        hash ^= byte;
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+} // namespace
+
+VulkanPipelineCache::VulkanPipelineCache(const VulkanDevice& device, const char* path)
+    : m_Device(device),
+      m_Path(path ? path : "") {
+    std::vector<uint8_t> blob;
+    if (!m_Path.empty() && load(blob))
+        m_SavedHash = HashBlob(blob);
+
+    VkPipelineCacheCreateInfo ci{};
+    ci.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    ci.initialDataSize = blob.size();
+    ci.pInitialData    = blob.empty() ? nullptr : blob.data();
+    if (vkCreatePipelineCache(m_Device.logical(), &ci, nullptr, &m_Cache) != VK_SUCCESS && !blob.empty()) {
+        // Rejected by the driver after all; start over rather than run uncached
+        RENDERX_WARN("Pipeline cache: driver rejected '{}', starting empty", m_Path);
+        ci.initialDataSize = 0;
+        ci.pInitialData    = nullptr;
+        m_SavedHash        = 0;
+        VK_CHECK(vkCreatePipelineCache(m_Device.logical(), &ci, nullptr, &m_Cache));
+    }
+
+    if (m_SavedHash)
+        RENDERX_INFO("Pipeline cache: loaded {} bytes from '{}'", blob.size(), m_Path);
+}
+
+VulkanPipelineCache::~VulkanPipelineCache() {
+    if (m_Cache != VK_NULL_HANDLE)
+        vkDestroyPipelineCache(m_Device.logical(), m_Cache, nullptr);
+}
+
+bool VulkanPipelineCache::load(std::vector<uint8_t>& outBlob) const {
+    std::ifstream file(m_Path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false; // first run
+
+    const uint64_t          fileSize = (uint64_t)file.tellg();
+    PipelineCacheFileHeader header{};
+    file.seekg(0);
+    if (fileSize < sizeof(header) || !file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        RENDERX_WARN("Pipeline cache: '{}' is truncated, discarding it", m_Path);
+        return false;
+    }
+
+    const PipelineCacheFileHeader expected = MakeCacheHeader(m_Device);
+    if (header.magic != expected.magic || header.version != expected.version) {
+        RENDERX_WARN("Pipeline cache: '{}' is not a RenderX pipeline cache, discarding it", m_Path);
+        return false;
+    }
+    if (header.vendorID != expected.vendorID || header.deviceID != expected.deviceID ||
+        header.driverVersion != expected.driverVersion ||
+        std::memcmp(header.pipelineCacheUUID, expected.pipelineCacheUUID, VK_UUID_SIZE) != 0 ||
+        std::memcmp(header.driverUUID, expected.driverUUID, VK_UUID_SIZE) != 0) {
+        RENDERX_INFO("Pipeline cache: '{}' was built by another GPU or driver, rebuilding", m_Path);
+        return false;
+    }
+    if (header.dataSize != fileSize - sizeof(header)) {
+        RENDERX_WARN("Pipeline cache: '{}' is truncated, discarding it", m_Path);
+        return false;
+    }
+
+    outBlob.resize((size_t)header.dataSize);
+    if (!file.read(reinterpret_cast<char*>(outBlob.data()), (std::streamsize)outBlob.size()) ||
+        HashBlob(outBlob) != header.dataHash) {
+        RENDERX_WARN("Pipeline cache: '{}' is corrupt, discarding it", m_Path);
+        outBlob.clear();
+        return false;
+    }
+    return true;
+}
+
+bool VulkanPipelineCache::save() {
+    if (m_Path.empty() || m_Cache == VK_NULL_HANDLE)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_SaveMutex);
+
+    size_t size = 0;
+    if (vkGetPipelineCacheData(m_Device.logical(), m_Cache, &size, nullptr) != VK_SUCCESS)
+        return false;
+    std::vector<uint8_t> blob(size);
+    // VK_INCOMPLETE if pipelines were added in between; the shorter blob is
+    // still a valid cache
+    if (size && vkGetPipelineCacheData(m_Device.logical(), m_Cache, &size, blob.data()) < VK_SUCCESS)
+        return false;
+    blob.resize(size);
+
+    PipelineCacheFileHeader header = MakeCacheHeader(m_Device);
+    header.dataSize                = blob.size();
+    header.dataHash                = HashBlob(blob);
+    if (header.dataHash == m_SavedHash)
+        return true;
+
+    // Written under a temporary name so a crash mid-write never leaves a
+    // truncated cache behind
+    const std::string tmpPath = m_Path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(blob.data()), (std::streamsize)blob.size());
+        if (!file) {
+            RENDERX_ERROR("Pipeline cache: failed to write '{}'", tmpPath);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, m_Path, ec);
+    if (ec) {
+        RENDERX_ERROR("Pipeline cache: failed to replace '{}': {}", m_Path, ec.message());
+        return false;
+    }
+
+    m_SavedHash = header.dataHash;
+    RENDERX_INFO("Pipeline cache: wrote {} bytes to '{}'", blob.size(), m_Path);
+    return true;
+}
+
+bool VKSavePipelineCache() {
+    auto& ctx = GetVulkanContext();
+    return ctx.pipelineCache && ctx.pipelineCache->save();
+}
+
 // SHADER
 ShaderHandle VKCreateShader(const ShaderDesc& desc) {
     RENDERX_ASSERT_MSG(desc.bytecode.size() > 0, "VKCreateShader: bytecode is empty");
@@ -29,15 +200,15 @@ ShaderHandle VKCreateShader(const ShaderDesc& desc) {
     }
     RENDERX_ASSERT_MSG(shaderModule != VK_NULL_HANDLE, "VKCreateShader: created shader module is null");
 
-    VulkanShader shader{desc.entryPoint, desc.stage, shaderModule};
+    VulkanShader shader{desc.entryPoint, desc.stage, std::make_shared<VulkanShaderModule>(ctx.device->logical(), shaderModule)};
     ShaderHandle handle = g_ShaderPool.allocate(shader);
     return handle;
 }
 
 void VKDestroyShader(ShaderHandle& handle) {
-    auto* shader = g_ShaderPool.get(handle);
-    auto& ctx    = GetVulkanContext();
-    vkDestroyShaderModule(ctx.device->logical(), shader->shaderModule, nullptr);
+    if (!g_ShaderPool.get(handle))
+        return;
+    // The module itself goes once no pending compile references it
     g_ShaderPool.free(handle);
 }
 
@@ -62,12 +233,29 @@ PipelineLayoutHandle VKCreatePipelineLayout(const SetLayoutHandle*   pLayouts,
     auto& ctx = GetVulkanContext();
 
     // Translate set layouts
-    VkDescriptorSetLayout vkSetLayouts[16] = {};
+    VkDescriptorSetLayout vkSetLayouts[16]  = {};
+    uint32_t              descriptorBuffers = 0;
+    uint32_t              pushSetIndex      = UINT32_MAX;
     RENDERX_ASSERT_MSG(LayoutCount <= 16, "VK_CreatePipelineLayout: too many set layouts (max 16)");
     for (uint32_t i = 0; i < LayoutCount; i++) {
         auto* sl = g_SetLayoutPool.get(pLayouts[i]);
         RENDERX_ASSERT_MSG(sl, "VK_CreatePipelineLayout: invalid SetLayoutHandle at index {}", i);
-        vkSetLayouts[i] = sl->vkLayout;
+        vkSetLayouts[i]    = sl->vkLayout;
+        descriptorBuffers += sl->descriptorBuffer ? 1 : 0;
+
+        if (sl->pushDescriptor) {
+            if (pushSetIndex != UINT32_MAX) {
+                RENDERX_ERROR("VK_CreatePipelineLayout: sets {} and {} are both push descriptor layouts", pushSetIndex, i);
+                return {};
+            }
+            pushSetIndex = i;
+        }
+    }
+
+    // A pipeline reads either descriptor sets or descriptor buffers, never both
+    if (descriptorBuffers != 0 && descriptorBuffers != LayoutCount) {
+        RENDERX_ERROR("VK_CreatePipelineLayout: DESCRIPTOR_BUFFER set layouts cannot be mixed with descriptor set layouts");
+        return {};
     }
 
     // Translate push constant ranges
@@ -104,7 +292,10 @@ PipelineLayoutHandle VKCreatePipelineLayout(const SetLayoutHandle*   pLayouts,
     }
 
     // Store push range metadata for later retrieval by setPipeline / pushConstants
-    layout.pushRangeCount = pushRangeCount;
+    layout.descriptorBuffer = descriptorBuffers != 0;
+    layout.pushSetIndex     = pushSetIndex;
+    layout.pushSetLayout    = pushSetIndex != UINT32_MAX ? pLayouts[pushSetIndex] : SetLayoutHandle{};
+    layout.pushRangeCount   = pushRangeCount;
     for (uint32_t i = 0; i < pushRangeCount; i++) {
         layout.pushRanges[i].offset     = pushRanges[i].offset;
         layout.pushRanges[i].size       = pushRanges[i].size;
@@ -118,40 +309,72 @@ void VKDestroyPipelineLayout(PipelineLayoutHandle& handle) {
     RENDERX_WARN("Not Implemented");
 }
 // GRAPHICS PIPELINE
-PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
-    auto& ctx = GetVulkanContext();
-
+namespace {
+
+// Everything a VkGraphicsPipelineCreateInfo points at. Built on the calling
+// thread from the resource pools; the pointers stay valid while the state
+// is not moved, so async jobs hold it by unique_ptr.
+struct GraphicsPipelineState {
+    std::vector<std::string>                         entryPoints;
+    std::vector<std::shared_ptr<VulkanShaderModule>> modules;
+    std::vector<VkPipelineShaderStageCreateInfo>     stages;
+    std::vector<VkVertexInputBindingDescription>     vertexBindings;
+    std::vector<VkVertexInputAttributeDescription>   attrs;
+    std::vector<VkFormat>                            colorAttachmentFormats;
+
+    VkPipelineVertexInputStateCreateInfo   vertexInput{};
+    VkPipelineInputAssemblyStateCreateInfo inputAsm{};
+    VkPipelineDynamicStateCreateInfo       dynamicState{};
+    VkPipelineViewportStateCreateInfo      viewportState{};
+    VkPipelineRasterizationStateCreateInfo rast{};
+    VkPipelineMultisampleStateCreateInfo   ms{};
+    VkPipelineDepthStencilStateCreateInfo  depth{};
+    VkPipelineColorBlendAttachmentState    blend{};
+    VkPipelineColorBlendStateCreateInfo    cb{};
+    VkPipelineRenderingCreateInfo          rci{};
+    VkGraphicsPipelineCreateInfo           pci{};
+
+    GraphicsPipelineState()                                        = default;
+    GraphicsPipelineState(const GraphicsPipelineState&)            = delete;
+    GraphicsPipelineState& operator=(const GraphicsPipelineState&) = delete;
+
+    // False when a shader or the layout is invalid
+    bool build(const PipelineDesc& desc);
+};
+
+bool GraphicsPipelineState::build(const PipelineDesc& desc) {
     //  Shader Stages
-    std::vector<VkPipelineShaderStageCreateInfo> stages;
+    // Entry points are copied and modules referenced: the shader pool may grow,
+    // or the shader be destroyed, while a worker compiles
+    entryPoints.reserve(desc.shaders.size());
     for (auto& sh : desc.shaders) {
         // Try ResourcePool first
         auto* shader = g_ShaderPool.get(sh);
-        if (!shader || shader->shaderModule == VK_NULL_HANDLE) {
+        if (!shader || !shader->shaderModule) {
             RENDERX_CRITICAL("Invalid shader handle");
-            return PipelineHandle{};
+            return false;
         }
+        entryPoints.push_back(shader->entryPoint);
+        modules.push_back(shader->shaderModule);
 
         VkPipelineShaderStageCreateInfo stage{};
         stage.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         stage.stage  = MapShaderStage(shader->type);
-        stage.module = shader->shaderModule;
-        stage.pName  = shader->entryPoint.c_str();
+        stage.module = shader->shaderModule->handle;
+        stage.pName  = entryPoints.back().c_str();
         stages.push_back(stage);
     }
 
     //  Vertex Input
-    std::vector<VkVertexInputBindingDescription> vertexBindings;
     for (auto& b : desc.vertexInputState.vertexBindings) {
         vertexBindings.push_back(
             {b.binding, b.stride, b.instanceData ? VK_VERTEX_INPUT_RATE_INSTANCE : VK_VERTEX_INPUT_RATE_VERTEX});
     }
 
-    std::vector<VkVertexInputAttributeDescription> attrs;
     for (auto& a : desc.vertexInputState.attributes) {
         attrs.push_back({a.location, a.binding, ToVulkanFormat(a.format), a.offset});
     }
 
-    VkPipelineVertexInputStateCreateInfo vertexInput{};
     vertexInput.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
     vertexInput.vertexBindingDescriptionCount   = (uint32_t)vertexBindings.size();
     vertexInput.pVertexBindingDescriptions      = vertexBindings.data();
@@ -159,7 +382,6 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
     vertexInput.pVertexAttributeDescriptions    = attrs.data();
 
     //  Input Assembly
-    VkPipelineInputAssemblyStateCreateInfo inputAsm{};
     inputAsm.sType    = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
     inputAsm.topology = ToVulkanTopology(desc.primitiveType);
 
@@ -168,12 +390,10 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
         VK_DYNAMIC_STATE_SCISSOR,
     };
 
-    VkPipelineDynamicStateCreateInfo dynamicState{};
     dynamicState.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     dynamicState.dynamicStateCount = 2;
     dynamicState.pDynamicStates    = kDynamicStates;
 
-    VkPipelineViewportStateCreateInfo viewportState{};
     viewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
     viewportState.viewportCount = 1;
     viewportState.scissorCount  = 1;
@@ -181,7 +401,6 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
     viewportState.pScissors     = nullptr; // nullptr = dynamic
 
     //  Rasterizer
-    VkPipelineRasterizationStateCreateInfo rast{};
     rast.sType       = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
     rast.polygonMode = ToVulkanPolygonMode(desc.rasterizer.fillMode);
     rast.cullMode    = ToVulkanCullMode(desc.rasterizer.cullMode);
@@ -189,19 +408,16 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
     rast.lineWidth   = 1.0f;
 
     //  Multisample
-    VkPipelineMultisampleStateCreateInfo ms{};
     ms.sType                = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
     ms.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
 
     //  Depth
-    VkPipelineDepthStencilStateCreateInfo depth{};
     depth.sType            = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
     depth.depthTestEnable  = desc.depthStencil.depthEnable;
     depth.depthWriteEnable = desc.depthStencil.depthWriteEnable;
     depth.depthCompareOp   = ToVulkanCompareOp(desc.depthStencil.depthFunc);
 
-    auto&                               b = desc.blend;
-    VkPipelineColorBlendAttachmentState blend{};
+    auto& b = desc.blend;
     blend.colorWriteMask =
         VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
 
@@ -217,7 +433,6 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
     blend.dstAlphaBlendFactor = ToVulkanBlendFactor(b.dstAlpha);
     blend.alphaBlendOp        = ToVulkanBlendOp(b.alphaOp);
 
-    VkPipelineColorBlendStateCreateInfo cb{};
     cb.sType             = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
     cb.logicOpEnable     = VK_FALSE;
     cb.attachmentCount   = 1;
@@ -228,18 +443,15 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
     cb.blendConstants[3] = b.blendFactor.a;
 
     // dynamic rendering
-    std::vector<VkFormat> colorAttachmentFormats;
     for (auto format : desc.colorFromats)
         colorAttachmentFormats.push_back(ToVulkanFormat(format));
 
-    VkPipelineRenderingCreateInfo rci{};
     rci.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO;
     rci.colorAttachmentCount    = (uint32_t)colorAttachmentFormats.size();
     rci.pColorAttachmentFormats = colorAttachmentFormats.data();
     rci.depthAttachmentFormat   = ToVulkanFormat(desc.depthFormat);
 
     //  Create Pipeline
-    VkGraphicsPipelineCreateInfo pci{};
     pci.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
     pci.stageCount          = (uint32_t)stages.size();
     pci.pStages             = stages.data();
@@ -257,12 +469,30 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
     auto* layout = g_PipelineLayoutPool.get(desc.layout);
 
     RENDERX_ASSERT_MSG(layout, "Invlaid layout handle");
+    if (!layout)
+        return false;
     pci.layout = layout->vkLayout;
+    if (layout->descriptorBuffer)
+        pci.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    return true;
+}
+
+} // namespace
+
+PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
+    auto& ctx = GetVulkanContext();
+
+    GraphicsPipelineState state;
+    if (!state.build(desc))
+        return PipelineHandle{};
 
-    VkPipeline pipeline;
-    if (vkCreateGraphicsPipelines(ctx.device->logical(), VK_NULL_HANDLE, 1, &pci, nullptr, &pipeline) != VK_SUCCESS) {
+    VkPipeline      pipeline;
+    VkPipelineCache cache  = ctx.pipelineCache->handle();
+    VkResult        result = vkCreateGraphicsPipelines(ctx.device->logical(), cache, 1, &state.pci, nullptr, &pipeline);
+    if (result != VK_SUCCESS) {
         RENDERX_CRITICAL("Failed to create graphics pipeline");
         // destroy the pipeline layout to avoid leaking it
+        auto* layout = g_PipelineLayoutPool.get(desc.layout);
         if (layout->vkLayout != VK_NULL_HANDLE) {
             vkDestroyPipelineLayout(ctx.device->logical(), layout->vkLayout, nullptr);
             g_PipelineLayoutPool.free(desc.layout);
@@ -279,6 +509,160 @@ PipelineHandle VKCreateGraphicsPipeline(PipelineDesc& desc) {
     return handle;
 }
 
+//------------------------------------------------------------------------------
+// Asynchronous pipelines
+//------------------------------------------------------------------------------
+
+VulkanPipelineCompiler::VulkanPipelineCompiler(uint32_t threadCount) {
+    m_Workers.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; i++)
+        m_Workers.emplace_back(&VulkanPipelineCompiler::workerLoop, this);
+}
+
+VulkanPipelineCompiler::~VulkanPipelineCompiler() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_Wake.notify_all();
+    for (auto& worker : m_Workers)
+        worker.join();
+}
+
+void VulkanPipelineCompiler::submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Jobs.push_back(std::move(job));
+    }
+    m_Wake.notify_one();
+}
+
+void VulkanPipelineCompiler::workerLoop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Wake.wait(lock, [this] { return m_Stop || !m_Jobs.empty(); });
+            if (m_Jobs.empty())
+                return; // stopping, and nothing left to compile
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+        job();
+    }
+}
+
+static VulkanPipelineCompiler& GetPipelineCompiler() {
+    auto& ctx = GetVulkanContext();
+    if (!ctx.pipelineCompiler) {
+        // Leaves a core to the render thread; drivers serialize much of the
+        // work past a handful of threads anyway
+        constexpr uint32_t MAX_COMPILE_THREADS = 4;
+        const uint32_t     cores               = std::thread::hardware_concurrency();
+        ctx.pipelineCompiler = new VulkanPipelineCompiler(std::clamp(cores > 1 ? cores - 1 : 1u, 1u, MAX_COMPILE_THREADS));
+    }
+    return *ctx.pipelineCompiler;
+}
+
+void VKCreateGraphicsPipelinesAsync(const PipelineDesc* descs,
+                                    uint32_t            count,
+                                    PipelineHandle*     outPipelines,
+                                    PipelineHandle      fallback) {
+    if (count == 0)
+        return;
+    RENDERX_ASSERT_MSG(descs && outPipelines, "CreateGraphicsPipelinesAsync: descs and outPipelines must not be null");
+
+    auto& ctx = GetVulkanContext();
+
+    auto* fallbackPipe = fallback.isValid() ? g_PipelinePool.get(fallback) : nullptr;
+    if (fallback.isValid() && !fallbackPipe)
+        RENDERX_WARN("CreateGraphicsPipelinesAsync: invalid fallback pipeline, binding will wait instead");
+
+    // The batch is split into one chunk per worker; each chunk is compiled by
+    // a single vkCreateGraphicsPipelines through the shared cache
+    struct Batch {
+        std::vector<std::unique_ptr<GraphicsPipelineState>> states;
+        std::vector<VkGraphicsPipelineCreateInfo>           infos;
+        std::vector<std::shared_ptr<VulkanPipelineCompile>> results;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->states.reserve(count);
+    batch->infos.reserve(count);
+    batch->results.reserve(count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        auto state = std::make_unique<GraphicsPipelineState>();
+        if (!state->build(descs[i])) {
+            outPipelines[i] = {};
+            continue;
+        }
+        // Binding the fallback with another layout would disturb the sets and
+        // push constants the draw expects
+        const bool useFallback = fallbackPipe && fallbackPipe->layout == descs[i].layout;
+        if (fallbackPipe && !useFallback)
+            RENDERX_ERROR("CreateGraphicsPipelinesAsync: pipeline {} does not share the fallback's layout, binding will wait",
+                          i);
+
+        VulkanPipeline vkpipe{};
+        vkpipe.vkPipeline = VK_NULL_HANDLE;
+        vkpipe.layout     = descs[i].layout;
+        vkpipe.compile    = std::make_shared<VulkanPipelineCompile>();
+        vkpipe.fallback   = useFallback ? fallback : PipelineHandle{};
+
+        batch->infos.push_back(state->pci);
+        batch->results.push_back(vkpipe.compile);
+        batch->states.push_back(std::move(state));
+        outPipelines[i] = g_PipelinePool.allocate(vkpipe);
+    }
+    if (batch->infos.empty())
+        return;
+
+    VulkanPipelineCompiler& compiler = GetPipelineCompiler();
+    VkDevice                device   = ctx.device->logical();
+    VkPipelineCache         cache    = ctx.pipelineCache->handle();
+    const uint32_t          total    = (uint32_t)batch->infos.size();
+    const uint32_t          workers  = std::max(1u, compiler.workerCount());
+    const uint32_t          perChunk = (total + workers - 1) / workers;
+
+    for (uint32_t begin = 0; begin < total; begin += perChunk) {
+        const uint32_t n = std::min(perChunk, total - begin);
+        compiler.submit([batch, device, cache, begin, n]() {
+            std::vector<VkPipeline> pipelines(n, VK_NULL_HANDLE);
+
+            // On failure the pipelines that did compile are still returned; the
+            // rest stay VK_NULL_HANDLE
+            VkResult result =
+                vkCreateGraphicsPipelines(device, cache, n, batch->infos.data() + begin, nullptr, pipelines.data());
+            if (result != VK_SUCCESS) {
+                const auto compiled =
+                    std::count_if(pipelines.begin(), pipelines.end(), [](VkPipeline p) { return p != VK_NULL_HANDLE; });
+                RENDERX_ERROR("CreateGraphicsPipelinesAsync: vkCreateGraphicsPipelines failed ({}), {} of {} pipelines compiled",
+                              VkResultToString(result),
+                              compiled,
+                              n);
+            }
+
+            for (uint32_t i = 0; i < n; i++) {
+                auto& compile       = batch->results[begin + i];
+                compile->vkPipeline = pipelines[i];
+                compile->done.store(true, std::memory_order_release);
+                compile->done.notify_all();
+            }
+        });
+    }
+}
+
+PipelineHandle VKCreateGraphicsPipelineAsync(const PipelineDesc& desc, PipelineHandle fallback) {
+    PipelineHandle handle;
+    VKCreateGraphicsPipelinesAsync(&desc, 1, &handle, fallback);
+    return handle;
+}
+
+bool VKIsPipelineReady(PipelineHandle handle) {
+    auto* pipeline = g_PipelinePool.get(handle);
+    return pipeline && pipeline->ready() != VK_NULL_HANDLE;
+}
+
 void VKDestroyPipeline(PipelineHandle& handle) {
     RENDERX_WARN("Not implemented");
 }
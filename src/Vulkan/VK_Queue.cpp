@@ -9,11 +9,12 @@ static bool HasFlag(VkQueueFlags flags, VkQueueFlags bit) {
     return (flags & bit) == bit;
 }
 
-VulkanCommandQueue::VulkanCommandQueue(VkDevice device, VkQueue queue, uint32_t family, QueueType type)
+VulkanCommandQueue::VulkanCommandQueue(VkDevice device, VkQueue queue, uint32_t family, QueueType type, std::mutex& submitMutex)
     : m_Device(device),
       m_Queue(queue),
       m_Family(family),
-      m_Type(type) {
+      m_Type(type),
+      m_SubmitMutex(submitMutex) {
     VkSemaphoreTypeCreateInfo typeInfo{};
     typeInfo.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
     typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
@@ -34,38 +35,99 @@ VkQueue VulkanCommandQueue::Queue() {
     return m_Queue;
 }
 
+namespace {
+
+// Semaphore list for a single vkQueueSubmit2. The first N entries live on the
+// caller's stack; longer lists spill into a thread-local overflow that keeps
+// its capacity between submits, so steady-state submission never allocates
+// and threads submitting to different queues never share scratch memory.
+template <uint32_t N>
+class SemaphoreSubmitList {
+public:
+    explicit SemaphoreSubmitList(std::vector<VkSemaphoreSubmitInfo>& overflow)
+        : m_Overflow(overflow) {
+        m_Overflow.clear();
+    }
+
+    void add(VkSemaphore semaphore, uint64_t value, VkPipelineStageFlags2 stage) {
+        RENDERX_ASSERT_MSG(semaphore != VK_NULL_HANDLE, "SemaphoreSubmitList::add: semaphore is VK_NULL_HANDLE");
+
+        VkSemaphoreSubmitInfo info{};
+        info.sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        info.semaphore   = semaphore;
+        info.value       = value;
+        info.stageMask   = stage;
+        info.deviceIndex = 0;
+
+        if (m_Count < N) {
+            m_Inline[m_Count++] = info;
+            return;
+        }
+        if (m_Count == N)
+            m_Overflow.assign(m_Inline, m_Inline + N);
+        m_Overflow.push_back(info);
+        ++m_Count;
+    }
+
+    uint32_t                     count() const { return m_Count; }
+    const VkSemaphoreSubmitInfo* data() const { return m_Count > N ? m_Overflow.data() : m_Inline; }
+
+private:
+    VkSemaphoreSubmitInfo               m_Inline[N];
+    uint32_t                            m_Count = 0;
+    std::vector<VkSemaphoreSubmitInfo>& m_Overflow;
+};
+
+// +1 for the swapchain acquire/present semaphore, +1 for our own timeline signal
+using WaitList   = SemaphoreSubmitList<SubmitInfo::INLINE_WAITS * 2 + 1>;
+using SignalList = SemaphoreSubmitList<SubmitInfo::INLINE_SIGNALS + 2>;
+
+thread_local std::vector<VkSemaphoreSubmitInfo> t_WaitOverflow;
+thread_local std::vector<VkSemaphoreSubmitInfo> t_SignalOverflow;
+
+VkPipelineStageFlags2 ToSubmitStage(PipelineStage stage) {
+    VkPipelineStageFlags2 flags = MapPipelineStage(stage);
+    return flags ? flags : VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+}
+
+} // namespace
+
 Timeline VulkanCommandQueue::Submit(const SubmitInfo& submitInfo) {
-    m_WaitCount   = 0;
-    m_SignalCount = 0;
+    RENDERX_ASSERT_MSG(submitInfo.commandList, "VulkanCommandQueue::Submit: commandList is null");
 
     auto& ctx = GetVulkanContext();
 
+    WaitList   waits(t_WaitOverflow);
+    SignalList signals(t_SignalOverflow);
+
     for (const auto& dep : submitInfo.waitDependencies) {
+        VulkanCommandQueue* queue = ctx.graphicsQueue;
         switch (dep.waitQueue) {
-        case QueueType::GRAPHICS:
-            addWait2(ctx.graphicsQueue->Semaphore(), dep.waitValue.value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
-            break;
-
         case QueueType::COMPUTE:
-            addWait2(ctx.computeQueue->Semaphore(), dep.waitValue.value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+            queue = ctx.computeQueue;
             break;
-
         case QueueType::TRANSFER:
-            addWait2(ctx.transferQueue->Semaphore(), dep.waitValue.value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+            queue = ctx.transferQueue;
             break;
-
         default:
-            addWait2(ctx.graphicsQueue->Semaphore(), dep.waitValue.value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
             break;
         }
+        // Submission order does not imply completion order, so this holds for
+        // our own timeline too; only a value already reached can be dropped
+        if (dep.waitValue.value == 0 || queue->Poll(dep.waitValue))
+            continue;
+        waits.add(queue->Semaphore(), dep.waitValue.value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
     }
 
-    uint64_t signalValue = ++m_Submitted;
-    addSignal2(m_TimelineSemaphore, signalValue, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    for (const auto& ext : submitInfo.waitSemaphores)
+        waits.add(reinterpret_cast<VkSemaphore>(ext.nativeHandle), ext.value, ToSubmitStage(ext.stage));
+
+    for (const auto& ext : submitInfo.signalSemaphores)
+        signals.add(reinterpret_cast<VkSemaphore>(ext.nativeHandle), ext.value, ToSubmitStage(ext.stage));
 
     if (submitInfo.writesToSwapchain) {
-        addWait2(ctx.swapchain->imageAvail(), 0, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT);
-        addSignal2(ctx.swapchain->renderComplete(), 0, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+        waits.add(ctx.swapchain->imageAvail(), 0, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT);
+        signals.add(ctx.swapchain->renderComplete(), 0, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
     }
 
     VulkanCommandList* list = static_cast<VulkanCommandList*>(submitInfo.commandList);
@@ -74,19 +136,41 @@ Timeline VulkanCommandQueue::Submit(const SubmitInfo& submitInfo) {
     cmdInfo.sType         = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
     cmdInfo.commandBuffer = list->m_CommandBuffer;
 
-    VkSubmitInfo2 submit2{};
-    submit2.sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
-    submit2.waitSemaphoreInfoCount   = m_WaitCount;
-    submit2.pWaitSemaphoreInfos      = m_WaitInfos;
-    submit2.signalSemaphoreInfoCount = m_SignalCount;
-    submit2.pSignalSemaphoreInfos    = m_SignalInfos;
-    submit2.commandBufferInfoCount   = 1;
-    submit2.pCommandBufferInfos      = &cmdInfo;
+    uint64_t signalValue = 0;
+    {
+        // The timeline value must be reserved and submitted under the same lock:
+        // values have to reach the queue in increasing order.
+        std::lock_guard<std::mutex> lock(m_SubmitMutex);
+
+        signalValue = m_Submitted.load(std::memory_order_relaxed) + 1;
+        signals.add(m_TimelineSemaphore, signalValue, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+
+        VkSubmitInfo2 submit2{};
+        submit2.sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+        submit2.waitSemaphoreInfoCount   = waits.count();
+        submit2.pWaitSemaphoreInfos      = waits.data();
+        submit2.signalSemaphoreInfoCount = signals.count();
+        submit2.pSignalSemaphoreInfos    = signals.data();
+        submit2.commandBufferInfoCount   = 1;
+        submit2.pCommandBufferInfos      = &cmdInfo;
+
+        VK_CHECK(vkQueueSubmit2(m_Queue, 1, &submit2, VK_NULL_HANDLE));
+        m_Submitted.store(signalValue, std::memory_order_release);
+    }
 
-    VK_CHECK(vkQueueSubmit2(m_Queue, 1, &submit2, VK_NULL_HANDLE));
     return Timeline(signalValue);
 }
 
+void VulkanCommandQueue::SubmitUntracked(const VkSubmitInfo& info, VkFence fence) {
+    std::lock_guard<std::mutex> lock(m_SubmitMutex);
+    VK_CHECK(vkQueueSubmit(m_Queue, 1, &info, fence));
+}
+
+VkResult VulkanCommandQueue::Present(const VkPresentInfoKHR& info) {
+    std::lock_guard<std::mutex> lock(m_SubmitMutex);
+    return vkQueuePresentKHR(m_Queue, &info);
+}
+
 CommandAllocator* VulkanCommandQueue::CreateCommandAllocator(const char* debugName) {
     VkCommandPoolCreateInfo ci{};
     ci.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -94,7 +178,7 @@ CommandAllocator* VulkanCommandQueue::CreateCommandAllocator(const char* debugNa
     ci.queueFamilyIndex = m_Family;
     VkCommandPool pool;
     vkCreateCommandPool(m_Device, &ci, nullptr, &pool);
-    return new VulkanCommandAllocator(pool, m_Device);
+    return new VulkanCommandAllocator(pool, m_Device, m_Type, debugName);
 }
 
 void VulkanCommandQueue::DestroyCommandAllocator(CommandAllocator* allocator) {
@@ -105,61 +189,9 @@ void VulkanCommandQueue::DestroyCommandAllocator(CommandAllocator* allocator) {
 }
 
 Timeline VulkanCommandQueue::Submit(CommandList* commandList) {
-    VulkanCommandList* list = static_cast<VulkanCommandList*>(commandList);
-
-    const uint64_t                signalValue = ++m_Submitted;
-    VkTimelineSemaphoreSubmitInfo timeline{};
-    timeline.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
-    timeline.signalSemaphoreValueCount = 1;
-    timeline.pSignalSemaphoreValues    = &signalValue;
-
-    VkSubmitInfo submit{};
-    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit.pNext = &timeline;
-
-    submit.commandBufferCount = 1;
-    submit.pCommandBuffers    = &list->m_CommandBuffer;
-
-    submit.signalSemaphoreCount = 1;
-    submit.pSignalSemaphores    = &m_TimelineSemaphore;
-
-    VK_CHECK(vkQueueSubmit(m_Queue, 1, &submit, VK_NULL_HANDLE));
-
-    return Timeline(signalValue);
+    return Submit(SubmitInfo::Single(commandList));
 }
 
-void VulkanCommandQueue::addWait(VkSemaphore semaphore, uint64_t value, VkPipelineStageFlags stage) {
-    RENDERX_ASSERT_MSG(semaphore != VK_NULL_HANDLE, "VulkanCommandQueue::addWait: semaphore is VK_NULL_HANDLE");
-    RENDERX_ASSERT(m_WaitCount < 2);
-    m_WaitSemaphores[m_WaitCount] = semaphore;
-    m_WaitValues[m_WaitCount]     = value;
-    m_WaitStages[m_WaitCount]     = stage;
-    m_WaitCount++;
-}
-
-void VulkanCommandQueue::addWait2(VkSemaphore semaphore, uint64_t value, VkPipelineStageFlags2 stage) {
-    RENDERX_ASSERT(semaphore != VK_NULL_HANDLE);
-    RENDERX_ASSERT(m_SignalCount <= 4);
-    m_WaitInfos[m_WaitCount].sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-    m_WaitInfos[m_WaitCount].pNext       = nullptr;
-    m_WaitInfos[m_WaitCount].semaphore   = semaphore;
-    m_WaitInfos[m_WaitCount].value       = value;
-    m_WaitInfos[m_WaitCount].stageMask   = stage;
-    m_WaitInfos[m_WaitCount].deviceIndex = 0;
-    m_WaitCount++;
-}
-void VulkanCommandQueue::addSignal2(VkSemaphore semaphore, uint64_t value, VkPipelineStageFlags2 stage) {
-    RENDERX_ASSERT(semaphore != VK_NULL_HANDLE);
-    RENDERX_ASSERT(m_SignalCount <= 2);
-    m_SignalInfos[m_SignalCount].sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-    m_SignalInfos[m_SignalCount].pNext       = nullptr;
-    m_SignalInfos[m_SignalCount].semaphore   = semaphore;
-    m_SignalInfos[m_SignalCount].value       = value;
-    m_SignalInfos[m_SignalCount].stageMask   = stage;
-    m_SignalInfos[m_SignalCount].deviceIndex = 0;
-    m_SignalCount++;
-};
-
 bool VulkanCommandQueue::Wait(Timeline value, uint64_t timeout) {
     VkSemaphoreWaitInfo info{};
     info.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
@@ -170,29 +202,35 @@ bool VulkanCommandQueue::Wait(Timeline value, uint64_t timeout) {
 }
 
 void VulkanCommandQueue::WaitIdle() {
+    const uint64_t submitted = m_Submitted.load(std::memory_order_acquire);
+
     VkSemaphoreWaitInfo info{};
     info.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
     info.semaphoreCount = 1;
     info.pSemaphores    = &m_TimelineSemaphore;
-    info.pValues        = &m_Submitted;
+    info.pValues        = &submitted;
     CheckVk(vkWaitSemaphores(m_Device, &info, UINT64_MAX));
 }
 
 bool VulkanCommandQueue::Poll(Timeline value) {
-    if (value.value == 0 || value.value > m_Submitted)
+    if (value.value == 0 || value.value > m_Submitted.load(std::memory_order_acquire))
         return false;
 
-    vkGetSemaphoreCounterValue(m_Device, m_TimelineSemaphore, &m_Completed);
-    return value.value < m_Completed;
+    if (value.value <= m_Completed.load(std::memory_order_relaxed))
+        return true;
+
+    return value.value <= Completed().value;
 }
 
 Timeline VulkanCommandQueue::Completed() {
-    vkGetSemaphoreCounterValue(m_Device, m_TimelineSemaphore, &m_Completed);
-    return Timeline(m_Completed);
+    uint64_t completed = 0;
+    vkGetSemaphoreCounterValue(m_Device, m_TimelineSemaphore, &completed);
+    m_Completed.store(completed, std::memory_order_relaxed);
+    return Timeline(completed);
 }
 
 Timeline VulkanCommandQueue::Submitted() const {
-    return Timeline(m_Submitted);
+    return Timeline(m_Submitted.load(std::memory_order_acquire));
 }
 
 float VulkanCommandQueue::TimestampFrequency() const {
@@ -12,24 +12,43 @@ void VKBackendInit(const InitDesc& window) {
 
     VulkanContext& ctx = GetVulkanContext();
     ctx.instance       = new VulkanInstance(window);
-    ctx.device =
-        new VulkanDevice(ctx.instance->getInstance(),
-                         ctx.instance->getSurface(),
-                         std::vector<const char*>(g_RequestedDeviceExtensions.begin(), g_RequestedDeviceExtensions.end()),
-                         std::vector<const char*>(g_RequestedValidationLayers.begin(), g_RequestedValidationLayers.end()));
+
+    // Without a surface there is nothing to present to; drivers without
+    // VK_KHR_swapchain (compute-only, software) still initialize
+    std::vector<const char*> deviceExtensions(g_RequestedDeviceExtensions.begin(), g_RequestedDeviceExtensions.end());
+    if (ctx.instance->getSurface() == VK_NULL_HANDLE)
+        std::erase_if(deviceExtensions, [](const char* ext) { return std::strcmp(ext, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0; });
+
+    std::vector<const char*> validationLayers(g_RequestedValidationLayers.begin(), g_RequestedValidationLayers.end());
+    ctx.device = new VulkanDevice(ctx.instance->getInstance(), ctx.instance->getSurface(), deviceExtensions, validationLayers);
+    ctx.pipelineCache = new VulkanPipelineCache(*ctx.device, window.pipelineCachePath);
 
     ctx.swapchain     = new VulkanSwapchain();
     ctx.graphicsQueue = new VulkanCommandQueue(
-        ctx.device->logical(), ctx.device->graphicsQueue(), ctx.device->graphicsFamily(), QueueType::GRAPHICS);
+        ctx.device->logical(),
+        ctx.device->graphicsQueue(),
+        ctx.device->graphicsFamily(),
+        QueueType::GRAPHICS,
+        ctx.device->queueMutex(ctx.device->graphicsQueue()));
     ctx.computeQueue = new VulkanCommandQueue(
-        ctx.device->logical(), ctx.device->computeQueue(), ctx.device->computeFamily(), QueueType::COMPUTE);
+        ctx.device->logical(),
+        ctx.device->computeQueue(),
+        ctx.device->computeFamily(),
+        QueueType::COMPUTE,
+        ctx.device->queueMutex(ctx.device->computeQueue()));
     ctx.transferQueue = new VulkanCommandQueue(
-        ctx.device->logical(), ctx.device->transferQueue(), ctx.device->transferFamily(), QueueType::TRANSFER);
+        ctx.device->logical(),
+        ctx.device->transferQueue(),
+        ctx.device->transferFamily(),
+        QueueType::TRANSFER,
+        ctx.device->queueMutex(ctx.device->transferQueue()));
     ctx.allocator               = new VulkanAllocator(ctx.instance->getInstance(), ctx.device->physical(), ctx.device->logical());
     ctx.stagingAllocator        = new VulkanStagingAllocator(ctx);
     ctx.immediateUploader       = new VulkanImmediateUploader(ctx);
     ctx.deferredUploader        = new VulkanDeferredUploader(ctx);
-    ctx.loadTimeStagingUploader = new VulkanLoadTimeStagingUploader(ctx);
+    ctx.loadTimeStagingUploader = new VulkanLoadTimeStagingUploader(
+        ctx, window.uploadChunkBytes ? window.uploadChunkBytes : VulkanLoadTimeStagingUploader::DEFAULT_CHUNK_SIZE);
+    ctx.deletionQueue           = new VulkanDeletionQueue(ctx);
 }
 
 void VKBackendShutdown() {
@@ -8,13 +8,55 @@ ResourcePool<VulkanSetLayout, SetLayoutHandle>           g_SetLayoutPool;
 ResourcePool<VulkanDescriptorPool, DescriptorPoolHandle> g_DescriptorPoolPool;
 ResourcePool<VulkanSet, SetHandle>                       g_SetPool;
 ResourcePool<VulkanDescriptorHeap, DescriptorHeapHandle> g_DescriptorHeapPool;
+ResourcePool<VulkanBindlessTable, BindlessTableHandle>   g_BindlessTablePool;
 
 SetLayoutHandle VKCreateSetLayout(const SetLayoutDesc& desc) {
     auto& ctx = GetVulkanContext();
 
+    if (desc.descriptorBuffer && !ctx.device->hasDescriptorBuffer()) {
+        RENDERX_ERROR("VKCreateSetLayout: '{}' is a DESCRIPTOR_BUFFER layout but VK_EXT_descriptor_buffer is not available",
+                      desc.debugName ? desc.debugName : "unnamed");
+        return {};
+    }
+
+    if (desc.pushDescriptor) {
+        bool bindless = false;
+        for (uint32_t i = 0; i < desc.count; i++)
+            bindless |= desc.bindings[i].count == UINT32_MAX || desc.bindings[i].updateAfterBind;
+        if (desc.descriptorBuffer || bindless) {
+            RENDERX_ERROR("VKCreateSetLayout: push descriptor layout '{}' cannot be DESCRIPTOR_BUFFER or hold bindless bindings",
+                          desc.debugName ? desc.debugName : "unnamed");
+            return {};
+        }
+    }
+
+    // Dynamic offsets only exist for classic sets bound with vkCmdBindDescriptorSets
+    uint32_t dynamicCount = 0;
+    for (uint32_t i = 0; i < desc.count; i++) {
+        const Binding& b = desc.bindings[i];
+        if (!IsDynamicResource(b.type))
+            continue;
+        if (desc.descriptorBuffer || desc.pushDescriptor || b.updateAfterBind || b.count == UINT32_MAX) {
+            RENDERX_ERROR("VKCreateSetLayout: dynamic binding {} of '{}' needs a classic, non-bindless, non-push layout",
+                          b.slot,
+                          desc.debugName ? desc.debugName : "unnamed");
+            return {};
+        }
+        dynamicCount += b.count;
+    }
+    if (dynamicCount > VulkanSetLayout::MAX_DYNAMIC_DESCRIPTORS) {
+        RENDERX_ERROR("VKCreateSetLayout: '{}' has {} dynamic descriptors, at most {} are supported",
+                      desc.debugName ? desc.debugName : "unnamed",
+                      dynamicCount,
+                      VulkanSetLayout::MAX_DYNAMIC_DESCRIPTORS);
+        return {};
+    }
+
     VulkanSetLayout internal;
-    internal.debugName    = desc.debugName;
-    internal.bindingCount = desc.count;
+    internal.debugName        = desc.debugName;
+    internal.bindingCount     = desc.count;
+    internal.descriptorBuffer = desc.descriptorBuffer;
+    internal.pushDescriptor   = desc.pushDescriptor;
 
     // Build VkDescriptorSetLayoutBinding array
     VkDescriptorSetLayoutBinding vkBindings[SetLayoutDesc::MAX_BINDINGS];
@@ -32,7 +74,9 @@ SetLayoutHandle VKCreateSetLayout(const SetLayoutDesc& desc) {
         vkBindings[i].pImmutableSamplers = nullptr;
 
         bindingFlags[i] = 0;
-        if (b.updateAfterBind) {
+        // Descriptor buffer memory may always be written while the GPU reads
+        // other sets, and the layout flags are mutually exclusive
+        if (b.updateAfterBind && !desc.descriptorBuffer) {
             bindingFlags[i]             |= VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
             needsBindingFlags            = true;
             internal.hasUpdateAfterBind  = true;
@@ -41,6 +85,10 @@ SetLayoutHandle VKCreateSetLayout(const SetLayoutDesc& desc) {
             bindingFlags[i]   |= VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
             needsBindingFlags  = true;
         }
+        // Bindless arrays get new entries while earlier submits still index
+        // other elements of the same set
+        if (b.updateAfterBind && b.partiallyBound && !desc.descriptorBuffer)
+            bindingFlags[i] |= VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
         if (b.nonUniformIndex) {
             // nonuniform indexing is declared in the shader, no layout flag needed
             // but we do need VARIABLE_DESCRIPTOR_COUNT for runtime-sized arrays
@@ -52,13 +100,24 @@ SetLayoutHandle VKCreateSetLayout(const SetLayoutDesc& desc) {
 
         // Cache internally
         internal.bindings[i].slot            = b.slot;
+        internal.bindings[i].type            = b.type;
         internal.bindings[i].vkType          = vkBindings[i].descriptorType;
         internal.bindings[i].count           = vkBindings[i].descriptorCount;
         internal.bindings[i].stages          = vkBindings[i].stageFlags;
         internal.bindings[i].updateAfterBind = b.updateAfterBind;
         internal.bindings[i].partiallyBound  = b.partiallyBound;
+        internal.bindings[i].byteOffset      = 0;
 
         internal.totalDescriptorCount += vkBindings[i].descriptorCount;
+
+        if (IsDynamicResource(b.type)) {
+            const auto&    limits    = ctx.device->limits();
+            const uint32_t alignment = (uint32_t)(b.type == ResourceType::DYNAMIC_CONSTANT_BUFFER
+                                                      ? limits.minUniformBufferOffsetAlignment
+                                                      : limits.minStorageBufferOffsetAlignment);
+            internal.dynamicCount     += b.count;
+            internal.dynamicAlignment  = std::max(internal.dynamicAlignment, alignment);
+        }
     }
 
     // Build the create info
@@ -67,6 +126,10 @@ SetLayoutHandle VKCreateSetLayout(const SetLayoutDesc& desc) {
     layoutCI.bindingCount                    = desc.count;
     layoutCI.pBindings                       = vkBindings;
     layoutCI.flags                           = 0;
+    if (desc.descriptorBuffer)
+        layoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    if (desc.pushDescriptor && ctx.device->hasPushDescriptor())
+        layoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
 
     // If any binding has UPDATE_AFTER_BIND, the layout itself needs the flag
     VkDescriptorSetLayoutBindingFlagsCreateInfo flagsCI = {};
@@ -83,6 +146,48 @@ SetLayoutHandle VKCreateSetLayout(const SetLayoutDesc& desc) {
 
     VK_CHECK(vkCreateDescriptorSetLayout(ctx.device->logical(), &layoutCI, nullptr, &internal.vkLayout));
 
+    // Hardware footprint of a set in heap memory; writes land at these offsets
+    if (desc.descriptorBuffer) {
+        const auto& ext = ctx.device->ext();
+        ext.getDescriptorSetLayoutSize(ctx.device->logical(), internal.vkLayout, &internal.descriptorBufferSize);
+        for (uint32_t i = 0; i < desc.count; i++) {
+            ext.getDescriptorSetLayoutBindingOffset(
+                ctx.device->logical(), internal.vkLayout, internal.bindings[i].slot, &internal.bindings[i].byteOffset);
+        }
+    }
+
+    // One template entry per binding over a tightly packed array of
+    // VulkanPackedDescriptor, so WriteSetPacked never builds VkWriteDescriptorSets.
+    // Push layouts have no sets to write.
+    if (!desc.descriptorBuffer && !desc.pushDescriptor &&
+        internal.totalDescriptorCount <= VulkanSetLayout::MAX_TEMPLATE_DESCRIPTORS) {
+        VkDescriptorUpdateTemplateEntry entries[SetLayoutDesc::MAX_BINDINGS];
+        uint32_t                        entryCount = 0;
+        size_t                          offset     = 0;
+        for (uint32_t i = 0; i < desc.count; i++) {
+            if (internal.bindings[i].count == 0)
+                continue;
+            VkDescriptorUpdateTemplateEntry& entry = entries[entryCount++];
+            entry.dstBinding                       = internal.bindings[i].slot;
+            entry.dstArrayElement                  = 0;
+            entry.descriptorCount                  = internal.bindings[i].count;
+            entry.descriptorType                   = internal.bindings[i].vkType;
+            entry.offset                           = offset;
+            entry.stride                           = sizeof(VulkanPackedDescriptor);
+            offset += internal.bindings[i].count * sizeof(VulkanPackedDescriptor);
+        }
+
+        VkDescriptorUpdateTemplateCreateInfo templateCI = {};
+        templateCI.sType                                = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateCI.descriptorUpdateEntryCount           = entryCount;
+        templateCI.pDescriptorUpdateEntries             = entries;
+        templateCI.templateType                         = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateCI.descriptorSetLayout                  = internal.vkLayout;
+
+        if (entryCount > 0)
+            VK_CHECK(vkCreateDescriptorUpdateTemplate(ctx.device->logical(), &templateCI, nullptr, &internal.updateTemplate));
+    }
+
     if (desc.debugName) {
         // TODO---------------------------------------------------------------------
         //  set debug name via vkSetDebugUtilsObjectNameEXT if available
@@ -98,10 +203,72 @@ void VKDestroySetLayout(SetLayoutHandle& handle) {
     if (!layout)
         return;
 
+    if (layout->updateTemplate != VK_NULL_HANDLE)
+        vkDestroyDescriptorUpdateTemplate(ctx.device->logical(), layout->updateTemplate, nullptr);
     vkDestroyDescriptorSetLayout(ctx.device->logical(), layout->vkLayout, nullptr);
     g_SetLayoutPool.free(handle);
 }
 
+// One VkDescriptorPool of a DESCRIPTOR_SETS pool chain. With a layout, it
+// holds exactly `capacity` sets of it; without one it falls back to
+// `capacity` descriptors of every type.
+static VkDescriptorPool CreateChainPool(const VulkanDescriptorPool& pool) {
+    const bool allowFree = Has(pool.flags, DescriptorPoolFlags::POOL);
+
+    if (auto* layout = g_SetLayoutPool.get(pool.layout)) {
+        const VkDescriptorPoolSizeList sizes = ComputePoolSizes(*layout, pool.capacity);
+        if (sizes.count > 0)
+            return CreateDescriptorPool(
+                sizes, pool.capacity, allowFree, pool.updateAfterBind || layout->hasUpdateAfterBind);
+    }
+    return CreateDescriptorPool(DescriptorPoolSizes(pool.capacity), allowFree, pool.updateAfterBind);
+}
+
+// Allocates `count` sets from the active VkDescriptorPool. When it is full, a
+// growable pool tries the rest of its chain (POOL frees can open space
+// anywhere) and then appends a new VkDescriptorPool.
+static VkResult AllocateFromChain(VulkanDescriptorPool&        pool,
+                                  const VkDescriptorSetLayout* layouts,
+                                  uint32_t                     count,
+                                  VkDescriptorSet*             outSets) {
+    auto& ctx = GetVulkanContext();
+
+    VkDescriptorSetAllocateInfo allocInfo = {};
+    allocInfo.sType                       = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool              = pool.vkPool;
+    allocInfo.descriptorSetCount          = count;
+    allocInfo.pSetLayouts                 = layouts;
+
+    VkResult result = vkAllocateDescriptorSets(ctx.device->logical(), &allocInfo, outSets);
+    if (!pool.growable || (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL))
+        return result;
+
+    const uint32_t chainSize = (uint32_t)pool.vkPools.size();
+    for (uint32_t i = 1; i <= chainSize; i++) {
+        const bool fresh = i == chainSize;
+        if (fresh) {
+            VkDescriptorPool next = CreateChainPool(pool);
+            if (next == VK_NULL_HANDLE)
+                return VK_ERROR_OUT_OF_POOL_MEMORY;
+            pool.vkPools.push_back(next);
+            pool.activePool = chainSize;
+            RENDERX_INFO("DescriptorPool '{}' grew to {} VkDescriptorPools",
+                         pool.debugName ? pool.debugName : "unnamed",
+                         pool.vkPools.size());
+        } else {
+            pool.activePool = (pool.activePool + 1) % chainSize;
+        }
+        pool.vkPool = pool.vkPools[pool.activePool];
+
+        allocInfo.descriptorPool = pool.vkPool;
+        result                   = vkAllocateDescriptorSets(ctx.device->logical(), &allocInfo, outSets);
+        // A fresh pool that cannot hold the request never will
+        if (fresh || (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL))
+            return result;
+    }
+    return result;
+}
+
 DescriptorPoolHandle VKCreateDescriptorPool(const DescriptorPoolDesc& desc) {
     auto& ctx = GetVulkanContext();
 
@@ -125,56 +292,48 @@ DescriptorPoolHandle VKCreateDescriptorPool(const DescriptorPoolDesc& desc) {
 
     if (isDescriptorSets) {
         // ── Classic Vulkan pool path ─────────────────────────────────────
-        // Get the layout to compute pool sizes
-        // auto* layout = g_SetLayoutPool.get(desc.layout);
-        // RENDERX_ASSERT_MSG(layout, "DescriptorPool: invalid SetLayoutHandle");
-
-        // VkDescriptorPoolSize poolSizes[7]
-
-        // VkDescriptorPoolCreateInfo poolCI = {};
-        // poolCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        // poolCI.maxSets                    = desc.capacity;
-        // poolCI.poolSizeCount              = 16;
-        // poolCI.pPoolSizes                 = poolSizes;
-        // poolCI.flags                      = 0;
-
-        // // POOL policy: individual sets can be freed
-        // if (isPool) {
-        //     poolCI.flags |= VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
-        // }
-        // // UPDATE_AFTER_BIND: GPU can read while CPU writes
-        // if (desc.updateAfterBind) {
-        //     poolCI.flags |= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
-        // }
-
-        // VK_CHECK(vkCreateDescriptorPool(ctx.device->logical(), &poolCI, nullptr, &internal.vkPool));
-
-        internal.vkPool = CreateDescriptorPool(DescriptorPoolSizes(desc.capacity), isPool, desc.updateAfterBind);
+        internal.growable = desc.growable;
+        internal.vkPool   = CreateChainPool(internal);
+        if (internal.vkPool == VK_NULL_HANDLE) {
+            RENDERX_ERROR("VKCreateDescriptorPool: vkCreateDescriptorPool failed for '{}'",
+                          desc.debugName ? desc.debugName : "unnamed");
+            return {};
+        }
+        internal.vkPools.push_back(internal.vkPool);
 
     } else {
         // ---- Descriptor buffer path ----------------------------------------------
-        // No VkDescriptorPool — we suballocate from the user's heap.
-        // Compute the stride per set from the layout.
-        auto* layout = g_SetLayoutPool.get(desc.layout);
-        if (layout) {
-            // For the descriptor buffer path, stride comes from
-            // vkGetDescriptorSetLayoutSizeEXT if the extension is available.
-            // For now we use a conservative calculation:
-            // each binding needs descriptorCount * descriptorSize bytes
-            // We'll compute proper alignment in GetLayoutMemoryInfo.
-
-            // Basic stride: sum of all binding sizes, aligned to
-            // VkPhysicalDeviceDescriptorBufferPropertiesEXT::descriptorBufferOffsetAlignment
-            // Since we may not have the extension, default to 256 byte alignment
-            uint64_t stride = 0;
-            for (uint32_t i = 0; i < layout->bindingCount; i++) {
-                // Each descriptor is 64 bytes (conservative upper bound)
-                // Real size from VkPhysicalDeviceDescriptorBufferPropertiesEXT
-                stride += layout->bindings[i].count * 64;
+        // No VkDescriptorPool — sets are suballocated from the user's heap at
+        // the layout's hardware size, aligned for vkCmdSetDescriptorBufferOffsetsEXT
+        auto*          heap      = g_DescriptorHeapPool.get(desc.heap);
+        const uint64_t alignment = ctx.device->descriptorBufferProperties().descriptorBufferOffsetAlignment;
+        if (!heap) {
+            RENDERX_ERROR("VKCreateDescriptorPool: DESCRIPTOR_BUFFER pool needs a valid heap");
+            return {};
+        }
+        if (desc.heapOffset % alignment != 0) {
+            RENDERX_ERROR("VKCreateDescriptorPool: heap offset {} is not a multiple of {}", desc.heapOffset, alignment);
+            return {};
+        }
+
+        uint64_t byteSize = desc.capacity;
+        if (!Has(desc.flags, DescriptorPoolFlags::MANUAL)) {
+            auto* layout = g_SetLayoutPool.get(desc.layout);
+            if (!layout || !layout->descriptorBuffer) {
+                RENDERX_ERROR("VKCreateDescriptorPool: DESCRIPTOR_BUFFER pool needs a layout created with setDescriptorBuffer()");
+                return {};
             }
-            // Align to 256 bytes
-            stride                = (stride + 255) & ~255ull;
-            internal.stridePerSet = stride;
+            internal.stridePerSet = ALIGNUP(layout->descriptorBufferSize, alignment);
+            byteSize              = internal.stridePerSet * desc.capacity;
+        }
+
+        if (desc.heapOffset + byteSize > heap->size) {
+            RENDERX_ERROR("VKCreateDescriptorPool: {} bytes at offset {} do not fit heap '{}' ({} bytes)",
+                          byteSize,
+                          desc.heapOffset,
+                          heap->debugName ? heap->debugName : "unnamed",
+                          heap->size);
+            return {};
         }
 
         // POOL policy: pre-populate freelist
@@ -195,9 +354,11 @@ void VKDestroyDescriptorPool(DescriptorPoolHandle& handle) {
     if (!pool)
         return;
 
-    if (pool->vkPool != VK_NULL_HANDLE) {
-        vkDestroyDescriptorPool(ctx.device->logical(), pool->vkPool, nullptr);
-    }
+    for (VkDescriptorPool vkPool : pool->vkPools)
+        vkDestroyDescriptorPool(ctx.device->logical(), vkPool, nullptr);
+    for (SetHandle set : pool->linearSets)
+        g_SetPool.free(set);
+    DropCachedSetsFromPool(handle);
 
     g_DescriptorPoolPool.free(handle);
 }
@@ -213,13 +374,21 @@ void VKResetDescriptorPool(DescriptorPoolHandle handle) {
 
     if (Has(pool->flags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
         // VK:    vkResetDescriptorPool — invalidates all sets from this pool
-        // User must ensure GPU is done before calling this
-        VK_CHECK(vkResetDescriptorPool(ctx.device->logical(), pool->vkPool, 0));
+        // User must ensure GPU is done before calling this. Grown pools are
+        // kept, so a steady-state frame never creates one again.
+        for (VkDescriptorPool vkPool : pool->vkPools)
+            VK_CHECK(vkResetDescriptorPool(ctx.device->logical(), vkPool, 0));
+        pool->activePool = 0;
+        pool->vkPool     = pool->vkPools[0];
 
     } else {
         // DESCRIPTOR_BUFFER path: just move the write pointer back
-        pool->writePtr = pool->heapBaseOffset;
+        pool->writePtr = 0;
     }
+
+    for (SetHandle set : pool->linearSets)
+        g_SetPool.free(set);
+    pool->linearSets.clear();
 }
 
 SetHandle VKAllocateSet(DescriptorPoolHandle poolHandle, SetLayoutHandle layoutHandle) {
@@ -235,17 +404,14 @@ SetHandle VKAllocateSet(DescriptorPoolHandle poolHandle, SetLayoutHandle layoutH
 
     if (Has(pool->flags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
         // ── Classic VK path ──────────────────────────────────────────────
-        auto& ctx = GetVulkanContext();
-
-        VkDescriptorSetAllocateInfo allocInfo = {};
-        allocInfo.sType                       = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocInfo.descriptorPool              = pool->vkPool;
-        allocInfo.descriptorSetCount          = 1;
-        allocInfo.pSetLayouts                 = &layout->vkLayout;
-
-        VkResult result = vkAllocateDescriptorSets(ctx.device->logical(), &allocInfo, &internal.vkSet);
-
-        RENDERX_ASSERT_MSG(result == VK_SUCCESS, "AllocateSet: vkAllocateDescriptorSets failed: {}", VkResultToString(result));
+        VkResult result = AllocateFromChain(*pool, &layout->vkLayout, 1, &internal.vkSet);
+        if (result != VK_SUCCESS) {
+            RENDERX_ERROR("AllocateSet: pool '{}' is out of sets or descriptors ({}); use DescriptorPoolDesc::setGrowable",
+                          pool->debugName ? pool->debugName : "unnamed",
+                          VkResultToString(result));
+            return {};
+        }
+        internal.vkPool = pool->vkPool;
 
     } else {
         // ── Descriptor buffer path ───────────────────────────────────────
@@ -255,21 +421,26 @@ SetHandle VKAllocateSet(DescriptorPoolHandle poolHandle, SetLayoutHandle layoutH
         bool isManual = Has(pool->flags, DescriptorPoolFlags::MANUAL);
 
         if (isLinear) {
-            // Bump allocate
-            uint64_t offset = pool->heapBaseOffset + pool->writePtr;
-            // Align to 256 bytes
-            offset = (offset + 255) & ~255ull;
-
-            RENDERX_ASSERT_MSG((offset - pool->heapBaseOffset + pool->stridePerSet) <= (pool->capacity * pool->stridePerSet),
-                               "AllocateSet: descriptor buffer pool is full");
+            // Bump allocate; the stride is already a multiple of the offset alignment
+            if (pool->writePtr + pool->stridePerSet > (uint64_t)pool->capacity * pool->stridePerSet) {
+                RENDERX_ERROR("AllocateSet: LINEAR pool '{}' is full ({} sets); reset it or raise its capacity",
+                              pool->debugName ? pool->debugName : "unnamed",
+                              pool->capacity);
+                return {};
+            }
 
             internal.heapHandle = pool->heapHandle;
-            internal.byteOffset = offset;
+            internal.byteOffset = pool->heapBaseOffset + pool->writePtr;
 
-            pool->writePtr = (offset - pool->heapBaseOffset) + pool->stridePerSet;
+            pool->writePtr += pool->stridePerSet;
 
         } else if (isPool) {
-            RENDERX_ASSERT_MSG(!pool->freeSlots.empty(), "AllocateSet: POOL is full");
+            if (pool->freeSlots.empty()) {
+                RENDERX_ERROR("AllocateSet: POOL pool '{}' has no free slots ({} sets); free sets or raise its capacity",
+                              pool->debugName ? pool->debugName : "unnamed",
+                              pool->capacity);
+                return {};
+            }
 
             uint32_t slot = pool->freeSlots.back();
             pool->freeSlots.pop_back();
@@ -284,7 +455,10 @@ SetHandle VKAllocateSet(DescriptorPoolHandle poolHandle, SetLayoutHandle layoutH
         }
     }
 
-    return g_SetPool.allocate(std::move(internal));
+    SetHandle set = g_SetPool.allocate(std::move(internal));
+    if (Has(pool->flags, DescriptorPoolFlags::LINEAR))
+        pool->linearSets.push_back(set);
+    return set;
 }
 
 // Batch allocation — one vkAllocateDescriptorSets call for DESCRIPTOR_SETS path
@@ -297,30 +471,32 @@ void VKAllocateSets(DescriptorPoolHandle poolHandle, SetLayoutHandle layoutHandl
 
     if (Has(pool->flags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
         // ── Classic VK path — one API call for all sets ───────────────────
-        auto& ctx = GetVulkanContext();
-
         // Fill layout array — all sets use the same layout
         std::vector<VkDescriptorSetLayout> layouts(count, layout->vkLayout);
         std::vector<VkDescriptorSet>       vkSets(count, VK_NULL_HANDLE);
 
-        VkDescriptorSetAllocateInfo allocInfo = {};
-        allocInfo.sType                       = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocInfo.descriptorPool              = pool->vkPool;
-        allocInfo.descriptorSetCount          = count;
-        allocInfo.pSetLayouts                 = layouts.data();
-
-        VkResult result = vkAllocateDescriptorSets(ctx.device->logical(), &allocInfo, vkSets.data());
-
-        RENDERX_ASSERT_MSG(result == VK_SUCCESS, "AllocateSets: vkAllocateDescriptorSets failed: {}", VkResultToString(result));
+        VkResult result = AllocateFromChain(*pool, layouts.data(), count, vkSets.data());
+        if (result != VK_SUCCESS) {
+            RENDERX_ERROR("AllocateSets: pool '{}' cannot hold {} more sets ({}); use DescriptorPoolDesc::setGrowable",
+                          pool->debugName ? pool->debugName : "unnamed",
+                          count,
+                          VkResultToString(result));
+            for (uint32_t i = 0; i < count; i++)
+                outSets[i] = {};
+            return;
+        }
 
         // Wrap each VkDescriptorSet into a SetHandle
         for (uint32_t i = 0; i < count; i++) {
             VulkanSet internal;
             internal.poolFlags    = pool->flags;
             internal.vkSet        = vkSets[i];
+            internal.vkPool       = pool->vkPool;
             internal.poolHandle   = poolHandle;
             internal.layoutHandle = layoutHandle;
             outSets[i]            = g_SetPool.allocate(std::move(internal));
+            if (Has(pool->flags, DescriptorPoolFlags::LINEAR))
+                pool->linearSets.push_back(outSets[i]);
         }
 
     } else {
@@ -345,7 +521,7 @@ void VKFreeSet(DescriptorPoolHandle poolHandle, SetHandle& setHandle) {
     if (Has(pool->flags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
         auto& ctx = GetVulkanContext();
         // VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT was set at pool creation
-        vkFreeDescriptorSets(ctx.device->logical(), pool->vkPool, 1, &set->vkSet);
+        vkFreeDescriptorSets(ctx.device->logical(), set->vkPool, 1, &set->vkSet);
 
     } else {
         // Descriptor buffer path: return the slot to the pool's freelist
@@ -357,327 +533,559 @@ void VKFreeSet(DescriptorPoolHandle poolHandle, SetHandle& setHandle) {
     g_SetPool.free(setHandle);
 }
 
-// Write a single resource into a VkDescriptorSet
-static void WriteVkDescriptorSingle(
-    VkDevice device, VkDescriptorSet dstSet, uint32_t dstBinding, ResourceType type, uint64_t resourceHandle) {
-    VkWriteDescriptorSet write = {};
-    write.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    write.dstSet               = dstSet;
-    write.dstBinding           = dstBinding;
-    write.dstArrayElement      = 0;
-    write.descriptorCount      = 1;
-    write.descriptorType       = ToVulkanDescriptorType(type);
-
-    // We need the actual Vulkan object from the handle.
-    // The handle encodes either a BufferViewHandle.id or TextureViewHandle.id.
-    // Look them up from the global pools.
-
-    VkDescriptorBufferInfo bufInfo = {};
-    VkDescriptorImageInfo  imgInfo = {};
+//------------------------------------------------------------------------------
+// Descriptor writes
+//------------------------------------------------------------------------------
+// Every DESCRIPTOR_SETS write funnels through AppendVkWrites: one
+// VkWriteDescriptorSet per DescriptorWrite, covering all of its array
+// elements, with the image/buffer infos in per-thread scratch that only grows.
+// A write of any size is one vkUpdateDescriptorSets and, once warm, no
+// allocation.
+
+static_assert(sizeof(VkDescriptorImageInfo) == sizeof(VkDescriptorBufferInfo),
+              "VulkanPackedDescriptor arrays double as pImageInfo and pBufferInfo arrays");
+
+thread_local std::vector<VkWriteDescriptorSet>   t_VkWrites;
+thread_local std::vector<VulkanPackedDescriptor> t_VkInfos;
+
+static uint32_t CountDescriptors(const DescriptorWrite* writes, uint32_t writeCount) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < writeCount; i++)
+        count += writes[i].count;
+    return count;
+}
 
-    switch (type) {
+// Resolves element `e` of `w`; false when a handle is invalid or the type
+// cannot be written
+static bool TranslateDescriptor(const DescriptorWrite& w, uint32_t e, VulkanPackedDescriptor& out) {
+    switch (w.type) {
     case ResourceType::CONSTANT_BUFFER:
     case ResourceType::STORAGE_BUFFER:
-    case ResourceType::RW_STORAGE_BUFFER: {
-        // resourceHandle is a BufferViewHandle id
-        BufferViewHandle bvHandle;
-        bvHandle.id   = resourceHandle;
-        auto* bufView = g_BufferViewPool.get(bvHandle);
-        RENDERX_ASSERT_MSG(bufView, "WriteSet: invalid BufferViewHandle");
-
-        auto* buf = g_BufferPool.get(bufView->buffer);
-        RENDERX_ASSERT_MSG(buf, "WriteSet: invalid BufferHandle in view");
-
-        bufInfo.buffer = buf->buffer;
-        bufInfo.offset = bufView->offset;
-        bufInfo.range  = (bufView->range == 0) ? VK_WHOLE_SIZE : bufView->range;
-
-        write.pBufferInfo = &bufInfo;
-        break;
-    }
-
-    case ResourceType::TEXTURE_SRV: {
-        TextureViewHandle tvHandle;
-        tvHandle.id   = resourceHandle;
-        auto* texView = g_TextureViewPool.get(tvHandle);
-        RENDERX_ASSERT_MSG(texView, "WriteSet: invalid TextureViewHandle for SRV");
-
-        imgInfo.imageView   = texView->view;
-        imgInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        imgInfo.sampler     = VK_NULL_HANDLE;
-
-        write.pImageInfo = &imgInfo;
-        break;
+    case ResourceType::RW_STORAGE_BUFFER:
+    case ResourceType::DYNAMIC_CONSTANT_BUFFER:
+    case ResourceType::DYNAMIC_STORAGE_BUFFER: {
+        auto* view = g_BufferViewPool.get(BufferViewHandle(w.handleAt(e)));
+        auto* buf  = view ? g_BufferPool.get(view->buffer) : nullptr;
+        if (!buf)
+            return false;
+        // VK_WHOLE_SIZE would be resolved before the dynamic offset is added
+        if (IsDynamicResource(w.type) && view->range == 0) {
+            RENDERX_ERROR("WriteSet: dynamic buffer view at slot {} needs an explicit range", w.slot);
+            return false;
+        }
+        out.buffer = {buf->buffer, view->offset, view->range ? (VkDeviceSize)view->range : VK_WHOLE_SIZE};
+        return true;
     }
-
+    case ResourceType::TEXTURE_SRV:
     case ResourceType::TEXTURE_UAV: {
-        TextureViewHandle tvHandle;
-        tvHandle.id   = resourceHandle;
-        auto* texView = g_TextureViewPool.get(tvHandle);
-        RENDERX_ASSERT_MSG(texView, "WriteSet: invalid TextureViewHandle for UAV");
-
-        imgInfo.imageView   = texView->view;
-        imgInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-        imgInfo.sampler     = VK_NULL_HANDLE;
-
-        write.pImageInfo = &imgInfo;
-        break;
+        auto* view = g_TextureViewPool.get(TextureViewHandle(w.handleAt(e)));
+        if (!view)
+            return false;
+        out.image = {VK_NULL_HANDLE,
+                     view->view,
+                     w.type == ResourceType::TEXTURE_UAV ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+        return true;
     }
-
     case ResourceType::SAMPLER: {
-        SamplerHandle spHandle;
-        spHandle.id   = resourceHandle;
-        auto* smapler = g_SamplerPool.get(spHandle);
-        RENDERX_ASSERT_MSG(smapler, "invalid sampler handle at slot");
-        imgInfo.sampler  = smapler->vkSampler;
-        write.pImageInfo = &imgInfo;
-        break;
+        auto* sampler = g_SamplerPool.get(SamplerHandle(w.handleAt(e)));
+        if (!sampler)
+            return false;
+        out.image = {sampler->vkSampler, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_UNDEFINED};
+        return true;
     }
-
     case ResourceType::COMBINED_TEXTURE_SAMPLER: {
-        // resourceHandle is TextureViewHandle.id
-        // Sampler handle was packed separately — see DescriptorWrite::CombinedTextureSampler
-        TextureViewHandle tvHandle;
-        tvHandle.id   = resourceHandle;
-        auto* texView = g_TextureViewPool.get(tvHandle);
-        RENDERX_ASSERT_MSG(texView, "WriteSet: invalid TextureViewHandle for combined");
+        auto* view    = g_TextureViewPool.get(TextureViewHandle(w.handleAt(e)));
+        auto* sampler = g_SamplerPool.get(SamplerHandle(w.samplerAt(e)));
+        if (!view || !sampler)
+            return false;
+        out.image = {sampler->vkSampler, view->view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+        return true;
+    }
+    default:
+        return false;
+    }
+}
 
-        imgInfo.imageView   = texView->view;
-        imgInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        // sampler needs separate handle — extend DescriptorWrite to carry it
-        imgInfo.sampler = VK_NULL_HANDLE;
+// Appends the writes for one set to t_VkWrites. Their infos go to t_VkInfos
+// from `infoIdx`; the caller sizes t_VkInfos up front so the pointers held by
+// earlier writes stay valid.
+static void AppendVkWrites(VkDescriptorSet vkSet, const DescriptorWrite* writes, uint32_t writeCount, uint32_t& infoIdx) {
+    for (uint32_t i = 0; i < writeCount; i++) {
+        const DescriptorWrite& w = writes[i];
+        if (w.count == 0)
+            continue;
 
-        write.pImageInfo = &imgInfo;
-        break;
+        VulkanPackedDescriptor* infos = &t_VkInfos[infoIdx];
+        bool                    valid = true;
+        for (uint32_t e = 0; e < w.count && valid; e++)
+            valid = TranslateDescriptor(w, e, infos[e]);
+        if (!valid) {
+            RENDERX_ERROR("WriteSet: invalid handle or unsupported ResourceType {} at slot {}", (uint32_t)w.type, w.slot);
+            continue;
+        }
+        infoIdx += w.count;
+
+        VkWriteDescriptorSet vkw = {};
+        vkw.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        vkw.dstSet               = vkSet;
+        vkw.dstBinding           = w.slot;
+        vkw.dstArrayElement      = w.arrayElement;
+        vkw.descriptorCount      = w.count;
+        vkw.descriptorType       = ToVulkanDescriptorType(w.type);
+        if (IsBufferResource(w.type))
+            vkw.pBufferInfo = &infos->buffer;
+        else
+            vkw.pImageInfo = &infos->image;
+        t_VkWrites.push_back(vkw);
     }
+}
 
-    default:
-        RENDERX_ASSERT_MSG(false, "WriteSet: unsupported ResourceType");
-        return;
-    }
+static void UpdateVkDescriptorSet(VkDescriptorSet vkSet, const DescriptorWrite* writes, uint32_t writeCount) {
+    t_VkWrites.clear();
+    t_VkInfos.resize(CountDescriptors(writes, writeCount));
 
-    vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+    uint32_t infoIdx = 0;
+    AppendVkWrites(vkSet, writes, writeCount, infoIdx);
+    if (!t_VkWrites.empty()) {
+        vkUpdateDescriptorSets(
+            GetVulkanContext().device->logical(), (uint32_t)t_VkWrites.size(), t_VkWrites.data(), 0, nullptr);
+    }
 }
 
 void VKWriteSet(SetHandle setHandle, const DescriptorWrite* writes, uint32_t writeCount) {
     auto* set = g_SetPool.get(setHandle);
     RENDERX_ASSERT_MSG(set, "WriteSet: invalid SetHandle");
+    if (!writes)
+        return;
 
     auto& ctx = GetVulkanContext();
 
     if (Has(set->poolFlags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
-
-        // 32 writes max / for the sake os stack allocations
-        // may be i will cange it to the vector in future
-        VkDescriptorBufferInfo bufInfos[32];
-        VkDescriptorImageInfo  imgInfos[32];
-        VkWriteDescriptorSet   vkWrites[32];
-        uint32_t               bufIdx   = 0;
-        uint32_t               imgIdx   = 0;
-        uint32_t               writeIdx = 0;
-
-        for (uint32_t i = 0; i < writeCount && i < 32; i++) {
-            const DescriptorWrite& w = writes[i];
-
-            VkWriteDescriptorSet& vkw = vkWrites[writeIdx];
-            vkw                       = {};
-            vkw.sType                 = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            vkw.dstSet                = set->vkSet;
-            vkw.dstBinding            = w.slot;
-            vkw.dstArrayElement       = 0;
-            vkw.descriptorCount       = 1;
-            vkw.descriptorType        = ToVulkanDescriptorType(w.type);
-
-            switch (w.type) {
-            case ResourceType::CONSTANT_BUFFER:
-            case ResourceType::STORAGE_BUFFER:
-            case ResourceType::RW_STORAGE_BUFFER: {
-                BufferViewHandle bvHandle;
-                bvHandle.id   = w.handle;
-                auto* bufView = g_BufferViewPool.get(bvHandle);
-                auto* buf     = bufView ? g_BufferPool.get(bufView->buffer) : nullptr;
-                RENDERX_ASSERT_MSG(buf, "WriteSet: invalid buffer handle at slot {}", w.slot);
-
-                bufInfos[bufIdx].buffer = buf->buffer;
-                bufInfos[bufIdx].offset = bufView->offset;
-                bufInfos[bufIdx].range  = (bufView->range == 0) ? VK_WHOLE_SIZE : bufView->range;
-                vkw.pBufferInfo         = &bufInfos[bufIdx++];
-                break;
-            }
-            case ResourceType::TEXTURE_SRV: {
-                TextureViewHandle tvHandle;
-                tvHandle.id   = w.handle;
-                auto* texView = g_TextureViewPool.get(tvHandle);
-                RENDERX_ASSERT_MSG(texView, "WriteSet: invalid texture view handle at slot {}", w.slot);
-
-                imgInfos[imgIdx].imageView   = texView->view;
-                imgInfos[imgIdx].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-                imgInfos[imgIdx].sampler     = VK_NULL_HANDLE;
-                vkw.pImageInfo               = &imgInfos[imgIdx++];
-                break;
-            }
-            case ResourceType::TEXTURE_UAV: {
-                TextureViewHandle tvHandle;
-                tvHandle.id   = w.handle;
-                auto* texView = g_TextureViewPool.get(tvHandle);
-                RENDERX_ASSERT_MSG(texView, "invalid texture view handle at slot {}", w.slot);
-                imgInfos[imgIdx].imageView   = texView->view;
-                imgInfos[imgIdx].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-                imgInfos[imgIdx].sampler     = VK_NULL_HANDLE;
-                vkw.pImageInfo               = &imgInfos[imgIdx++];
-                break;
-            }
-            case ResourceType::SAMPLER: {
-                SamplerHandle spHandle;
-                spHandle.id   = w.handle;
-                auto* smapler = g_SamplerPool.get(spHandle);
-                RENDERX_ASSERT_MSG(smapler, "invalid sampler handle at slot {}", w.slot);
-                imgInfos[imgIdx].sampler = smapler->vkSampler;
-                vkw.pImageInfo           = &imgInfos[imgIdx++];
-                break;
-            }
-
-            default: {
-                // TODO-------------------------------
-                //  Skip unsupported types for now
-                RENDERX_WARN("unsupported ResourceType {}", (uint32_t)w.type);
-                continue;
-                //-----------------------------------
-            }
-            }
-
-            writeIdx++;
-        }
-
-        // One call — the key performance win for DESCRIPTOR_SETS path
-        if (writeIdx > 0) {
-            vkUpdateDescriptorSets(ctx.device->logical(), writeIdx, vkWrites, 0, nullptr);
-        }
-
+        UpdateVkDescriptorSet(set->vkSet, writes, writeCount);
     } else {
         //--- Descriptor buffer path --------------------------------------------------
+        // Descriptors are written straight into mapped heap memory — no
+        // vkUpdateDescriptorSets, nothing recorded or submitted
         auto* heap = g_DescriptorHeapPool.get(set->heapHandle);
         RENDERX_ASSERT_MSG(heap, "WriteSet: invalid heap handle in set");
         RENDERX_ASSERT_MSG(heap->mappedPtr, "WriteSet: heap is not CPU-writable");
 
-        uint8_t* setBase = heap->mappedPtr + set->byteOffset;
-
-        // Get layout to find per-binding offsets
         auto* setLayout = g_SetLayoutPool.get(set->layoutHandle);
         RENDERX_ASSERT_MSG(setLayout, "WriteSet: invalid layout in set");
 
+        uint8_t* setBase = heap->mappedPtr + set->byteOffset;
+
         for (uint32_t i = 0; i < writeCount; i++) {
             const DescriptorWrite& w = writes[i];
 
-            // Find which binding this slot maps to
-            uint64_t bindingByteOffset = 0;
+            const VulkanSetLayout::BindingInfo* binding = nullptr;
             for (uint32_t b = 0; b < setLayout->bindingCount; b++) {
                 if (setLayout->bindings[b].slot == w.slot) {
+                    binding = &setLayout->bindings[b];
                     break;
                 }
-                // Advance by this binding's size
-                bindingByteOffset += setLayout->bindings[b].count * heap->descriptorSize;
+            }
+            if (!binding) {
+                RENDERX_WARN("WriteSet: layout has no binding at slot {}", w.slot);
+                continue;
+            }
+            // Unlike vkUpdateDescriptorSets, an overrun here would silently
+            // land in the next binding's memory
+            if ((uint64_t)w.arrayElement + w.count > binding->count) {
+                RENDERX_ERROR("WriteSet: elements [{}, {}) overrun slot {} ({} elements)",
+                              w.arrayElement,
+                              (uint64_t)w.arrayElement + w.count,
+                              w.slot,
+                              binding->count);
+                continue;
             }
 
-            uint8_t* dest = setBase + bindingByteOffset;
+            // Array elements are packed at the descriptor size of the type
+            const uint64_t stride = ctx.device->descriptorSize(binding->vkType);
+            for (uint32_t e = 0; e < w.count; e++) {
+                WriteRawDescriptorToMemory(setBase + binding->byteOffset + (w.arrayElement + e) * stride,
+                                           ctx.device->logical(),
+                                           w.type,
+                                           w.handleAt(e),
+                                           w.type == ResourceType::COMBINED_TEXTURE_SAMPLER ? w.samplerAt(e) : 0);
+            }
+        }
+    }
+}
+
+void WriteRawDescriptorToMemory(
+    uint8_t* destCpuPtr, VkDevice device, ResourceType type, uint64_t resourceHandle, uint64_t samplerHandle) {
+    auto& ctx = GetVulkanContext();
+
+    VkDescriptorGetInfoEXT info = {};
+    info.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    info.type                   = ToVulkanDescriptorType(type);
 
-            // For descriptor buffer path:
-            // vkGetDescriptorEXT writes the raw descriptor bytes.
-            // We call it if VK_EXT_descriptor_buffer is available.
-            // For now, write a placeholder — wire to vkGetDescriptorEXT when available.
-            (void)dest; // will be used once extension is confirmed present
+    VkDescriptorAddressInfoEXT addrInfo = {};
+    addrInfo.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    VkDescriptorImageInfo imgInfo       = {};
+    VkSampler             sampler       = VK_NULL_HANDLE;
 
-            // TODO: call vkGetDescriptorEXT(device, &info, size, dest)
-            // This requires VK_EXT_descriptor_buffer function pointer loaded at init.
+    switch (type) {
+    case ResourceType::CONSTANT_BUFFER:
+    case ResourceType::STORAGE_BUFFER:
+    case ResourceType::RW_STORAGE_BUFFER: {
+        BufferViewHandle bvHandle;
+        bvHandle.id   = resourceHandle;
+        auto* bufView = g_BufferViewPool.get(bvHandle);
+        auto* buf     = bufView ? g_BufferPool.get(bufView->buffer) : nullptr;
+        if (!buf || !buf->address) {
+            RENDERX_ERROR("WriteSet: descriptor buffers need a valid UNIFORM or STORAGE buffer view");
+            return;
         }
+
+        addrInfo.address = buf->address + bufView->offset;
+        addrInfo.range   = bufView->range ? (VkDeviceSize)bufView->range : buf->size - bufView->offset;
+        addrInfo.format  = VK_FORMAT_UNDEFINED;
+        if (type == ResourceType::CONSTANT_BUFFER)
+            info.data.pUniformBuffer = &addrInfo;
+        else
+            info.data.pStorageBuffer = &addrInfo;
+        break;
     }
+    case ResourceType::TEXTURE_SRV:
+    case ResourceType::TEXTURE_UAV:
+    case ResourceType::COMBINED_TEXTURE_SAMPLER: {
+        TextureViewHandle tvHandle;
+        tvHandle.id   = resourceHandle;
+        auto* texView = g_TextureViewPool.get(tvHandle);
+        if (!texView) {
+            RENDERX_ERROR("WriteSet: invalid texture view handle");
+            return;
+        }
+
+        imgInfo.imageView = texView->view;
+        if (type == ResourceType::TEXTURE_UAV) {
+            imgInfo.imageLayout     = VK_IMAGE_LAYOUT_GENERAL;
+            info.data.pStorageImage = &imgInfo;
+        } else if (type == ResourceType::TEXTURE_SRV) {
+            imgInfo.imageLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            info.data.pSampledImage = &imgInfo;
+        } else {
+            auto* combinedSampler = g_SamplerPool.get(SamplerHandle(samplerHandle));
+            if (!combinedSampler) {
+                RENDERX_ERROR("WriteSet: invalid sampler handle for combined texture sampler");
+                return;
+            }
+            imgInfo.sampler                 = combinedSampler->vkSampler;
+            imgInfo.imageLayout             = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            info.data.pCombinedImageSampler = &imgInfo;
+        }
+        break;
+    }
+    case ResourceType::SAMPLER: {
+        SamplerHandle spHandle;
+        spHandle.id   = resourceHandle;
+        auto* smapler = g_SamplerPool.get(spHandle);
+        if (!smapler) {
+            RENDERX_ERROR("WriteSet: invalid sampler handle");
+            return;
+        }
+        sampler            = smapler->vkSampler;
+        info.data.pSampler = &sampler;
+        break;
+    }
+    default:
+        RENDERX_WARN("WriteSet: unsupported ResourceType {} for descriptor buffers", (uint32_t)type);
+        return;
+    }
+
+    ctx.device->ext().getDescriptor(device, &info, ctx.device->descriptorSize(info.type), destCpuPtr);
 }
 
 // Batch write — all sets in one vkUpdateDescriptorSets call
 void VKWriteSets(SetHandle** sets, const DescriptorWrite** writes, uint32_t setCount, const uint32_t* writeCounts) {
-    auto& ctx = GetVulkanContext();
-
-    // Count total writes across all sets
-    uint32_t totalWrites = 0;
+    uint32_t totalDescriptors = 0;
     for (uint32_t i = 0; i < setCount; i++)
-        totalWrites += writeCounts[i];
+        totalDescriptors += writes[i] ? CountDescriptors(writes[i], writeCounts[i]) : 0;
 
-    if (totalWrites == 0)
+    if (totalDescriptors == 0)
         return;
 
-    // Allocate flat arrays for the batch
-    // Use vectors here since count is runtime — stack allocation for small counts
-    std::vector<VkWriteDescriptorSet>   vkWrites(totalWrites);
-    std::vector<VkDescriptorBufferInfo> bufInfos(totalWrites);
-    std::vector<VkDescriptorImageInfo>  imgInfos(totalWrites);
-    uint32_t                            writeIdx = 0;
-    uint32_t                            bufIdx   = 0;
-    uint32_t                            imgIdx   = 0;
+    t_VkWrites.clear();
+    t_VkInfos.resize(totalDescriptors);
+    uint32_t infoIdx = 0;
 
     for (uint32_t s = 0; s < setCount; s++) {
         auto* set = g_SetPool.get(*sets[s]);
-        if (!set || !Has(set->poolFlags, DescriptorPoolFlags::DESCRIPTOR_SETS))
+        if (!set || !writes[s])
             continue;
 
-        for (uint32_t w = 0; w < writeCounts[s]; w++) {
-            const DescriptorWrite& dw = writes[s][w];
-
-            VkWriteDescriptorSet& vkw = vkWrites[writeIdx];
-            vkw                       = {};
-            vkw.sType                 = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            vkw.dstSet                = set->vkSet;
-            vkw.dstBinding            = dw.slot;
-            vkw.dstArrayElement       = 0;
-            vkw.descriptorCount       = 1;
-            vkw.descriptorType        = ToVulkanDescriptorType(dw.type);
-
-            switch (dw.type) {
-            case ResourceType::CONSTANT_BUFFER:
-            case ResourceType::STORAGE_BUFFER:
-            case ResourceType::RW_STORAGE_BUFFER: {
-                BufferViewHandle bvh;
-                bvh.id    = dw.handle;
-                auto* bv  = g_BufferViewPool.get(bvh);
-                auto* buf = bv ? g_BufferPool.get(bv->buffer) : nullptr;
-                if (!buf)
-                    continue;
-                bufInfos[bufIdx] = {buf->buffer, bv->offset, bv->range ? (VkDeviceSize)bv->range : VK_WHOLE_SIZE};
-                vkw.pBufferInfo  = &bufInfos[bufIdx++];
-                break;
-            }
-            case ResourceType::TEXTURE_SRV: {
-                TextureViewHandle tvh;
-                tvh.id   = dw.handle;
-                auto* tv = g_TextureViewPool.get(tvh);
-                if (!tv)
-                    continue;
-                imgInfos[imgIdx] = {VK_NULL_HANDLE, tv->view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
-                vkw.pImageInfo   = &imgInfos[imgIdx++];
-                break;
-            }
-            case ResourceType::TEXTURE_UAV: {
-                TextureViewHandle tvh;
-                tvh.id   = dw.handle;
-                auto* tv = g_TextureViewPool.get(tvh);
-                if (!tv)
-                    continue;
-                imgInfos[imgIdx] = {VK_NULL_HANDLE, tv->view, VK_IMAGE_LAYOUT_GENERAL};
-                vkw.pImageInfo   = &imgInfos[imgIdx++];
-                break;
-            }
-            default:
-                continue;
+        // Heap-backed sets are written in place, outside the batch
+        if (!Has(set->poolFlags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
+            VKWriteSet(*sets[s], writes[s], writeCounts[s]);
+            continue;
+        }
+        AppendVkWrites(set->vkSet, writes[s], writeCounts[s], infoIdx);
+    }
+
+    if (!t_VkWrites.empty()) {
+        vkUpdateDescriptorSets(
+            GetVulkanContext().device->logical(), (uint32_t)t_VkWrites.size(), t_VkWrites.data(), 0, nullptr);
+    }
+}
+
+// Packed writes: resolve the ids straight into the layout's template format
+// and hand the whole set to the driver in one call, with no VkWriteDescriptorSet
+// built per binding
+void VKWriteSetPacked(SetHandle setHandle, const void* data) {
+    auto* set    = g_SetPool.get(setHandle);
+    auto* layout = set ? g_SetLayoutPool.get(set->layoutHandle) : nullptr;
+    if (!layout) {
+        RENDERX_ERROR("WriteSetPacked: invalid SetHandle or set layout");
+        return;
+    }
+    if (!data)
+        return;
+
+    // Heap-backed sets have no template; their writes are plain memory stores
+    if (!Has(set->poolFlags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
+        const uint64_t* ids = static_cast<const uint64_t*>(data);
+        DescriptorWrite writes[VulkanSetLayout::MAX_BINDINGS];
+        for (uint32_t i = 0; i < layout->bindingCount; i++) {
+            const auto& b     = layout->bindings[i];
+            writes[i]         = {b.slot, b.type};
+            writes[i].count   = b.count;
+            writes[i].handles = ids;
+            ids += writes[i].handleCount();
+        }
+        VKWriteSet(setHandle, writes, layout->bindingCount);
+        return;
+    }
+
+    if (layout->updateTemplate == VK_NULL_HANDLE) {
+        RENDERX_ERROR("WriteSetPacked: layout '{}' has no update template (unbounded or over {} descriptors)",
+                      layout->debugName ? layout->debugName : "unnamed",
+                      VulkanSetLayout::MAX_TEMPLATE_DESCRIPTORS);
+        return;
+    }
+
+    thread_local std::vector<VulkanPackedDescriptor> t_Packed;
+    t_Packed.resize(layout->totalDescriptorCount);
+
+    // A template update writes every binding, so one bad id leaves the whole
+    // set untouched rather than half-updated
+    const uint64_t*         ids = static_cast<const uint64_t*>(data);
+    VulkanPackedDescriptor* out = t_Packed.data();
+    for (uint32_t i = 0; i < layout->bindingCount; i++) {
+        const auto&     b = layout->bindings[i];
+        DescriptorWrite w{b.slot, b.type};
+        w.count   = b.count;
+        w.handles = ids;
+        ids += w.handleCount();
+
+        for (uint32_t e = 0; e < w.count; e++, out++) {
+            if (!TranslateDescriptor(w, e, *out)) {
+                RENDERX_ERROR("WriteSetPacked: invalid handle or unsupported ResourceType {} at slot {}[{}]",
+                              (uint32_t)w.type,
+                              w.slot,
+                              e);
+                return;
             }
+        }
+    }
+
+    vkUpdateDescriptorSetWithTemplate(
+        GetVulkanContext().device->logical(), set->vkSet, layout->updateTemplate, t_Packed.data());
+}
+
+//------------------------------------------------------------------------------
+// Cached sets
+//------------------------------------------------------------------------------
+// g_SetCache maps a hash of (layout, writes) to shared sets; entries whose
+// hashes collide sit side by side and are told apart by their writes.
+// g_SetCacheRefs indexes the entries by the views and samplers they
+// reference, so destroying one drops exactly the sets that point at it.
+// Everything here runs under g_SetCacheMutex: any thread may allocate cached
+// sets or destroy the resources they reference.
+
+std::unordered_multimap<Hash64, VulkanCachedSet>    g_SetCache;
+std::unordered_multimap<Hash64, VulkanCachedSetRef> g_SetCacheRefs;
+std::mutex                                          g_SetCacheMutex;
+uint64_t                                            g_SetCacheFrame = 0;
+
+static Hash64 HashCombine(Hash64 hash, uint64_t value) {
+    hash ^= value;
+    hash *= 0x100000001b3;
+    return hash;
+}
+
+static Hash64 ComputeSetCacheHash(SetLayoutHandle layout, const DescriptorWrite* writes, uint32_t writeCount) {
+    Hash64 hash = HashCombine(0xcbf29ce484222325, layout.id);
+    for (uint32_t i = 0; i < writeCount; i++) {
+        hash = HashCombine(hash,
+                           ((uint64_t)writes[i].arrayElement << 32) | ((uint64_t)writes[i].slot << 8) |
+                               (uint64_t)writes[i].type);
+        hash = HashCombine(hash, writes[i].handle);
+        hash = HashCombine(hash, writes[i].sampler);
+    }
+    return hash;
+}
 
-            writeIdx++;
+// Views of one kind share a key space; buffer views, texture views and
+// samplers come from different pools and may reuse ids
+static Hash64 ResourceKey(ResourceType type, uint64_t resourceHandle) {
+    uint64_t kind = 0;
+    switch (type) {
+    case ResourceType::CONSTANT_BUFFER:
+    case ResourceType::STORAGE_BUFFER:
+    case ResourceType::RW_STORAGE_BUFFER:
+    case ResourceType::DYNAMIC_CONSTANT_BUFFER:
+    case ResourceType::DYNAMIC_STORAGE_BUFFER:
+        kind = 1;
+        break;
+    case ResourceType::TEXTURE_SRV:
+    case ResourceType::TEXTURE_UAV:
+    case ResourceType::COMBINED_TEXTURE_SAMPLER:
+        kind = 2;
+        break;
+    case ResourceType::SAMPLER:
+        kind = 3;
+        break;
+    default:
+        break;
+    }
+    return HashCombine(HashCombine(0xcbf29ce484222325, kind), resourceHandle);
+}
+
+static bool SameWrites(const VulkanCachedSet& entry, SetLayoutHandle layout, const DescriptorWrite* writes, uint32_t count) {
+    if (entry.layout.id != layout.id || entry.writes.size() != count)
+        return false;
+    for (uint32_t i = 0; i < count; i++) {
+        const DescriptorWrite& a = entry.writes[i];
+        if (a.slot != writes[i].slot || a.type != writes[i].type || a.handle != writes[i].handle ||
+            a.sampler != writes[i].sampler || a.arrayElement != writes[i].arrayElement)
+            return false;
+    }
+    return true;
+}
+
+// Unlinks the entry and, unless its pool is already gone, frees the set once
+// the GPU has finished every submission that may have bound it. Caller holds
+// g_SetCacheMutex.
+static void RetireCachedSet(const VulkanCachedSetRef& entry, bool freeSet) {
+    auto range = g_SetCache.equal_range(entry.hash);
+    auto it    = std::find_if(range.first, range.second, [&](const auto& e) { return e.second.set.id == entry.set; });
+    if (it == range.second)
+        return;
+
+    auto unlink = [&entry](Hash64 key) {
+        auto refs = g_SetCacheRefs.equal_range(key);
+        for (auto ref = refs.first; ref != refs.second;) {
+            if (ref->second.hash == entry.hash && ref->second.set == entry.set)
+                ref = g_SetCacheRefs.erase(ref);
+            else
+                ++ref;
         }
+    };
+    for (const DescriptorWrite& w : it->second.writes) {
+        unlink(ResourceKey(w.type, w.handle));
+        if (w.type == ResourceType::COMBINED_TEXTURE_SAMPLER)
+            unlink(ResourceKey(ResourceType::SAMPLER, w.sampler));
     }
 
-    if (writeIdx > 0) {
-        // this is The whole point of WriteSets  one Vulkan call for all sets
-        // but i think this can aslo cause a lil bit of cpu overhead
-        vkUpdateDescriptorSets(ctx.device->logical(), writeIdx, vkWrites.data(), 0, nullptr);
+    if (freeSet)
+        GetVulkanContext().deletionQueue->freeSet(it->second.pool, it->second.set);
+    g_SetCache.erase(it);
+}
+
+SetHandle VKAllocateCachedSet(DescriptorPoolHandle   poolHandle,
+                              SetLayoutHandle        layoutHandle,
+                              const DescriptorWrite* writes,
+                              uint32_t               writeCount) {
+    if (writeCount > 0 && !writes) {
+        RENDERX_ERROR("AllocateCachedSet: null writes");
+        return {};
     }
+
+    // Entries hold one descriptor per write: `handles` arrays are copied, and
+    // the same contents hash alike however the caller batched them
+    thread_local std::vector<DescriptorWrite> t_Expanded;
+    t_Expanded.clear();
+    ExpandDescriptorWrites(writes, writeCount, t_Expanded);
+    writes     = t_Expanded.data();
+    writeCount = (uint32_t)t_Expanded.size();
+
+    const Hash64 hash = ComputeSetCacheHash(layoutHandle, writes, writeCount);
+
+    std::lock_guard<std::mutex> lock(g_SetCacheMutex);
+    auto                        range = g_SetCache.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (SameWrites(it->second, layoutHandle, writes, writeCount)) {
+            it->second.lastUsed = g_SetCacheFrame;
+            return it->second.set;
+        }
+    }
+
+    auto* pool = g_DescriptorPoolPool.get(poolHandle);
+    if (!pool || !Has(pool->flags, DescriptorPoolFlags::POOL)) {
+        RENDERX_ERROR("AllocateCachedSet: cached sets need a valid POOL-policy pool so they can be freed on eviction");
+        return {};
+    }
+
+    SetHandle set = VKAllocateSet(poolHandle, layoutHandle);
+    if (!set.isValid())
+        return {};
+    VKWriteSet(set, writes, writeCount);
+
+    VulkanCachedSet entry;
+    entry.set      = set;
+    entry.pool     = poolHandle;
+    entry.layout   = layoutHandle;
+    entry.writes   = std::vector<DescriptorWrite>(writes, writes + writeCount);
+    entry.lastUsed = g_SetCacheFrame;
+
+    const VulkanCachedSetRef ref{hash, set.id};
+    for (uint32_t i = 0; i < writeCount; i++) {
+        g_SetCacheRefs.emplace(ResourceKey(writes[i].type, writes[i].handle), ref);
+        if (writes[i].type == ResourceType::COMBINED_TEXTURE_SAMPLER)
+            g_SetCacheRefs.emplace(ResourceKey(ResourceType::SAMPLER, writes[i].sampler), ref);
+    }
+    g_SetCache.emplace(hash, std::move(entry));
+    return set;
+}
+
+void VKTrimSetCache(uint32_t maxFrameAge) {
+    std::lock_guard<std::mutex> lock(g_SetCacheMutex);
+    g_SetCacheFrame++;
+
+    std::vector<VulkanCachedSetRef> expired;
+    for (const auto& [hash, entry] : g_SetCache) {
+        if (g_SetCacheFrame - entry.lastUsed > maxFrameAge)
+            expired.push_back({hash, entry.set.id});
+    }
+    for (const VulkanCachedSetRef& entry : expired)
+        RetireCachedSet(entry, true);
+}
+
+void InvalidateCachedSets(ResourceType type, uint64_t resourceHandle) {
+    std::lock_guard<std::mutex> lock(g_SetCacheMutex);
+    if (g_SetCache.empty())
+        return;
+
+    std::vector<VulkanCachedSetRef> stale;
+    auto                            range = g_SetCacheRefs.equal_range(ResourceKey(type, resourceHandle));
+    for (auto ref = range.first; ref != range.second; ++ref)
+        stale.push_back(ref->second);
+    for (const VulkanCachedSetRef& entry : stale)
+        RetireCachedSet(entry, true);
+}
+
+void DropCachedSetsFromPool(DescriptorPoolHandle poolHandle) {
+    std::lock_guard<std::mutex> lock(g_SetCacheMutex);
+
+    std::vector<VulkanCachedSetRef> stale;
+    for (const auto& [hash, entry] : g_SetCache) {
+        if (entry.pool.id == poolHandle.id)
+            stale.push_back({hash, entry.set.id});
+    }
+    for (const VulkanCachedSetRef& entry : stale)
+        RetireCachedSet(entry, false);
 }
 
 DescriptorHeapHandle VKCreateDescriptorHeap(const DescriptorHeapDesc& desc) {
@@ -688,29 +1096,41 @@ DescriptorHeapHandle VKCreateDescriptorHeap(const DescriptorHeapDesc& desc) {
     internal.shaderVisible = desc.shaderVisible;
     internal.debugName     = desc.debugName;
 
-    // Descriptor size depends on heap type and is hardware-specific.
-    // With VK_EXT_descriptor_buffer: query from
-    // VkPhysicalDeviceDescriptorBufferPropertiesEXT.
-    // Without the extension (or as a fallback): use conservative sizes.
-    uint32_t descriptorSize = 0;
-    switch (desc.type) {
-    case DescriptorHeapType::RESOURCES:
-        // Combined CBV/SRV/UAV — conservative 64 bytes covers all vendors
-        descriptorSize = 64;
-        break;
-    case DescriptorHeapType::SAMPLERS:
-        descriptorSize = 32;
-        break;
-    default:
-        descriptorSize = 64;
-        break;
+    if (!ctx.device->hasDescriptorBuffer()) {
+        RENDERX_ERROR("VKCreateDescriptorHeap: VK_EXT_descriptor_buffer is not available on this device");
+        return {};
+    }
+
+    // Descriptor sizes are hardware-specific. A RESOURCES heap slot must hold
+    // any buffer or image descriptor; a SAMPLERS heap slot a sampler or a
+    // combined image sampler, which live in sampler descriptor buffers.
+    const auto& props          = ctx.device->descriptorBufferProperties();
+    uint32_t    descriptorSize = 0;
+    if (desc.type == DescriptorHeapType::SAMPLERS) {
+        descriptorSize = std::max(ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_SAMPLER),
+                                  ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER));
+    } else {
+        for (VkDescriptorType type : {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                                      VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                      VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                                      VK_DESCRIPTOR_TYPE_STORAGE_IMAGE})
+            descriptorSize = std::max(descriptorSize, ctx.device->descriptorSize(type));
     }
 
     internal.descriptorSize = descriptorSize;
     internal.capacity       = desc.capacity;
+    internal.size           = (VkDeviceSize)desc.capacity * descriptorSize;
+
+    const VkDeviceSize maxRange =
+        desc.type == DescriptorHeapType::SAMPLERS ? props.maxSamplerDescriptorBufferRange : props.maxResourceDescriptorBufferRange;
+    if (internal.size > maxRange) {
+        RENDERX_WARN("VKCreateDescriptorHeap: '{}' is {} bytes, larger than the {} bytes a shader can address",
+                     desc.debugName ? desc.debugName : "unnamed",
+                     internal.size,
+                     maxRange);
+    }
 
-    // Total size in bytes
-    VkDeviceSize bufferSize = (VkDeviceSize)desc.capacity * descriptorSize;
+    VkDeviceSize bufferSize = internal.size;
 
     // Build usage flags
     VkBufferUsageFlags usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
@@ -737,8 +1157,11 @@ DescriptorHeapHandle VKCreateDescriptorHeap(const DescriptorHeapDesc& desc) {
     }
 
     VmaAllocationInfo allocInfo = {};
-    ctx.allocator->createBuffer(
-        bufferSize, usage, allocCI.usage, allocCI.flags, internal.buffer, internal.allocation, &allocInfo);
+    if (!ctx.allocator->createBuffer(
+            bufferSize, usage, allocCI.usage, allocCI.flags, internal.buffer, internal.allocation, &allocInfo)) {
+        RENDERX_ERROR("VKCreateDescriptorHeap: failed to allocate {} bytes", bufferSize);
+        return {};
+    }
 
     // Get persistent mapped pointer if host-visible
     if (allocCI.flags & VMA_ALLOCATION_CREATE_MAPPED_BIT) {
@@ -780,6 +1203,216 @@ DescriptorPointer VKGetDescriptorHeapPtr(DescriptorHeapHandle heapHandle, uint32
     return ptr;
 }
 
+SetLayoutMemoryInfo VKGetSetLayoutMemoryInfo(SetLayoutHandle layoutHandle) {
+    auto&               ctx    = GetVulkanContext();
+    auto*               layout = g_SetLayoutPool.get(layoutHandle);
+    SetLayoutMemoryInfo info   = {};
+    if (!layout || !layout->descriptorBuffer) {
+        RENDERX_ERROR("GetSetLayoutMemoryInfo: layout was not created with setDescriptorBuffer()");
+        return info;
+    }
+
+    info.sizeBytes = layout->descriptorBufferSize;
+    info.alignment = ctx.device->descriptorBufferProperties().descriptorBufferOffsetAlignment;
+    for (uint32_t i = 0; i < layout->bindingCount; i++)
+        info.bindingOffsets[i] = layout->bindings[i].byteOffset;
+    return info;
+}
+
+DescriptorCaps VKGetDescriptorCaps() {
+    auto& ctx = GetVulkanContext();
+
+    // Descriptor indexing features are requested unconditionally at device creation
+    DescriptorCaps caps   = {};
+    caps.descriptorBuffer = ctx.device->hasDescriptorBuffer();
+    caps.pushDescriptors  = ctx.device->hasPushDescriptor();
+    caps.bindlessIndexing = true;
+    caps.updateAfterBind  = true;
+    caps.partiallyBound   = true;
+    caps.nonUniformIndex  = true;
+    caps.unifiedMemory    = ctx.device->VkProperties().deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU;
+    caps.maxBindlessSlots = ctx.device->vulkan12Properties().maxDescriptorSetUpdateAfterBindSampledImages;
+
+    if (caps.descriptorBuffer) {
+        caps.sizes.cbv     = ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+        caps.sizes.srv     = std::max(ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE),
+                                      ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER));
+        caps.sizes.uav     = std::max(ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE),
+                                      ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER));
+        caps.sizes.sampler = ctx.device->descriptorSize(VK_DESCRIPTOR_TYPE_SAMPLER);
+    }
+    return caps;
+}
+
+//------------------------------------------------------------------------------
+// Bindless table
+//------------------------------------------------------------------------------
+
+static uint32_t BindlessBinding(ResourceType type) {
+    switch (type) {
+    case ResourceType::TEXTURE_SRV:
+        return BindlessTableDesc::TEXTURE_BINDING;
+    case ResourceType::SAMPLER:
+        return BindlessTableDesc::SAMPLER_BINDING;
+    case ResourceType::STORAGE_BUFFER:
+    case ResourceType::RW_STORAGE_BUFFER:
+        return BindlessTableDesc::BUFFER_BINDING;
+    case ResourceType::TEXTURE_UAV:
+        return BindlessTableDesc::STORAGE_TEXTURE_BINDING;
+    default:
+        return UINT32_MAX;
+    }
+}
+
+BindlessTableHandle VKCreateBindlessTable(const BindlessTableDesc& desc) {
+    auto&       ctx   = GetVulkanContext();
+    const auto& props = ctx.device->vulkan12Properties();
+    const char* name  = desc.debugName ? desc.debugName : "unnamed";
+
+    // Indexed by binding
+    uint32_t       counts[BindlessTableDesc::BINDING_COUNT] = {
+        desc.maxTextures, desc.maxSamplers, desc.maxBuffers, desc.maxStorageTextures};
+    const uint32_t limits[BindlessTableDesc::BINDING_COUNT] = {props.maxDescriptorSetUpdateAfterBindSampledImages,
+                                                               props.maxDescriptorSetUpdateAfterBindSamplers,
+                                                               props.maxDescriptorSetUpdateAfterBindStorageBuffers,
+                                                               props.maxDescriptorSetUpdateAfterBindStorageImages};
+    for (uint32_t i = 0; i < BindlessTableDesc::BINDING_COUNT; i++) {
+        if (counts[i] > limits[i]) {
+            RENDERX_WARN("VKCreateBindlessTable: '{}' binding {} clamped from {} to the device limit {}",
+                         name,
+                         i,
+                         counts[i],
+                         limits[i]);
+            counts[i] = limits[i];
+        }
+    }
+
+    SetLayoutDesc layoutDesc;
+    layoutDesc.add(Binding::Bindless(BindlessTableDesc::TEXTURE_BINDING, ResourceType::TEXTURE_SRV, counts[0]))
+        .add(Binding::Bindless(BindlessTableDesc::SAMPLER_BINDING, ResourceType::SAMPLER, counts[1]))
+        .add(Binding::Bindless(BindlessTableDesc::BUFFER_BINDING, ResourceType::STORAGE_BUFFER, counts[2]))
+        .add(Binding::Bindless(BindlessTableDesc::STORAGE_TEXTURE_BINDING, ResourceType::TEXTURE_UAV, counts[3]))
+        .setDebugName(desc.debugName);
+
+    VulkanBindlessTable table;
+    table.setIndex  = desc.setIndex;
+    table.debugName = desc.debugName;
+    table.layout    = VKCreateSetLayout(layoutDesc);
+    if (!table.layout.isValid())
+        return {};
+
+    DescriptorPoolSizes sizes(0);
+    sizes.sampledImageCount  = counts[0];
+    sizes.samplerCount       = counts[1];
+    sizes.storageBufferCount = counts[2];
+    sizes.storageImageCount  = counts[3];
+    sizes.maxSets            = 1;
+
+    table.vkPool = CreateDescriptorPool(sizes, false, true);
+    if (table.vkPool == VK_NULL_HANDLE) {
+        RENDERX_ERROR("VKCreateBindlessTable: descriptor pool creation failed for '{}'", name);
+        VKDestroySetLayout(table.layout);
+        return {};
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo = {};
+    allocInfo.sType                       = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool              = table.vkPool;
+    allocInfo.descriptorSetCount          = 1;
+    allocInfo.pSetLayouts                 = &g_SetLayoutPool.get(table.layout)->vkLayout;
+
+    VkResult result = vkAllocateDescriptorSets(ctx.device->logical(), &allocInfo, &table.vkSet);
+    if (result != VK_SUCCESS) {
+        RENDERX_ERROR("VKCreateBindlessTable: vkAllocateDescriptorSets failed for '{}': {}", name, VkResultToString(result));
+        vkDestroyDescriptorPool(ctx.device->logical(), table.vkPool, nullptr);
+        VKDestroySetLayout(table.layout);
+        return {};
+    }
+
+    for (uint32_t i = 0; i < BindlessTableDesc::BINDING_COUNT; i++)
+        table.ranges[i].capacity = counts[i];
+
+    return g_BindlessTablePool.allocate(std::move(table));
+}
+
+void VKDestroyBindlessTable(BindlessTableHandle& handle) {
+    auto& ctx   = GetVulkanContext();
+    auto* table = g_BindlessTablePool.get(handle);
+    if (!table)
+        return;
+
+    // The set may still be referenced by submitted work; indices released
+    // later find the table gone and are dropped
+    ctx.deletionQueue->destroyDescriptorPool(table->vkPool);
+    ctx.deletionQueue->destroySetLayout(table->layout);
+    g_BindlessTablePool.free(handle);
+}
+
+SetLayoutHandle VKGetBindlessSetLayout(BindlessTableHandle handle) {
+    auto* table = g_BindlessTablePool.get(handle);
+    return table ? table->layout : SetLayoutHandle{};
+}
+
+uint32_t RegisterBindlessDescriptor(BindlessTableHandle handle, ResourceType type, uint64_t resourceHandle) {
+    auto*          table   = g_BindlessTablePool.get(handle);
+    const uint32_t binding = BindlessBinding(type);
+    if (!table) {
+        RENDERX_ERROR("RegisterBindlessDescriptor: invalid BindlessTableHandle");
+        return BindlessTableDesc::INVALID_INDEX;
+    }
+    if (binding == UINT32_MAX) {
+        RENDERX_ERROR("RegisterBindlessDescriptor: resource type {} cannot live in a bindless table", (uint32_t)type);
+        return BindlessTableDesc::INVALID_INDEX;
+    }
+
+    auto&    range = table->ranges[binding];
+    uint32_t index = BindlessTableDesc::INVALID_INDEX;
+    if (!range.freeList.empty()) {
+        index = range.freeList.back();
+        range.freeList.pop_back();
+    } else if (range.next < range.capacity) {
+        index = range.next++;
+    } else {
+        RENDERX_ERROR("RegisterBindlessDescriptor: binding {} of '{}' is full ({} entries)",
+                      binding,
+                      table->debugName ? table->debugName : "unnamed",
+                      range.capacity);
+        return BindlessTableDesc::INVALID_INDEX;
+    }
+
+    DescriptorWrite write{binding, type, {}, resourceHandle};
+    write.arrayElement = index;
+    UpdateVkDescriptorSet(table->vkSet, &write, 1);
+    return index;
+}
+
+void FreeBindlessIndex(BindlessTableHandle handle, ResourceType type, uint32_t index) {
+    // The table may have been destroyed before the resource
+    auto* table = g_BindlessTablePool.get(handle);
+    if (!table || index == BindlessTableDesc::INVALID_INDEX)
+        return;
+
+    table->ranges[BindlessBinding(type)].freeList.push_back(index);
+}
+
+uint32_t VKGetTextureViewBindlessIndex(TextureViewHandle handle) {
+    auto* view = g_TextureViewPool.get(handle);
+    return view ? view->bindlessIndex : BindlessTableDesc::INVALID_INDEX;
+}
+
+uint32_t VKGetBufferViewBindlessIndex(BufferViewHandle handle) {
+    auto* view = g_BufferViewPool.get(handle);
+    return view ? view->bindlessIndex : BindlessTableDesc::INVALID_INDEX;
+}
+
+uint32_t VKGetSamplerBindlessIndex(SamplerHandle handle) {
+    auto* sampler = g_SamplerPool.get(handle);
+    return sampler ? sampler->bindlessIndex : BindlessTableDesc::INVALID_INDEX;
+}
+
+// pDynamicOffsets for a fresh bind of up to 32 sets
+static const uint32_t g_ZeroDynamicOffsets[32 * VulkanSetLayout::MAX_DYNAMIC_DESCRIPTORS] = {};
+
 void VulkanCommandList::setDescriptorSet(uint32_t slot, SetHandle setHandle) {
     auto* set = g_SetPool.get(setHandle);
     RENDERX_ASSERT_MSG(set, "setDescriptorSet: invalid SetHandle");
@@ -790,44 +1423,52 @@ void VulkanCommandList::setDescriptorSet(uint32_t slot, SetHandle setHandle) {
 
     if (Has(set->poolFlags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
         // ── Classic VK path ──────────────────────────────────────────────
+        // Dynamic descriptors start at offset 0; setDynamicOffset moves them
+        const auto* setLayout = g_SetLayoutPool.get(set->layoutHandle);
         vkCmdBindDescriptorSets(m_CommandBuffer,
                                 VK_PIPELINE_BIND_POINT_GRAPHICS,
                                 pipelineLayout->vkLayout,
                                 slot, // firstSet
                                 1,    // descriptorSetCount
                                 &set->vkSet,
-                                0, // dynamicOffsetCount
-                                nullptr);
+                                setLayout ? setLayout->dynamicCount : 0,
+                                g_ZeroDynamicOffsets);
+        trackBoundSet(slot, set->vkSet, setLayout);
 
     } else {
         // ── Descriptor buffer path ───────────────────────────────────────
-        // The buffer must already be bound via setDescriptorHeaps.
-        // Here we just set the offset into it.
-        // vkCmdSetDescriptorBufferOffsetsEXT requires:
-        //   - the buffer index (which buffer in the bound array)
-        //   - the byte offset
-        // For now we assume buffer index 0 (resources heap).
-        // Full multi-heap support requires tracking which heap this set belongs to.
+        // The heap must already be bound via setDescriptorHeaps; binding the
+        // set is just pointing the slot at its offset inside that heap
+        uint32_t     bufferIndex = boundHeapIndex(set->heapHandle);
+        VkDeviceSize offset      = set->byteOffset;
+        if (bufferIndex == UINT32_MAX) {
+            RENDERX_ERROR("setDescriptorSet: the set's heap is not bound — call setDescriptorHeaps first");
+            return;
+        }
 
-        auto* heap = g_DescriptorHeapPool.get(set->heapHandle);
-        RENDERX_ASSERT_MSG(heap, "setDescriptorSet: invalid heap in set");
-
-        // vkCmdSetDescriptorBufferOffsetsEXT(
-        //     m_CommandBuffer,
-        //     VK_PIPELINE_BIND_POINT_GRAPHICS,
-        //     pipelineLayout->layout,
-        //     slot,           // firstSet
-        //     1,              // setCount
-        //     &bufferIndex,   // pBufferIndices — index into bound buffer array
-        //     &set->byteOffset);
-
-        // NOTE: vkCmdSetDescriptorBufferOffsetsEXT is a function pointer loaded
-        // from VK_EXT_descriptor_buffer at device init time.
-        // Wire it up when the extension is confirmed present in VulkanDevice.
-        (void)heap;
+        GetVulkanContext().device->ext().cmdSetDescriptorBufferOffsets(
+            m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->vkLayout, slot, 1, &bufferIndex, &offset);
+        trackBoundSet(slot, VK_NULL_HANDLE, nullptr);
     }
 }
 
+void VulkanCommandList::trackBoundSet(uint32_t slot, VkDescriptorSet set, const VulkanSetLayout* layout) {
+    if (slot >= MAX_BOUND_SETS)
+        return;
+    BoundSet& bound        = m_BoundSets[slot];
+    bound.vkSet            = set;
+    bound.dynamicCount     = layout ? layout->dynamicCount : 0;
+    bound.dynamicAlignment = layout ? layout->dynamicAlignment : 1;
+}
+
+uint32_t VulkanCommandList::boundHeapIndex(DescriptorHeapHandle heap) const {
+    for (uint32_t i = 0; i < m_BoundHeapCount; i++) {
+        if (m_BoundHeaps[i] == heap)
+            return i;
+    }
+    return UINT32_MAX;
+}
+
 void VulkanCommandList::setDescriptorSets(uint32_t firstSlot, const SetHandle* sets, uint32_t count) {
     if (count == 0)
         return;
@@ -842,32 +1483,57 @@ void VulkanCommandList::setDescriptorSets(uint32_t firstSlot, const SetHandle* s
     if (Has(firstSet->poolFlags, DescriptorPoolFlags::DESCRIPTOR_SETS)) {
         // Collect all VkDescriptorSets — stack array
         VkDescriptorSet vkSets[32];
+        uint32_t        dynamicCount = 0;
         RENDERX_ASSERT_MSG(count <= 32, "setDescriptorSets: max 32 sets per call");
 
         for (uint32_t i = 0; i < count; i++) {
             auto* s = g_SetPool.get(sets[i]);
             RENDERX_ASSERT_MSG(s, "setDescriptorSets: invalid SetHandle at index {}", i);
-            vkSets[i] = s->vkSet;
+            const auto* setLayout = g_SetLayoutPool.get(s->layoutHandle);
+            vkSets[i]             = s->vkSet;
+            dynamicCount         += setLayout ? setLayout->dynamicCount : 0;
+            trackBoundSet(firstSlot + i, s->vkSet, setLayout);
         }
 
-        // One vkCmdBindDescriptorSets for all sets
-        vkCmdBindDescriptorSets(
-            m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->vkLayout, firstSlot, count, vkSets, 0, nullptr);
+        // One vkCmdBindDescriptorSets for all sets, every dynamic offset at 0
+        vkCmdBindDescriptorSets(m_CommandBuffer,
+                                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                pipelineLayout->vkLayout,
+                                firstSlot,
+                                count,
+                                vkSets,
+                                dynamicCount,
+                                g_ZeroDynamicOffsets);
 
     } else {
-        // Descriptor buffer path — N offset calls
+        // Descriptor buffer path — one offsets call for all sets
+        uint32_t     bufferIndices[32];
+        VkDeviceSize offsets[32];
+        RENDERX_ASSERT_MSG(count <= 32, "setDescriptorSets: max 32 sets per call");
+
         for (uint32_t i = 0; i < count; i++) {
-            setDescriptorSet(firstSlot + i, sets[i]);
+            auto* s = g_SetPool.get(sets[i]);
+            RENDERX_ASSERT_MSG(s, "setDescriptorSets: invalid SetHandle at index {}", i);
+            bufferIndices[i] = boundHeapIndex(s->heapHandle);
+            offsets[i]       = s->byteOffset;
+            if (bufferIndices[i] == UINT32_MAX) {
+                RENDERX_ERROR("setDescriptorSets: heap of set {} is not bound — call setDescriptorHeaps first", i);
+                return;
+            }
         }
+
+        GetVulkanContext().device->ext().cmdSetDescriptorBufferOffsets(
+            m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->vkLayout, firstSlot, count, bufferIndices, offsets);
+        for (uint32_t i = 0; i < count; i++)
+            trackBoundSet(firstSlot + i, VK_NULL_HANDLE, nullptr);
     }
 }
 
 void VulkanCommandList::setDescriptorHeaps(DescriptorHeapHandle* heaps, uint32_t count) {
     RENDERX_ASSERT_MSG(count <= 2, "setDescriptorHeaps: max 2 heaps (one RESOURCES, one SAMPLERS)");
 
-    // Collect VkBuffer handles and their device addresses
-    // vkCmdBindDescriptorBuffersEXT takes VkDescriptorBufferBindingInfoEXT array
-
+    // vkCmdBindDescriptorBuffersEXT takes VkDescriptorBufferBindingInfoEXT array;
+    // the position of a heap in it is the buffer index sets are bound with
     VkDescriptorBufferBindingInfoEXT bindingInfos[2] = {};
     for (uint32_t i = 0; i < count; i++) {
         auto* heap = g_DescriptorHeapPool.get(heaps[i]);
@@ -877,11 +1543,12 @@ void VulkanCommandList::setDescriptorHeaps(DescriptorHeapHandle* heaps, uint32_t
         bindingInfos[i].address = heap->gpuAddress;
         bindingInfos[i].usage   = (heap->type == DescriptorHeapType::SAMPLERS) ? VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT
                                                                                : VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT;
+        m_BoundHeaps[i] = heaps[i];
     }
+    m_BoundHeapCount = count;
 
-    // vkCmdBindDescriptorBuffersEXT(m_CommandBuffer, count, bindingInfos);
-    // NOTE: function pointer from VK_EXT_descriptor_buffer — wire at device init
-    (void)bindingInfos;
+    if (count > 0)
+        GetVulkanContext().device->ext().cmdBindDescriptorBuffers(m_CommandBuffer, count, bindingInfos);
 }
 
 void VulkanCommandList::pushConstants(uint32_t slot, const void* data, uint32_t sizeIn32BitWords, uint32_t offsetIn32BitWords) {
@@ -919,130 +1586,223 @@ void VulkanCommandList::pushConstants(uint32_t slot, const void* data, uint32_t
 void VulkanCommandList::setDescriptorBufferOffset(uint32_t slot, uint32_t bufferIndex, uint64_t byteOffset) {
     auto* pipelineLayout = g_PipelineLayoutPool.get(m_CurrentPipelineLayoutHandle);
     RENDERX_ASSERT_MSG(pipelineLayout, "setDescriptorBufferOffset: no pipeline bound");
-
-    // vkCmdSetDescriptorBufferOffsetsEXT(
-    //     m_CommandBuffer,
-    //     VK_PIPELINE_BIND_POINT_GRAPHICS,
-    //     pipelineLayout->layout,
-    //     slot,
-    //     1,
-    //     &bufferIndex,
-    //     &byteOffset);
-
-    // NOTE: wire to function pointer once VK_EXT_descriptor_buffer is loaded
-    (void)bufferIndex;
-    (void)byteOffset;
+    RENDERX_ASSERT_MSG(bufferIndex < m_BoundHeapCount,
+                       "setDescriptorBufferOffset: buffer index {} is not bound ({} heaps bound)",
+                       bufferIndex,
+                       m_BoundHeapCount);
+
+    VkDeviceSize offset = byteOffset;
+    GetVulkanContext().device->ext().cmdSetDescriptorBufferOffsets(
+        m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->vkLayout, slot, 1, &bufferIndex, &offset);
 }
 
 void VulkanCommandList::setDynamicOffset(uint32_t slot, uint32_t byteOffset) {
     auto* pipelineLayout = g_PipelineLayoutPool.get(m_CurrentPipelineLayoutHandle);
     RENDERX_ASSERT_MSG(pipelineLayout, "setDynamicOffset: no pipeline bound");
+    if (!pipelineLayout)
+        return;
 
-    // Re-bind the set that is currently bound at this slot with the new dynamic offset.
-    // This requires tracking which set is currently bound per slot.
-    // Add: SetHandle m_BoundSets[MAX_BOUND_SETS] to VulkanCommandList state.
-    // For now: placeholder until bound set tracking is added.
-
-    // vkCmdBindDescriptorSets(
-    //     m_CommandBuffer,
-    //     VK_PIPELINE_BIND_POINT_GRAPHICS,
-    //     pipelineLayout->layout,
-    //     slot, 1,
-    //     &m_BoundSets[slot].vkSet,
-    //     1, &byteOffset);
-
-    (void)slot;
-    (void)byteOffset;
+    if (slot >= MAX_BOUND_SETS || m_BoundSets[slot].vkSet == VK_NULL_HANDLE) {
+        RENDERX_ERROR("setDynamicOffset: no descriptor set is bound at slot {}", slot);
+        return;
+    }
+    const BoundSet& bound = m_BoundSets[slot];
+    if (bound.dynamicCount == 0) {
+        RENDERX_ERROR("setDynamicOffset: the set bound at slot {} has no dynamic buffers", slot);
+        return;
+    }
+    RENDERX_ASSERT_MSG(byteOffset % bound.dynamicAlignment == 0,
+                       "setDynamicOffset: offset {} is not a multiple of the required alignment {}",
+                       byteOffset,
+                       bound.dynamicAlignment);
+
+    // Rebinding one set leaves the other slots bound
+    uint32_t offsets[VulkanSetLayout::MAX_DYNAMIC_DESCRIPTORS];
+    for (uint32_t i = 0; i < bound.dynamicCount; i++)
+        offsets[i] = byteOffset;
+
+    vkCmdBindDescriptorSets(m_CommandBuffer,
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            pipelineLayout->vkLayout,
+                            slot,
+                            1,
+                            &bound.vkSet,
+                            bound.dynamicCount,
+                            offsets);
 }
 
 void VulkanCommandList::pushDescriptor(uint32_t slot, const DescriptorWrite* writes, uint32_t count) {
-    // Requires VK_KHR_push_descriptor
-    // vkCmdPushDescriptorSetKHR — function pointer loaded at device init
-
     auto* pipelineLayout = g_PipelineLayoutPool.get(m_CurrentPipelineLayoutHandle);
     RENDERX_ASSERT_MSG(pipelineLayout, "pushDescriptor: no pipeline bound");
+    if (!pipelineLayout || !writes)
+        return;
+    if (slot != pipelineLayout->pushSetIndex) {
+        RENDERX_ERROR("pushDescriptor: set {} of the bound pipeline is not a push descriptor layout", slot);
+        return;
+    }
 
-    // Build VkWriteDescriptorSet array then call vkCmdPushDescriptorSetKHR
-    // Same translation logic as VK_WriteSet — reuse that building code.
-    // Placeholder until function pointer is wired:
-
-    (void)slot;
-    (void)writes;
-    (void)count;
+    // Same translation as WriteSet; dstSet is filled in by pushWrites
+    t_VkWrites.clear();
+    t_VkInfos.resize(CountDescriptors(writes, count));
+    uint32_t infoIdx = 0;
+    AppendVkWrites(VK_NULL_HANDLE, writes, count, infoIdx);
+    pushWrites(*pipelineLayout, t_VkWrites.data(), (uint32_t)t_VkWrites.size());
 }
 
-void VulkanCommandList::setBindlessTable(BindlessTableHandle table) {
-    // Bindless: bind the global descriptor set at set 0.
-    // The BindlessTable handle maps to a VkDescriptorSet internally.
-    // Wire this once the bindless table backend is implemented.
-    (void)table;
+void VulkanCommandList::pushWrites(const VulkanPipelineLayout& layout, VkWriteDescriptorSet* writes, uint32_t count) {
+    if (count == 0)
+        return;
+
+    auto& ctx = GetVulkanContext();
+    if (ctx.device->hasPushDescriptor()) {
+        ctx.device->ext().cmdPushDescriptorSet(
+            m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout.vkLayout, layout.pushSetIndex, count, writes);
+        return;
+    }
+
+    //--- Emulation: a fresh set per push, bound like any other -------------------
+    auto* setLayout = g_SetLayoutPool.get(layout.pushSetLayout);
+    if (!setLayout)
+        return;
+
+    if (!m_PushFallbackPool.isValid()) {
+        m_PushFallbackPool = VKCreateDescriptorPool(DescriptorPoolDesc::PerFrame(SetLayoutHandle{}, PUSH_FALLBACK_SETS)
+                                                        .setGrowable()
+                                                        .setDebugName("PushDescriptorFallback"));
+    }
+    auto*           pool  = g_DescriptorPoolPool.get(m_PushFallbackPool);
+    VkDescriptorSet vkSet = VK_NULL_HANDLE;
+    if (!pool || AllocateFromChain(*pool, &setLayout->vkLayout, 1, &vkSet) != VK_SUCCESS) {
+        RENDERX_ERROR("pushDescriptor: could not allocate an emulated push set");
+        return;
+    }
+
+    // Push descriptors update incrementally: carry over the previous push set
+    // of this layout, then apply the new writes on top. Copies run after the
+    // writes of the same call, hence two calls.
+    VkCopyDescriptorSet copies[VulkanSetLayout::MAX_BINDINGS];
+    uint32_t            copyCount = 0;
+    if (m_PushFallbackSet != VK_NULL_HANDLE && m_PushFallbackLayout.id == layout.pushSetLayout.id) {
+        for (uint32_t i = 0; i < setLayout->bindingCount; i++) {
+            VkCopyDescriptorSet& copy = copies[copyCount++];
+            copy                      = {};
+            copy.sType                = VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET;
+            copy.srcSet               = m_PushFallbackSet;
+            copy.srcBinding           = setLayout->bindings[i].slot;
+            copy.dstSet               = vkSet;
+            copy.dstBinding           = setLayout->bindings[i].slot;
+            copy.descriptorCount      = setLayout->bindings[i].count;
+        }
+    }
+    for (uint32_t i = 0; i < count; i++)
+        writes[i].dstSet = vkSet;
+
+    if (copyCount > 0)
+        vkUpdateDescriptorSets(ctx.device->logical(), 0, nullptr, copyCount, copies);
+    vkUpdateDescriptorSets(ctx.device->logical(), count, writes, 0, nullptr);
+    vkCmdBindDescriptorSets(
+        m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout.vkLayout, layout.pushSetIndex, 1, &vkSet, 0, nullptr);
+    trackBoundSet(layout.pushSetIndex, VK_NULL_HANDLE, nullptr);
+
+    m_PushFallbackSet    = vkSet;
+    m_PushFallbackLayout = layout.pushSetLayout;
 }
 
-void VulkanCommandList::setInlineCBV(uint32_t slot, BufferHandle bufHandle, uint64_t offset) {
-    auto* buf = g_BufferPool.get(bufHandle);
-    RENDERX_ASSERT_MSG(buf, "setInlineCBV: invalid BufferHandle");
+void VulkanCommandList::setBindlessTable(BindlessTableHandle tableHandle) {
+    auto* table = g_BindlessTablePool.get(tableHandle);
+    RENDERX_ASSERT_MSG(table, "setBindlessTable: invalid BindlessTableHandle");
 
     auto* pipelineLayout = g_PipelineLayoutPool.get(m_CurrentPipelineLayoutHandle);
-    RENDERX_ASSERT_MSG(pipelineLayout, "setInlineCBV: no pipeline bound");
+    RENDERX_ASSERT_MSG(pipelineLayout, "setBindlessTable: no pipeline bound — call setPipeline first");
 
-    VkBufferDeviceAddressInfo addrInfo = {};
-    addrInfo.sType                     = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
-    addrInfo.buffer                    = buf->buffer;
+    // The table is a classic set, which descriptor buffer pipelines cannot bind
+    if (pipelineLayout->descriptorBuffer) {
+        RENDERX_ERROR("setBindlessTable: the bound pipeline uses DESCRIPTOR_BUFFER set layouts");
+        return;
+    }
 
-    auto&           ctx     = GetVulkanContext();
-    VkDeviceAddress gpuAddr = vkGetBufferDeviceAddress(ctx.device->logical(), &addrInfo);
+    // Stays bound across pipelines whose layouts agree up to setIndex
+    vkCmdBindDescriptorSets(m_CommandBuffer,
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            pipelineLayout->vkLayout,
+                            table->setIndex,
+                            1,
+                            &table->vkSet,
+                            0,
+                            nullptr);
+    trackBoundSet(table->setIndex, VK_NULL_HANDLE, nullptr);
+}
 
-    // vkCmdPushDescriptorSetWithTemplateKHR or vkCmdPushDescriptorSetKHR
-    // For inline CBV the cleanest mapping is a push descriptor with
-    // a VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC write.
-    // Placeholder until push descriptor extension is wired:
+void VulkanCommandList::pushInlineBuffer(uint32_t slot, BufferHandle bufHandle, uint64_t offset, VkDescriptorType type) {
+    auto* buf            = g_BufferPool.get(bufHandle);
+    auto* pipelineLayout = g_PipelineLayoutPool.get(m_CurrentPipelineLayoutHandle);
+    RENDERX_ASSERT_MSG(buf, "setInline: invalid BufferHandle");
+    RENDERX_ASSERT_MSG(pipelineLayout, "setInline: no pipeline bound");
+    if (!buf || !pipelineLayout)
+        return;
+    if (pipelineLayout->pushSetIndex == UINT32_MAX) {
+        RENDERX_ERROR("setInline: the bound pipeline has no push descriptor set layout");
+        return;
+    }
+    if (offset >= buf->size) {
+        RENDERX_ERROR("setInline: offset {} is past the end of the buffer ({} bytes)", offset, buf->size);
+        return;
+    }
 
-    (void)slot;
-    (void)gpuAddr;
-    (void)offset;
+    // Uniform buffer ranges are capped by the device; storage ranges are not
+    const auto&  limits = GetVulkanContext().device->limits();
+    VkDeviceSize range  = buf->size - offset;
+    if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+        range = std::min<VkDeviceSize>(range, limits.maxUniformBufferRange);
+
+    VkDescriptorBufferInfo info  = {buf->buffer, offset, range};
+    VkWriteDescriptorSet   write = {};
+    write.sType                  = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstBinding             = slot;
+    write.descriptorCount        = 1;
+    write.descriptorType         = type;
+    write.pBufferInfo            = &info;
+    pushWrites(*pipelineLayout, &write, 1);
+}
+
+void VulkanCommandList::setInlineCBV(uint32_t slot, BufferHandle buf, uint64_t offset) {
+    pushInlineBuffer(slot, buf, offset, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
 }
 
 void VulkanCommandList::setInlineSRV(uint32_t slot, BufferHandle buf, uint64_t offset) {
-    // Same pattern as setInlineCBV but with STORAGE_BUFFER type
-    (void)slot;
-    (void)buf;
-    (void)offset;
+    pushInlineBuffer(slot, buf, offset, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 }
 
 void VulkanCommandList::setInlineUAV(uint32_t slot, BufferHandle buf, uint64_t offset) {
-    // Same pattern as setInlineCBV but with STORAGE_BUFFER RW type
-    (void)slot;
-    (void)buf;
-    (void)offset;
+    pushInlineBuffer(slot, buf, offset, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 }
 
 // working:
 //     VKCreateSetLayout         : vkCreateDescriptorSetLayout, all flags
 //     VKDestroySetLayout        : vkDestroyDescriptorSetLayout
-//     VKCreateDescriptorPool    : vkCreateDescriptorPool with correct pool sizes
+//     VKCreateDescriptorPool    : pools sized from the layout, optionally growing as a chain
 //     VKDestroyDescriptorPool   : vkDestroyDescriptorPool
-//     VKResetDescriptorPool     : vkResetDescriptorPool (LINEAR) / byte ptr reset
+//     VKResetDescriptorPool     : vkResetDescriptorPool on every chained pool (LINEAR) / byte ptr reset
 //     VKAllocateSet             : vkAllocateDescriptorSets (DESCRIPTOR_SETS path)
 //     VKAllocateSets            : one vkAllocateDescriptorSets for N sets
 //     VKFreeSet                 : vkFreeDescriptorSets (POOL path)
-//     VKWriteSet                : batched vkUpdateDescriptorSets (CBV/SRV/UAV)
+//     VKWriteSet                : one vkUpdateDescriptorSets, any count, array elements, combined samplers
 //     VKWriteSets               : one vkUpdateDescriptorSets for N sets
-//     VKCreateDescriptorHeap    : VkBuffer + VMA + device address
+//     VKWriteSetPacked          : vkUpdateDescriptorSetWithTemplate, template built per layout
+//     VKAllocateCachedSet       : content-hashed shared sets, frame-age eviction
+//     VKCreateDescriptorHeap    : VkBuffer + VMA + device address, hardware descriptor sizes
 //     VKDestroyDescriptorHeap   : destroys VkBuffer
 //     VKGetDescriptorHeapPtr    : CPU/GPU pointer into heap
-//     setDescriptorSets         :   one vkCmdBindDescriptorSets for N sets
+//     DESCRIPTOR_BUFFER write   : vkGetDescriptorEXT straight into mapped heap memory
+//     setDescriptorHeaps        : vkCmdBindDescriptorBuffersEXT
+//     setDescriptorSet(s)       : vkCmdBindDescriptorSets / vkCmdSetDescriptorBufferOffsetsEXT
+//     setDescriptorBufferOffset : vkCmdSetDescriptorBufferOffsetsEXT
 //     pushConstants             :   vkCmdPushConstants
-
-// TODO-------------------------------------------------------------------------------
-//  palceholdes needs extension function pointers wired at device init:
-//      DESCRIPTOR_BUFFER write    : needs vkGetDescriptorEXT
-//      setDescriptorHeaps         : needs vkCmdBindDescriptorBuffersEXT
-//      setDescriptorBufferOffset  : needs vkCmdSetDescriptorBufferOffsetsEXT
-//      pushDescriptor             : needs vkCmdPushDescriptorSetKHR
-//      setInlineCBV/SRV/UAV       : needs push descriptor or device address path
-//      setDynamicOffset           : needs bound set tracking per slot
-//      setBindlessTable           : needs bindless backend
-//-----------------------------------------------------------------------------------
+//     VKCreateBindlessTable     : one update-after-bind set, free-list index allocation
+//     setBindlessTable          : vkCmdBindDescriptorSets at the table's set index
+//     pushDescriptor            : vkCmdPushDescriptorSetKHR, per-list linear sets without the extension
+//     setInlineCBV/SRV/UAV      : single-buffer push descriptor at a binding of the push set
+//     setDynamicOffset          : vkCmdBindDescriptorSets of the tracked set with pDynamicOffsets
 
 } // namespace RxVK
 } // namespace Rx
\ No newline at end of file
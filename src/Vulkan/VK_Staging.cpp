@@ -1,161 +1,205 @@
 #include "VK_Common.h"
 #include "VK_RenderX.h"
+#include <algorithm>
 
 namespace Rx {
 namespace RxVK {
 
-VulkanStagingAllocator::VulkanStagingAllocator(VulkanContext& ctx, uint32_t chunkSize)
+VulkanStagingAllocator::VulkanStagingAllocator(VulkanContext& ctx, uint64_t ringSize, uint64_t dedicatedBudget)
     : m_Ctx(ctx),
-      m_ChunkSize(chunkSize) {}
+      m_DedicatedBudget(dedicatedBudget) {
+    // Whole 256-byte blocks so the wrap point keeps every alignment we hand out
+    m_Capacity = (ringSize + 255) & ~uint64_t(255);
 
-VulkanStagingAllocator::~VulkanStagingAllocator() {
-    cleanup();
-}
-
-StagingAllocation VulkanStagingAllocator::allocate(uint32_t size, uint32_t alignment) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-
-    // Check if current chunk has space
-    if (m_CurrentChunk && m_CurrentChunk->canAllocate(size, alignment)) {
-        return m_CurrentChunk->allocate(size, alignment);
-    }
+    const VmaAllocationCreateFlags flags =
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 
-    // Need a new chunk
-    m_CurrentChunk = getOrCreateChunk(size);
-    if (!m_CurrentChunk) {
-        RENDERX_ERROR("Failed to get staging chunk");
-        return StagingAllocation{};
+    VmaAllocationInfo allocResult{};
+    bool              success = m_Ctx.allocator->createBuffer(
+        m_Capacity, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO, flags, m_Buffer, m_Allocation, &allocResult);
+    if (!success || !allocResult.pMappedData) {
+        RENDERX_ERROR("[VulkanStagingAllocator] Failed to create {} MB staging ring", m_Capacity / (1024 * 1024));
+        return;
     }
 
-    return m_CurrentChunk->allocate(size, alignment);
+    m_Mapped = static_cast<uint8_t*>(allocResult.pMappedData);
+    RENDERX_INFO("Created staging ring: {} MB", m_Capacity / (1024.0f * 1024.0f));
 }
 
-void VulkanStagingAllocator::submit(uint64_t submissionID) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-
-    if (!m_CurrentChunk) {
-        return;
-    }
+VulkanStagingAllocator::~VulkanStagingAllocator() {
+    cleanup();
+}
 
-    // Mark the current chunk as in-flight
-    m_CurrentChunk->lastSubmissionID = submissionID;
-    m_InFlightChunks.push_back(*m_CurrentChunk);
+StagingAllocation VulkanStagingAllocator::allocate(uint32_t size, uint32_t alignment) {
+    RENDERX_ASSERT_MSG(alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= 256,
+                       "VulkanStagingAllocator::allocate: alignment must be a power of two <= 256");
+    if (size == 0 || !m_Mapped)
+        return StagingAllocation{};
 
-    // Clear current chunk (will get a new one on next allocate)
-    m_CurrentChunk = nullptr;
-}
+    if (size > m_Capacity / 2)
+        return allocateDedicated(size);
 
-void VulkanStagingAllocator::retire(uint64_t completedSubmissionID) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    uint64_t head = m_Head.load(std::memory_order_relaxed);
+    for (;;) {
+        const uint64_t pos     = head % m_Capacity;
+        uint64_t       aligned = (pos + alignment - 1) & ~uint64_t(alignment - 1);
+        uint64_t       start   = head + (aligned - pos);
 
-    // Retire all chunks whose submissions have completed
-    while (!m_InFlightChunks.empty()) {
-        auto& chunk = m_InFlightChunks.front();
+        // Never straddle the end of the buffer: skip the tail piece and start over at 0
+        if (aligned + size > m_Capacity)
+            start = head + (m_Capacity - pos);
 
-        // If this chunk's submission hasn't completed yet, stop
-        if (chunk.lastSubmissionID > completedSubmissionID) {
-            break;
+        const uint64_t end = start + size;
+        if (end - m_Tail.load(std::memory_order_acquire) > m_Capacity) {
+            if (!reclaim())
+                return allocateDedicated(size);
+            head = m_Head.load(std::memory_order_relaxed);
+            continue;
         }
 
-        // GPU is done with this chunk - recycle it
-        chunk.reset();
-        m_FreeChunks.push_back(chunk);
-        m_InFlightChunks.pop_front();
+        if (m_Head.compare_exchange_weak(head, end, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            StagingAllocation alloc{};
+            alloc.buffer    = m_Buffer;
+            alloc.offset    = (uint32_t)(start % m_Capacity);
+            alloc.size      = size;
+            alloc.mappedPtr = m_Mapped + alloc.offset;
+            alloc.ringBegin = head;
+            alloc.ringEnd   = end;
+            return alloc;
+        }
     }
 }
 
-StagingChunk* VulkanStagingAllocator::getOrCreateChunk(uint32_t requiredSize) {
-    // First, try to get a free chunk
-    if (!m_FreeChunks.empty()) {
-        StagingChunk chunk = m_FreeChunks.back();
-        m_FreeChunks.pop_back();
-
-        // If free chunk is big enough, use it
-        if (chunk.size >= requiredSize) {
-            // Find a slot in m_AllChunks to store it
-            for (auto& c : m_AllChunks) {
-                if (c.buffer == chunk.buffer) {
-                    return &c;
-                }
-            }
-        } else {
-            // Put it back, it's  small
-            m_FreeChunks.push_back(chunk);
+StagingAllocation VulkanStagingAllocator::allocateDedicated(uint32_t size) {
+    if (m_DedicatedBytes.fetch_add(size) + size > m_DedicatedBudget) {
+        m_DedicatedBytes.fetch_sub(size);
+
+        // Give back whatever finished and try once more
+        retire(m_Ctx.transferQueue->Completed().value);
+        if (m_DedicatedBytes.fetch_add(size) + size > m_DedicatedBudget) {
+            m_DedicatedBytes.fetch_sub(size);
+            RENDERX_ERROR("[VulkanStagingAllocator] Staging budget exhausted: {} bytes requested, {} of {} in use",
+                          size,
+                          m_DedicatedBytes.load(),
+                          m_DedicatedBudget);
+            return StagingAllocation{};
         }
     }
 
-    // Create a new chunk
-    uint32_t     chunkSize = std::max(m_ChunkSize, requiredSize);
-    StagingChunk newChunk  = createChunk(chunkSize);
+    const VmaAllocationCreateFlags flags =
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 
-    if (newChunk.buffer == VK_NULL_HANDLE) {
-        return nullptr;
+    StagingAllocation alloc{};
+    VmaAllocationInfo allocResult{};
+    bool              success = m_Ctx.allocator->createBuffer(
+        size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO, flags, alloc.buffer, alloc.dedicated, &allocResult);
+    if (!success || !allocResult.pMappedData) {
+        RENDERX_ERROR("[VulkanStagingAllocator] Failed to create {} byte dedicated staging buffer", size);
+        if (success)
+            m_Ctx.allocator->destroyBuffer(alloc.buffer, alloc.dedicated);
+        m_DedicatedBytes.fetch_sub(size);
+        return StagingAllocation{};
     }
 
-    m_AllChunks.push_back(newChunk);
-    return &m_AllChunks.back();
+    alloc.size      = size;
+    alloc.mappedPtr = static_cast<uint8_t*>(allocResult.pMappedData);
+    return alloc;
 }
 
-StagingChunk VulkanStagingAllocator::createChunk(uint32_t size) {
-    StagingChunk chunk{};
-    chunk.size = size;
-
-    // Create staging buffer
-    VmaAllocationCreateInfo allocInfo{};
-    allocInfo.usage = VMA_MEMORY_USAGE_AUTO;
-    allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-
-    VmaAllocationInfo allocResult{};
-
-    bool success = m_Ctx.allocator->createBuffer(size,
-                                                 VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                                 VMA_MEMORY_USAGE_AUTO,
-                                                 allocInfo.flags,
-                                                 chunk.buffer,
-                                                 chunk.allocation,
-                                                 &allocResult);
+void VulkanStagingAllocator::release(const StagingAllocation& allocation, uint64_t transferValue) {
+    if (!allocation.mappedPtr)
+        return;
 
-    if (!success) {
-        RENDERX_ERROR("[VulkanStagingAllocator] Failed to create staging buffer");
-        return chunk;
+    std::lock_guard<std::mutex> lock(m_RetireMutex);
+    if (allocation.dedicated != VK_NULL_HANDLE) {
+        m_DedicatedReleased.push_back({allocation.buffer, allocation.dedicated, allocation.size, transferValue});
+        return;
     }
+    m_Released[allocation.ringBegin] = {allocation.ringEnd, transferValue};
+}
 
-    // Get mapped pointer
-    chunk.mappedPtr = static_cast<uint8_t*>(allocResult.pMappedData);
+void VulkanStagingAllocator::retire(uint64_t completedTransferValue) {
+    std::lock_guard<std::mutex> lock(m_RetireMutex);
+    retireLocked(completedTransferValue);
+}
 
-    if (!chunk.mappedPtr) {
-        RENDERX_ERROR("[VulkanStagingAllocator] Failed to map staging buffer");
-        destroyChunk(chunk);
-        chunk = StagingChunk{};
-        return chunk;
+void VulkanStagingAllocator::retireLocked(uint64_t completedTransferValue) {
+    // The tail only moves over ranges that are released and complete, in ring
+    // order; a range still being filled holds back everything after it
+    uint64_t tail = m_Tail.load(std::memory_order_relaxed);
+    for (auto it = m_Released.find(tail); it != m_Released.end(); it = m_Released.find(tail)) {
+        if (it->second.transferValue > completedTransferValue)
+            break;
+        tail = it->second.ringEnd;
+        m_Released.erase(it);
     }
+    m_Tail.store(tail, std::memory_order_release);
 
-    RENDERX_INFO("Created staging chunk: {} MB", size / (1024.0f * 1024.0f));
-
-    return chunk;
+    for (size_t i = 0; i < m_DedicatedReleased.size();) {
+        Dedicated& d = m_DedicatedReleased[i];
+        if (d.transferValue > completedTransferValue) {
+            i++;
+            continue;
+        }
+        m_Ctx.allocator->destroyBuffer(d.buffer, d.allocation);
+        m_DedicatedBytes.fetch_sub(d.size);
+        d = m_DedicatedReleased.back();
+        m_DedicatedReleased.pop_back();
+    }
 }
 
-void VulkanStagingAllocator::destroyChunk(StagingChunk& chunk) {
-    if (chunk.buffer != VK_NULL_HANDLE) {
-        m_Ctx.allocator->destroyBuffer(chunk.buffer, chunk.allocation);
-        chunk.buffer     = VK_NULL_HANDLE;
-        chunk.allocation = VK_NULL_HANDLE;
-        chunk.mappedPtr  = nullptr;
+bool VulkanStagingAllocator::reclaim() {
+    uint64_t waitValue = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_RetireMutex);
+
+        const uint64_t before = m_Tail.load(std::memory_order_relaxed);
+        retireLocked(m_Ctx.transferQueue->Completed().value);
+        if (m_Tail.load(std::memory_order_relaxed) != before)
+            return true;
+
+        auto it = m_Released.find(before);
+        if (it == m_Released.end()) {
+            // Ranges after the tail are back but the one at the tail is not:
+            // either a producer is still filling it or it was never released
+            if (!m_Released.empty() && m_StuckTail != before) {
+                m_StuckTail = before;
+                RENDERX_WARN("[VulkanStagingAllocator] Ring tail pinned at byte {} by an unreleased allocation; "
+                             "every allocate() needs a matching release()",
+                             before % m_Capacity);
+            }
+            return false;
+        }
+        waitValue = it->second.transferValue;
     }
+
+    // The oldest range is submitted but not finished: wait for that copy only,
+    // without holding up producers that release meanwhile
+    m_Ctx.transferQueue->Wait(Timeline(waitValue));
+    retire(waitValue);
+    return true;
 }
 
 void VulkanStagingAllocator::cleanup() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-
-    // Destroy all chunks
-    for (auto& chunk : m_AllChunks) {
-        destroyChunk(chunk);
+    std::lock_guard<std::mutex> lock(m_RetireMutex);
+
+    for (auto& d : m_DedicatedReleased)
+        m_Ctx.allocator->destroyBuffer(d.buffer, d.allocation);
+    m_DedicatedReleased.clear();
+
+    uint64_t unreleased = m_Head.load(std::memory_order_relaxed) - m_Tail.load(std::memory_order_relaxed);
+    for (const auto& [ringBegin, range] : m_Released)
+        unreleased -= range.ringEnd - ringBegin;
+    if (m_Buffer != VK_NULL_HANDLE && unreleased > 0)
+        RENDERX_WARN("[VulkanStagingAllocator] {} ring bytes were allocated and never released", unreleased);
+    m_Released.clear();
+
+    if (m_Buffer != VK_NULL_HANDLE) {
+        m_Ctx.allocator->destroyBuffer(m_Buffer, m_Allocation);
+        m_Buffer     = VK_NULL_HANDLE;
+        m_Allocation = VK_NULL_HANDLE;
+        m_Mapped     = nullptr;
     }
-
-    m_AllChunks.clear();
-    m_InFlightChunks.clear();
-    m_FreeChunks.clear();
-    m_CurrentChunk = nullptr;
 }
 
 // VulkanImmediateUploader Implementation
@@ -240,8 +284,7 @@ void VulkanImmediateUploader::endSingleTimeCommands(VkCommandBuffer cmd) {
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers    = &cmd;
 
-    auto transferQueue = m_Ctx.device->transferQueue();
-    VK_CHECK(vkQueueSubmit(transferQueue, 1, &submitInfo, m_ImmediateCtx.fence));
+    m_Ctx.transferQueue->SubmitUntracked(submitInfo, m_ImmediateCtx.fence);
 
     auto device = m_Ctx.device->logical();
     vkWaitForFences(device, 1, &m_ImmediateCtx.fence, VK_TRUE, UINT64_MAX);
@@ -275,10 +318,8 @@ bool VulkanImmediateUploader::uploadBuffer(
     // Submit and wait
     endSingleTimeCommands(cmd);
 
-    // Mark staging as submitted with a fake high submission ID
-    // It's already complete, so it will be recycled immediately
-    m_Ctx.stagingAllocator->submit(UINT64_MAX);
-    m_Ctx.stagingAllocator->retire(UINT64_MAX);
+    // The copy has already completed
+    m_Ctx.stagingAllocator->release(staging, 0);
     return true;
 }
 
@@ -345,8 +386,7 @@ bool VulkanImmediateUploader::uploadTexture(VkImage dstTexture, const void* data
     endSingleTimeCommands(cmd);
 
     // Recycle staging
-    m_Ctx.stagingAllocator->submit(UINT64_MAX);
-    m_Ctx.stagingAllocator->retire(UINT64_MAX);
+    m_Ctx.stagingAllocator->release(staging, 0);
     return true;
 }
 
@@ -376,6 +416,7 @@ void VulkanImmediateUploader::uploadBufferBatched(VkBuffer dstBuffer, const void
     }
 
     std::memcpy(staging.mappedPtr, data, size);
+    m_BatchStaging.push_back(staging);
 
     // Record copy
     VkBufferCopy copyRegion{};
@@ -401,6 +442,7 @@ void VulkanImmediateUploader::uploadTextureBatched(VkImage            dstTexture
         return;
     }
     std::memcpy(staging.mappedPtr, data, size);
+    m_BatchStaging.push_back(staging);
     // TODO
 }
 
@@ -416,8 +458,7 @@ bool VulkanImmediateUploader::endBatch() {
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers    = &m_ImmediateCtx.commandBuffer;
 
-    auto transferQueue = m_Ctx.device->transferQueue();
-    VK_CHECK(vkQueueSubmit(transferQueue, 1, &submitInfo, m_ImmediateCtx.fence));
+    m_Ctx.transferQueue->SubmitUntracked(submitInfo, m_ImmediateCtx.fence);
 
     auto device = m_Ctx.device->logical();
     vkWaitForFences(device, 1, &m_ImmediateCtx.fence, VK_TRUE, UINT64_MAX);
@@ -425,179 +466,512 @@ bool VulkanImmediateUploader::endBatch() {
     m_ImmediateCtx.isRecording = false;
 
     // Recycle staging
-    m_Ctx.stagingAllocator->submit(UINT64_MAX);
-    m_Ctx.stagingAllocator->retire(UINT64_MAX);
+    for (const auto& staging : m_BatchStaging)
+        m_Ctx.stagingAllocator->release(staging, 0);
+    m_BatchStaging.clear();
 
     return true;
 }
 
 // VulkanDeferredUploader Implementation
 VulkanDeferredUploader::VulkanDeferredUploader(VulkanContext& ctx)
-    : m_Ctx(ctx) {}
+    : m_Ctx(ctx) {
+    m_TransferAllocator      = m_Ctx.transferQueue->CreateCommandAllocator("DeferredUploadAllocator");
+    m_NeedsOwnershipTransfer = m_Ctx.device->transferFamily() != m_Ctx.device->graphicsFamily();
+    if (m_NeedsOwnershipTransfer)
+        m_AcquireAllocator = m_Ctx.graphicsQueue->CreateCommandAllocator("DeferredUploadAcquireAllocator");
+}
 
 VulkanDeferredUploader::~VulkanDeferredUploader() {
-    // Wait for any pending uploads
-    if (m_Ctx.transferQueue) {
-        m_Ctx.transferQueue->WaitIdle();
-    }
+    // Both waits are on queues that are about to be destroyed anyway
+    if (m_TransferAllocator)
+        m_Ctx.transferQueue->DestroyCommandAllocator(m_TransferAllocator);
+    if (m_AcquireAllocator)
+        m_Ctx.graphicsQueue->DestroyCommandAllocator(m_AcquireAllocator);
 }
 
-void VulkanDeferredUploader::uploadBuffer(BufferHandle dstBuffer, const void* data, uint32_t size, uint32_t dstOffset) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-
+bool VulkanDeferredUploader::uploadBuffer(BufferHandle dstBuffer, const void* data, uint32_t size, uint32_t dstOffset) {
     VulkanBuffer* buffer = g_BufferPool.get(dstBuffer);
     if (!buffer || !data || size == 0) {
-        return;
+        RENDERX_WARN("[DeferredUploader] Invalid buffer upload ignored");
+        return false;
+    }
+    if ((uint64_t)dstOffset + size > buffer->size) {
+        RENDERX_ERROR("[DeferredUploader] Upload of {} bytes at offset {} overruns buffer of {} bytes",
+                      size,
+                      dstOffset,
+                      buffer->size);
+        return false;
     }
 
-    // Allocate staging
+    // Staging is lock-free; only the pending list is shared
     StagingAllocation staging = m_Ctx.stagingAllocator->allocate(size);
     if (!staging.mappedPtr) {
         RENDERX_ERROR("[DeferredUploader] Failed to allocate staging");
-        return;
+        return false;
     }
-
-    // Copy to staging
     std::memcpy(staging.mappedPtr, data, size);
 
-    // Queue for later flush
     DeferredUpload upload{};
-    upload.staging      = staging;
-    upload.dstBuffer    = dstBuffer;
-    upload.dstOffset    = dstOffset;
-    upload.size         = size;
-    upload.submissionID = 0; // Will be set on flush
+    upload.staging   = staging;
+    upload.dstBuffer = dstBuffer;
+    upload.dstOffset = dstOffset;
+    upload.size      = size;
 
+    std::lock_guard<std::mutex> lock(m_Mutex);
     m_PendingBufferUploads.push_back(upload);
+    return true;
 }
 
-void VulkanDeferredUploader::uploadTexture(TextureHandle dstTexture, const void* data, uint32_t size, const TextureCopy& region) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-
+bool VulkanDeferredUploader::uploadTexture(TextureHandle dstTexture, const void* data, uint32_t size, const TextureCopy& region) {
     VulkanTexture* texture = g_TexturePool.get(dstTexture);
     if (!texture || !data || size == 0) {
-        return;
+        RENDERX_WARN("[DeferredUploader] Invalid texture upload ignored");
+        return false;
     }
 
-    StagingAllocation staging = m_Ctx.stagingAllocator->allocate(size);
+    // bufferOffset must be a multiple of the texel size and of 4
+    StagingAllocation staging = m_Ctx.stagingAllocator->allocate(size, 16);
     if (!staging.mappedPtr) {
-        return;
+        RENDERX_ERROR("[DeferredUploader] Failed to allocate staging");
+        return false;
     }
-
     std::memcpy(staging.mappedPtr, data, size);
 
     DeferredTextureUpload upload{};
-    upload.staging      = staging;
-    upload.dstTexture   = dstTexture;
-    upload.region       = region;
-    upload.submissionID = 0;
+    upload.staging    = staging;
+    upload.dstTexture = dstTexture;
+    upload.region     = region;
 
+    std::lock_guard<std::mutex> lock(m_Mutex);
     m_PendingTextureUploads.push_back(upload);
+    return true;
+}
+
+void VulkanDeferredUploader::recycle(uint64_t completedTransferValue) {
+    const uint64_t completedGraphicsValue = m_AcquireAllocator ? m_Ctx.graphicsQueue->Completed().value : 0;
+
+    while (!m_InFlight.empty()) {
+        const InFlight& done = m_InFlight.front();
+        if (done.value > completedTransferValue || done.acquireValue > completedGraphicsValue)
+            break;
+
+        m_TransferAllocator->Free(done.transfer);
+        if (done.acquire)
+            m_AcquireAllocator->Free(done.acquire);
+        if (done.reclaim)
+            m_AcquireAllocator->Free(done.reclaim);
+        m_InFlight.pop_front();
+    }
 }
 
 Timeline VulkanDeferredUploader::flush() {
     std::lock_guard<std::mutex> lock(m_Mutex);
 
+    recycle(m_Ctx.transferQueue->Completed().value);
+
     if (m_PendingBufferUploads.empty() && m_PendingTextureUploads.empty()) {
         return Timeline{0};
     }
 
-    // Create a one-time command buffer
-    auto  cmdAllocator = m_Ctx.transferQueue->CreateCommandAllocator("DeferredUploadAllocator");
-    auto  cmdList      = cmdAllocator->Allocate();
-    auto* vkCmd        = static_cast<VulkanCommandList*>(cmdList);
+    const uint32_t transferFamily = m_NeedsOwnershipTransfer ? m_Ctx.device->transferFamily() : VK_QUEUE_FAMILY_IGNORED;
+    const uint32_t graphicsFamily = m_NeedsOwnershipTransfer ? m_Ctx.device->graphicsFamily() : VK_QUEUE_FAMILY_IGNORED;
+
+    auto* transfer = static_cast<VulkanCommandList*>(m_TransferAllocator->Allocate());
+    transfer->open();
+    VkCommandBuffer cmd = transfer->m_CommandBuffer;
+
+    // Each barrier starts from the layout the subresource was last left in, so
+    // regions written by an earlier upload keep their contents. Those may still
+    // be sampled by graphics work, which the copy has to wait for; across
+    // families the graphics queue must also release them to the transfer queue.
+    // A subresource written twice in one flush gets one pair of barriers.
+    m_ImageBarriers.clear();
+    m_ReclaimBarriers.clear();
+    uint64_t graphicsWait = 0;
+    for (auto& upload : m_PendingTextureUploads) {
+        VulkanTexture* texture = g_TexturePool.get(upload.dstTexture);
+        if (!texture)
+            continue;
+
+        const uint32_t mip   = upload.region.dstMipLevel;
+        const uint32_t layer = upload.region.dstArrayLayer;
+        const bool     seen  = std::any_of(m_ImageBarriers.begin(), m_ImageBarriers.end(), [&](const VkImageMemoryBarrier2& b) {
+            return b.image == texture->image && b.subresourceRange.baseMipLevel == mip &&
+                   b.subresourceRange.baseArrayLayer == layer;
+        });
+        if (seen)
+            continue;
 
-    vkCmd->open();
+        const uint32_t           subresource = SubresourceIndex(*texture, mip, layer);
+        const VulkanAccessState& current     = IsDepthStencilFormat(texture->format)
+                                                   ? GetSubresourceState(texture->state, subresource).depth
+                                                   : GetSubresourceState(texture->state, subresource).color;
+
+        VkImageMemoryBarrier2 b{};
+        b.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+        b.srcStageMask                    = VK_PIPELINE_STAGE_2_NONE;
+        b.srcAccessMask                   = 0;
+        b.dstStageMask                    = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.dstAccessMask                   = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        b.oldLayout                       = current.layout;
+        b.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        b.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        b.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        b.image                           = texture->image;
+        b.subresourceRange.aspectMask     = GetImageAspect(texture->format);
+        b.subresourceRange.baseMipLevel   = mip;
+        b.subresourceRange.levelCount     = 1;
+        b.subresourceRange.baseArrayLayer = layer;
+        b.subresourceRange.layerCount     = 1;
+
+        if (current.layout != VK_IMAGE_LAYOUT_UNDEFINED) {
+            b.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            graphicsWait   = m_Ctx.graphicsQueue->Submitted().value;
+            if (m_NeedsOwnershipTransfer) {
+                b.srcQueueFamilyIndex = graphicsFamily;
+                b.dstQueueFamilyIndex = transferFamily;
+
+                VkImageMemoryBarrier2 r = b;
+                r.srcStageMask          = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+                r.dstStageMask          = VK_PIPELINE_STAGE_2_NONE;
+                r.dstAccessMask         = 0;
+                m_ReclaimBarriers.push_back(r);
+            }
+        }
+        m_ImageBarriers.push_back(b);
+    }
 
-    // Record all buffer copies
+    // Buffers have no layout telling whether they were ever written, so every
+    // buffer upload waits for graphics reads of the old contents. A partial
+    // overwrite keeps the rest of the buffer, which across families the
+    // graphics queue releases first; a full overwrite discards it and needs
+    // no release. Ownership moves for the whole buffer, once per flush.
+    m_ReclaimBufferBarriers.clear();
     for (auto& upload : m_PendingBufferUploads) {
         VulkanBuffer* buffer = g_BufferPool.get(upload.dstBuffer);
         if (!buffer)
             continue;
 
+        graphicsWait = m_Ctx.graphicsQueue->Submitted().value;
+
+        const bool partial = upload.dstOffset != 0 || upload.size != buffer->size;
+        const bool seen    = std::any_of(m_ReclaimBufferBarriers.begin(),
+                                      m_ReclaimBufferBarriers.end(),
+                                      [&](const VkBufferMemoryBarrier2& b) { return b.buffer == buffer->buffer; });
+        if (!m_NeedsOwnershipTransfer || !partial || seen)
+            continue;
+
+        VkBufferMemoryBarrier2 r{};
+        r.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+        r.srcStageMask        = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        r.srcAccessMask       = 0;
+        r.dstStageMask        = VK_PIPELINE_STAGE_2_NONE;
+        r.dstAccessMask       = 0;
+        r.srcQueueFamilyIndex = graphicsFamily;
+        r.dstQueueFamilyIndex = transferFamily;
+        r.buffer              = buffer->buffer;
+        r.offset              = 0;
+        r.size                = VK_WHOLE_SIZE;
+        m_ReclaimBufferBarriers.push_back(r);
+    }
+
+    // Transfer-side acquire of the reclaimed buffers
+    m_BufferBarriers.clear();
+    for (auto b : m_ReclaimBufferBarriers) {
+        b.dstStageMask  = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        m_BufferBarriers.push_back(b);
+    }
+
+    if (!m_ImageBarriers.empty() || !m_BufferBarriers.empty()) {
+        VkDependencyInfo dep{};
+        dep.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dep.bufferMemoryBarrierCount = (uint32_t)m_BufferBarriers.size();
+        dep.pBufferMemoryBarriers    = m_BufferBarriers.data();
+        dep.imageMemoryBarrierCount  = (uint32_t)m_ImageBarriers.size();
+        dep.pImageMemoryBarriers     = m_ImageBarriers.data();
+        vkCmdPipelineBarrier2(cmd, &dep);
+    }
+
+    // Copies in one command buffer are unordered, so a write overlapping an
+    // earlier one in this flush is put behind it and the later upload wins
+    m_CopyWrites.clear();
+    for (auto& upload : m_PendingBufferUploads) {
+        VulkanBuffer* buffer = g_BufferPool.get(upload.dstBuffer);
+        if (!buffer)
+            continue;
+
+        orderCopy(cmd, (uint64_t)buffer->buffer, upload.dstOffset, (uint64_t)upload.dstOffset + upload.size);
+
         VkBufferCopy copyRegion{};
         copyRegion.srcOffset = upload.staging.offset;
         copyRegion.dstOffset = upload.dstOffset;
         copyRegion.size      = upload.size;
+        vkCmdCopyBuffer(cmd, upload.staging.buffer, buffer->buffer, 1, &copyRegion);
+    }
 
-        // TODO
-        //  vkCmdCopyBuffer(
-        //  	vkCmd->m_CommandBuffer,
-        //  	upload.staging.buffer,
-        //  	buffer->buffer,
-        //  	1,
-        //  	&copyRegion);
+    for (auto& upload : m_PendingTextureUploads) {
+        VulkanTexture* texture = g_TexturePool.get(upload.dstTexture);
+        if (!texture)
+            continue;
+
+        const TextureCopy& r           = upload.region;
+        const uint32_t     subresource = SubresourceIndex(*texture, r.dstMipLevel, r.dstArrayLayer);
+        orderCopy(cmd, (uint64_t)texture->image, subresource, subresource + 1);
+
+        VkBufferImageCopy copyRegion{};
+        copyRegion.bufferOffset                    = upload.staging.offset;
+        copyRegion.bufferRowLength                 = 0; // tightly packed
+        copyRegion.bufferImageHeight               = 0;
+        copyRegion.imageSubresource.aspectMask     = GetCopyAspect(texture->format);
+        copyRegion.imageSubresource.mipLevel       = r.dstMipLevel;
+        copyRegion.imageSubresource.baseArrayLayer = r.dstArrayLayer;
+        copyRegion.imageSubresource.layerCount     = 1;
+        copyRegion.imageOffset = {(int32_t)r.dstOffset.x, (int32_t)r.dstOffset.y, (int32_t)r.dstOffset.z};
+        copyRegion.imageExtent = {(uint32_t)r.extent.x, (uint32_t)r.extent.y, (uint32_t)r.extent.z};
+        vkCmdCopyBufferToImage(cmd, upload.staging.buffer, texture->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
+    }
+
+    // Post-copy barriers, one per buffer and subresource. Within one family
+    // they make the writes visible to every later stage; across families they
+    // are the release half of the ownership transfer and the destination scope
+    // is left to the acquire.
+    m_BufferBarriers.clear();
+    for (auto& upload : m_PendingBufferUploads) {
+        VulkanBuffer* buffer = g_BufferPool.get(upload.dstBuffer);
+        if (!buffer)
+            continue;
+
+        const bool seen = std::any_of(m_BufferBarriers.begin(), m_BufferBarriers.end(), [&](const VkBufferMemoryBarrier2& b) {
+            return b.buffer == buffer->buffer;
+        });
+        if (seen)
+            continue;
+
+        VkBufferMemoryBarrier2 b{};
+        b.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+        b.srcStageMask        = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.srcAccessMask       = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        b.dstStageMask        = m_NeedsOwnershipTransfer ? VK_PIPELINE_STAGE_2_NONE : VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        b.dstAccessMask       = m_NeedsOwnershipTransfer ? 0 : VK_ACCESS_2_MEMORY_READ_BIT;
+        b.srcQueueFamilyIndex = transferFamily;
+        b.dstQueueFamilyIndex = graphicsFamily;
+        b.buffer              = buffer->buffer;
+        b.offset              = 0;
+        b.size                = VK_WHOLE_SIZE;
+        m_BufferBarriers.push_back(b);
+
+        buffer->state.stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        buffer->state.accessMask  = VK_ACCESS_2_MEMORY_READ_BIT;
+        buffer->state.queueFamily = m_Ctx.device->graphicsFamily();
+    }
+
+    for (auto& b : m_ImageBarriers) {
+        b.srcStageMask        = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.srcAccessMask       = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        b.dstStageMask        = m_NeedsOwnershipTransfer ? VK_PIPELINE_STAGE_2_NONE : VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        b.dstAccessMask       = m_NeedsOwnershipTransfer ? 0 : VK_ACCESS_2_SHADER_READ_BIT;
+        b.oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        b.newLayout           = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        b.srcQueueFamilyIndex = transferFamily;
+        b.dstQueueFamilyIndex = graphicsFamily;
     }
 
-    // Record all texture copies
+    VulkanAccessState uploaded{};
+    uploaded.stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    uploaded.accessMask  = VK_ACCESS_2_SHADER_READ_BIT;
+    uploaded.layout      = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    uploaded.queueFamily = m_Ctx.device->graphicsFamily();
     for (auto& upload : m_PendingTextureUploads) {
         VulkanTexture* texture = g_TexturePool.get(upload.dstTexture);
         if (!texture)
             continue;
 
-        // Memory_Barrier + copy logic here (similar to immediate uploader)
-        // ...
+        const uint32_t         subresource = SubresourceIndex(*texture, upload.region.dstMipLevel, upload.region.dstArrayLayer);
+        VulkanSubresourceState state       = GetSubresourceState(texture->state, subresource);
+        if (IsDepthStencilFormat(texture->format))
+            state.depth = state.stencil = uploaded;
+        else
+            state.color = uploaded;
+        SetSubresourceState(texture->state, subresource, state);
     }
 
-    vkCmd->close();
+    VkDependencyInfo release{};
+    release.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    release.bufferMemoryBarrierCount = (uint32_t)m_BufferBarriers.size();
+    release.pBufferMemoryBarriers    = m_BufferBarriers.data();
+    release.imageMemoryBarrierCount  = (uint32_t)m_ImageBarriers.size();
+    release.pImageMemoryBarriers     = m_ImageBarriers.data();
+    vkCmdPipelineBarrier2(cmd, &release);
+
+    transfer->close();
+
+    InFlight inFlight{};
+    inFlight.transfer = transfer;
+
+    SubmitInfo transferSubmit = SubmitInfo::Single(transfer);
+    if (!m_ReclaimBarriers.empty() || !m_ReclaimBufferBarriers.empty()) {
+        VkDependencyInfo reclaim{};
+        reclaim.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        reclaim.bufferMemoryBarrierCount = (uint32_t)m_ReclaimBufferBarriers.size();
+        reclaim.pBufferMemoryBarriers    = m_ReclaimBufferBarriers.data();
+        reclaim.imageMemoryBarrierCount  = (uint32_t)m_ReclaimBarriers.size();
+        reclaim.pImageMemoryBarriers     = m_ReclaimBarriers.data();
+
+        auto* reclaimList = static_cast<VulkanCommandList*>(m_AcquireAllocator->Allocate());
+        reclaimList->open();
+        vkCmdPipelineBarrier2(reclaimList->m_CommandBuffer, &reclaim);
+        reclaimList->close();
+
+        inFlight.reclaim = reclaimList;
+        graphicsWait     = m_Ctx.graphicsQueue->Submit(reclaimList).value;
+    }
+    if (graphicsWait)
+        transferSubmit.addDependency(QueueDependency(QueueType::GRAPHICS, graphicsWait));
+    inFlight.value = m_Ctx.transferQueue->Submit(transferSubmit).value;
+
+    if (m_NeedsOwnershipTransfer) {
+        // Acquire half: identical barriers with the destination scope filled in.
+        // It waits on the transfer timeline, and every later graphics submit is
+        // ordered behind it by the barrier's second scope.
+        for (auto& b : m_BufferBarriers) {
+            b.srcStageMask  = VK_PIPELINE_STAGE_2_NONE;
+            b.srcAccessMask = 0;
+            b.dstStageMask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            b.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT;
+        }
+        for (auto& b : m_ImageBarriers) {
+            b.srcStageMask  = VK_PIPELINE_STAGE_2_NONE;
+            b.srcAccessMask = 0;
+            b.dstStageMask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            b.dstAccessMask = VK_ACCESS_2_SHADER_READ_BIT;
+        }
 
-    // Submit to transfer queue
-    Timeline timeline = m_Ctx.transferQueue->Submit(cmdList);
+        auto* acquire = static_cast<VulkanCommandList*>(m_AcquireAllocator->Allocate());
+        acquire->open();
+        vkCmdPipelineBarrier2(acquire->m_CommandBuffer, &release);
+        acquire->close();
 
-    // Mark staging as submitted
-    m_Ctx.stagingAllocator->submit(timeline.value);
+        const Timeline acquired = m_Ctx.graphicsQueue->Submit(
+            SubmitInfo::Single(acquire).addDependency(QueueDependency(QueueType::TRANSFER, inFlight.value)));
+        inFlight.acquire      = acquire;
+        inFlight.acquireValue = acquired.value;
+    }
+
+    // Staging stays alive until the transfer queue passes this submission
+    for (const auto& upload : m_PendingBufferUploads)
+        m_Ctx.stagingAllocator->release(upload.staging, inFlight.value);
+    for (const auto& upload : m_PendingTextureUploads)
+        m_Ctx.stagingAllocator->release(upload.staging, inFlight.value);
 
-    // Clear pending uploads
     m_PendingBufferUploads.clear();
     m_PendingTextureUploads.clear();
+    m_InFlight.push_back(inFlight);
 
-    // Cleanup command allocator after submit
-    m_Ctx.transferQueue->DestroyCommandAllocator(cmdAllocator);
+    return Timeline(inFlight.value);
+}
 
-    return timeline;
+void VulkanDeferredUploader::orderCopy(VkCommandBuffer cmd, uint64_t resource, uint64_t begin, uint64_t end) {
+    const bool overlaps = std::any_of(m_CopyWrites.begin(), m_CopyWrites.end(), [&](const CopyWrite& w) {
+        return w.resource == resource && w.begin < end && begin < w.end;
+    });
+    if (overlaps) {
+        VkMemoryBarrier2 b{};
+        b.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+        b.srcStageMask  = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        b.dstStageMask  = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+
+        VkDependencyInfo dep{};
+        dep.sType              = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dep.memoryBarrierCount = 1;
+        dep.pMemoryBarriers    = &b;
+        vkCmdPipelineBarrier2(cmd, &dep);
+
+        // Everything recorded so far is now ordered before what follows
+        m_CopyWrites.clear();
+    }
+    m_CopyWrites.push_back({resource, begin, end});
 }
 
 void VulkanDeferredUploader::retire(uint64_t completedSubmission) {
-    // Staging allocator handles this automatically
-    m_Ctx.stagingAllocator->retire(completedSubmission);
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    recycle(completedSubmission);
 }
 
-VulkanLoadTimeStagingUploader::VulkanLoadTimeStagingUploader(VulkanContext& ctx)
+VulkanLoadTimeStagingUploader::VulkanLoadTimeStagingUploader(VulkanContext& ctx, uint32_t chunkSize)
     : m_Ctx(ctx) {
+    // Whole 256-byte blocks so every packed offset stays aligned
+    chunkSize = (std::max(chunkSize, 1024u * 1024u) + 255) & ~255u;
 
-    auto     device         = m_Ctx.device->logical();
-    uint32_t transferFamily = m_Ctx.device->transferFamily();
+    m_Allocator = m_Ctx.transferQueue->CreateCommandAllocator("LoadTimeUploadAllocator");
+    for (auto& chunk : m_Chunks) {
+        if (!createChunk(chunk, chunkSize))
+            break;
+    }
 
-    // Command pool on transfer queue
-    VkCommandPoolCreateInfo poolInfo{};
-    poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.queueFamilyIndex = transferFamily;
-    poolInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    VK_CHECK(vkCreateCommandPool(device, &poolInfo, nullptr, &m_Pool));
+    m_MipAllocator           = m_Ctx.graphicsQueue->CreateCommandAllocator("LoadTimeMipAllocator");
+    m_MipCmd                 = m_MipAllocator->Allocate();
+    m_NeedsOwnershipTransfer = m_Ctx.device->transferFamily() != m_Ctx.device->graphicsFamily();
+}
 
-    // Single command buffer — reused between flush() calls
-    VkCommandBufferAllocateInfo allocInfo{};
-    allocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.commandPool        = m_Pool;
-    allocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandBufferCount = 1;
-    VK_CHECK(vkAllocateCommandBuffers(device, &allocInfo, &m_Cmd));
+VulkanLoadTimeStagingUploader::~VulkanLoadTimeStagingUploader() {
+    // Waits for any copy still reading the chunks
+    m_Ctx.graphicsQueue->DestroyCommandAllocator(m_MipAllocator);
+    m_Ctx.transferQueue->DestroyCommandAllocator(m_Allocator);
+    for (auto& chunk : m_Chunks)
+        destroyChunk(chunk);
+    for (auto& chunk : m_Oversized)
+        destroyChunk(chunk);
+}
 
-    // Fence starts unsignaled — flush() submits then waits on it
-    VkFenceCreateInfo fenceInfo{};
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    VK_CHECK(vkCreateFence(device, &fenceInfo, nullptr, &m_Fence));
+bool VulkanLoadTimeStagingUploader::createChunk(Chunk& chunk, uint32_t size) {
+    const VmaAllocationCreateFlags flags =
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+    VmaAllocationInfo info{};
+    bool              ok = m_Ctx.allocator->createBuffer(
+        size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO, flags, chunk.buffer, chunk.allocation, &info);
+    if (!ok || !info.pMappedData) {
+        RENDERX_ERROR("[LoadUploader] Failed to create staging chunk ({:.2f} MB)", size / (1024.0f * 1024.0f));
+        return false;
+    }
+
+    chunk.mapped = static_cast<uint8_t*>(info.pMappedData);
+    chunk.size   = size;
+    chunk.head   = 0;
+    chunk.value  = 0;
+    chunk.cmd    = m_Allocator->Allocate();
+    return true;
 }
 
-VulkanLoadTimeStagingUploader::~VulkanLoadTimeStagingUploader() {
-    auto device = m_Ctx.device->logical();
+void VulkanLoadTimeStagingUploader::destroyChunk(Chunk& chunk) {
+    if (chunk.buffer != VK_NULL_HANDLE)
+        m_Ctx.allocator->destroyBuffer(chunk.buffer, chunk.allocation);
+    chunk = Chunk{};
+}
+
+void VulkanLoadTimeStagingUploader::advance() {
+    m_Current    = (m_Current + 1) % CHUNK_COUNT;
+    Chunk& chunk = m_Chunks[m_Current];
 
-    if (m_Fence != VK_NULL_HANDLE)
-        vkDestroyFence(device, m_Fence, nullptr);
+    // Only blocks when the CPU has packed a whole ring ahead of the GPU
+    if (chunk.value)
+        m_Ctx.transferQueue->Wait(Timeline(chunk.value));
+    chunk.head = 0;
+}
+
+uint32_t VulkanLoadTimeStagingUploader::reserve(uint32_t size, uint32_t alignment) {
+    Chunk&   chunk  = m_Chunks[m_Current];
+    uint32_t offset = (chunk.head + alignment - 1) & ~(alignment - 1);
+    if ((uint64_t)offset + size <= chunk.size)
+        return offset;
 
-    if (m_Pool != VK_NULL_HANDLE)
-        vkDestroyCommandPool(device, m_Pool, nullptr);
-    // m_Cmd is owned by m_Pool, destroyed implicitly
+    submit(chunk);
+    advance();
+    return 0;
 }
 
 void VulkanLoadTimeStagingUploader::uploadBuffer(VkBuffer dst, const void* data, uint32_t size, uint32_t dstOffset) {
@@ -606,176 +980,377 @@ void VulkanLoadTimeStagingUploader::uploadBuffer(VkBuffer dst, const void* data,
     RENDERX_ASSERT_MSG(data, "[LoadUploader] data pointer is null");
     RENDERX_ASSERT_MSG(size > 0, "[LoadUploader] upload size is 0");
 
-    uint32_t offset = pushData(data, size);
-    m_BufferUploads.push_back({dst, offset, dstOffset, size});
-    m_TotalSize += size;
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Chunks[m_Current].mapped)
+        return;
+
+    // Buffers copy byte ranges, so a large upload simply spans several chunks
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        uint32_t offset = reserve(std::min<uint32_t>(size, 256), 16);
+        Chunk&   chunk  = m_Chunks[m_Current];
+        uint32_t piece  = std::min(size, chunk.size - offset);
+
+        std::memcpy(chunk.mapped + offset, src, piece);
+        chunk.bufferUploads.push_back({dst, offset, dstOffset, piece});
+        chunk.head = offset + piece;
+
+        src += piece;
+        dstOffset += piece;
+        size -= piece;
+    }
 }
 
-void VulkanLoadTimeStagingUploader::uploadTexture(VkImage dst, const void* data, uint32_t size, const TextureCopy& region) {
+bool VulkanLoadTimeStagingUploader::uploadTexture(
+    VkImage dst, VkFormat format, const void* data, uint32_t size, const TextureCopy& region, bool mipSource) {
 
     RENDERX_ASSERT_MSG(dst != VK_NULL_HANDLE, "[LoadUploader] dst image is null");
     RENDERX_ASSERT_MSG(data, "[LoadUploader] data pointer is null");
     RENDERX_ASSERT_MSG(size > 0, "[LoadUploader] upload size is 0");
 
-    uint32_t offset = pushData(data, size);
-    m_TextureUploads.push_back({dst, offset, size, region});
-    m_TotalSize += size;
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Chunks[m_Current].mapped)
+        return false;
+
+    if (size > m_Chunks[m_Current].size) {
+        // Released by flush() once its copy has completed
+        Chunk oversized;
+        if (!createChunk(oversized, size))
+            return false;
+        std::memcpy(oversized.mapped, data, size);
+        oversized.textureUploads.push_back({dst, format, 0, size, region, mipSource});
+        oversized.head = size;
+        submit(oversized);
+        m_Oversized.push_back(std::move(oversized));
+        return true;
+    }
+
+    uint32_t offset = reserve(size, 16);
+    Chunk&   chunk  = m_Chunks[m_Current];
+
+    std::memcpy(chunk.mapped + offset, data, size);
+    chunk.textureUploads.push_back({dst, format, offset, size, region, mipSource});
+    chunk.head = offset + size;
+    return true;
 }
 
-void VulkanLoadTimeStagingUploader::flush() {
-    if (m_BufferUploads.empty() && m_TextureUploads.empty())
+void VulkanLoadTimeStagingUploader::generateMips(
+    VkImage image, VkExtent3D extent, uint32_t mipLevels, uint32_t arrayLayers, VkFilter filter) {
+
+    RENDERX_ASSERT_MSG(image != VK_NULL_HANDLE, "[LoadUploader] mip image is null");
+
+    if (mipLevels < 2)
         return;
 
-    RENDERX_INFO("[LoadUploader] Flushing {} buffer(s) and {} texture(s) ({:.2f} MB)",
-                 m_BufferUploads.size(),
-                 m_TextureUploads.size(),
-                 m_CPUData.size() / (1024.0f * 1024.0f));
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_MipRequests.push_back({image, extent, mipLevels, arrayLayers, filter});
+}
 
-    VkBuffer          stagingBuffer = VK_NULL_HANDLE;
-    VmaAllocation     stagingAlloc  = VK_NULL_HANDLE;
-    VmaAllocationInfo stagingInfo{};
+uint64_t VulkanLoadTimeStagingUploader::submitGraphics(uint64_t transferValue) {
+    auto* list = static_cast<VulkanCommandList*>(m_MipCmd);
+    list->open();
+    VkCommandBuffer cmd = list->m_CommandBuffer;
+
+    // Acquire half of the releases in submit(); the submit waits on the
+    // transfer timeline, so no source scope is needed
+    if (!m_AcquireBufferBarriers.empty() || !m_AcquireImageBarriers.empty()) {
+        VkDependencyInfo acquire{};
+        acquire.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        acquire.bufferMemoryBarrierCount = (uint32_t)m_AcquireBufferBarriers.size();
+        acquire.pBufferMemoryBarriers    = m_AcquireBufferBarriers.data();
+        acquire.imageMemoryBarrierCount  = (uint32_t)m_AcquireImageBarriers.size();
+        acquire.pImageMemoryBarriers     = m_AcquireImageBarriers.data();
+        vkCmdPipelineBarrier2(cmd, &acquire);
+        m_AcquireBufferBarriers.clear();
+        m_AcquireImageBarriers.clear();
+    }
 
-    VmaAllocationCreateInfo vmaCI{};
-    vmaCI.usage = VMA_MEMORY_USAGE_AUTO;
-    vmaCI.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    auto makeBarrier = [](VkImage image, uint32_t baseLevel, uint32_t levelCount, uint32_t layers) {
+        VkImageMemoryBarrier2 b{};
+        b.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+        b.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        b.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        b.image                           = image;
+        b.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        b.subresourceRange.baseMipLevel   = baseLevel;
+        b.subresourceRange.levelCount     = levelCount;
+        b.subresourceRange.baseArrayLayer = 0;
+        b.subresourceRange.layerCount     = layers;
+        return b;
+    };
+
+    VkDependencyInfo dep{};
+    dep.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+
+    auto flushBarriers = [&]() {
+        if (m_ImageBarriers.empty())
+            return;
+        dep.imageMemoryBarrierCount = (uint32_t)m_ImageBarriers.size();
+        dep.pImageMemoryBarriers    = m_ImageBarriers.data();
+        vkCmdPipelineBarrier2(cmd, &dep);
+        m_ImageBarriers.clear();
+    };
+
+    // Level 0 arrives in TRANSFER_SRC_OPTIMAL; across queue families this is
+    // the acquire matching the release in submit(). The rest become blit
+    // destinations. The submit waits on the transfer timeline, so no source
+    // scope is needed.
+    const uint32_t transferFamily = m_NeedsOwnershipTransfer ? m_Ctx.device->transferFamily() : VK_QUEUE_FAMILY_IGNORED;
+    const uint32_t graphicsFamily = m_NeedsOwnershipTransfer ? m_Ctx.device->graphicsFamily() : VK_QUEUE_FAMILY_IGNORED;
+
+    uint32_t maxLevels = 0;
+    for (const auto& req : m_MipRequests) {
+        VkImageMemoryBarrier2 src = makeBarrier(req.image, 0, 1, req.arrayLayers);
+        src.dstStageMask          = VK_PIPELINE_STAGE_2_BLIT_BIT;
+        src.dstAccessMask         = VK_ACCESS_2_TRANSFER_READ_BIT;
+        src.oldLayout             = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        src.newLayout             = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        src.srcQueueFamilyIndex   = transferFamily;
+        src.dstQueueFamilyIndex   = graphicsFamily;
+        m_ImageBarriers.push_back(src);
+
+        VkImageMemoryBarrier2 dst = makeBarrier(req.image, 1, req.mipLevels - 1, req.arrayLayers);
+        dst.dstStageMask          = VK_PIPELINE_STAGE_2_BLIT_BIT;
+        dst.dstAccessMask         = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        dst.oldLayout             = VK_IMAGE_LAYOUT_UNDEFINED;
+        dst.newLayout             = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        m_ImageBarriers.push_back(dst);
+
+        maxLevels = std::max(maxLevels, req.mipLevels);
+    }
+    flushBarriers();
+
+    // Walk the chains level by level so each step is one barrier batch for
+    // every texture instead of one per texture
+    for (uint32_t level = 1; level < maxLevels; level++) {
+        for (const auto& req : m_MipRequests) {
+            if (level >= req.mipLevels)
+                continue;
+
+            auto mipExtent = [&](uint32_t l) {
+                return VkOffset3D{(int32_t)std::max(1u, req.extent.width >> l),
+                                  (int32_t)std::max(1u, req.extent.height >> l),
+                                  (int32_t)std::max(1u, req.extent.depth >> l)};
+            };
+
+            VkImageBlit2 blit{};
+            blit.sType                         = VK_STRUCTURE_TYPE_IMAGE_BLIT_2;
+            blit.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.mipLevel       = level - 1;
+            blit.srcSubresource.baseArrayLayer = 0;
+            blit.srcSubresource.layerCount     = req.arrayLayers;
+            blit.srcOffsets[1]                 = mipExtent(level - 1);
+            blit.dstSubresource                = blit.srcSubresource;
+            blit.dstSubresource.mipLevel       = level;
+            blit.dstOffsets[1]                 = mipExtent(level);
+
+            VkBlitImageInfo2 info{};
+            info.sType          = VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2;
+            info.srcImage       = req.image;
+            info.srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            info.dstImage       = req.image;
+            info.dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            info.regionCount    = 1;
+            info.pRegions       = &blit;
+            info.filter         = req.filter;
+            vkCmdBlitImage2(cmd, &info);
+
+            // The level just written is the source of the next step
+            VkImageMemoryBarrier2 b = makeBarrier(req.image, level, 1, req.arrayLayers);
+            b.srcStageMask          = VK_PIPELINE_STAGE_2_BLIT_BIT;
+            b.srcAccessMask         = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            b.dstStageMask          = VK_PIPELINE_STAGE_2_BLIT_BIT;
+            b.dstAccessMask         = VK_ACCESS_2_TRANSFER_READ_BIT;
+            b.oldLayout             = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            b.newLayout             = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            m_ImageBarriers.push_back(b);
+        }
+        flushBarriers();
+    }
 
-    bool ok = m_Ctx.allocator->createBuffer((uint32_t)m_CPUData.size(),
-                                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                            VMA_MEMORY_USAGE_AUTO,
-                                            vmaCI.flags,
-                                            stagingBuffer,
-                                            stagingAlloc,
-                                            &stagingInfo);
+    // Every level ends up where the single-level upload path leaves level 0
+    for (const auto& req : m_MipRequests) {
+        VkImageMemoryBarrier2 b = makeBarrier(req.image, 0, req.mipLevels, req.arrayLayers);
+        b.srcStageMask          = VK_PIPELINE_STAGE_2_BLIT_BIT;
+        b.srcAccessMask         = VK_ACCESS_2_TRANSFER_READ_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        b.dstStageMask          = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        b.dstAccessMask         = VK_ACCESS_2_SHADER_READ_BIT;
+        b.oldLayout             = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        b.newLayout             = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        m_ImageBarriers.push_back(b);
+    }
+    flushBarriers();
 
-    RENDERX_ASSERT_MSG(ok, "[LoadUploader] Failed to create staging buffer ({:.2f} MB)", m_CPUData.size() / (1024.0f * 1024.0f));
+    list->close();
 
-    // Single memcpy — all data already packed in m_CPUData
-    std::memcpy(stagingInfo.pMappedData, m_CPUData.data(), m_CPUData.size());
+    SubmitInfo info = SubmitInfo::Single(list);
+    if (transferValue)
+        info.addDependency(QueueDependency(QueueType::TRANSFER, transferValue));
 
-    VkCommandBufferBeginInfo beginInfo{};
-    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    VK_CHECK(vkBeginCommandBuffer(m_Cmd, &beginInfo));
-
-    if (!m_TextureUploads.empty()) {
-        std::vector<VkImageMemoryBarrier> preBarriers;
-        preBarriers.reserve(m_TextureUploads.size());
-
-        for (auto& up : m_TextureUploads) {
-            VkImageMemoryBarrier b{};
-            b.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            b.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
-            b.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            b.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            b.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            b.image                           = up.dst;
-            b.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-            b.subresourceRange.baseMipLevel   = up.region.dstMipLevel;
-            b.subresourceRange.levelCount     = 1;
-            b.subresourceRange.baseArrayLayer = up.region.dstArrayLayer;
-            b.subresourceRange.layerCount     = 1;
-            b.srcAccessMask                   = 0;
-            b.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            preBarriers.push_back(b);
-        }
+    if (!m_MipRequests.empty())
+        RENDERX_INFO("[LoadUploader] Generating mips for {} textures", m_MipRequests.size());
+    m_MipRequests.clear();
+    return m_Ctx.graphicsQueue->Submit(info).value;
+}
 
-        vkCmdPipelineBarrier(m_Cmd,
-                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                             VK_PIPELINE_STAGE_TRANSFER_BIT,
-                             0,
-                             0,
-                             nullptr,
-                             0,
-                             nullptr,
-                             (uint32_t)preBarriers.size(),
-                             preBarriers.data());
+void VulkanLoadTimeStagingUploader::submit(Chunk& chunk) {
+    if (chunk.bufferUploads.empty() && chunk.textureUploads.empty())
+        return;
+
+    auto* list = static_cast<VulkanCommandList*>(chunk.cmd);
+    list->open();
+    VkCommandBuffer cmd = list->m_CommandBuffer;
+
+    m_ImageBarriers.clear();
+    for (auto& up : chunk.textureUploads) {
+        VkImageMemoryBarrier2 b{};
+        b.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+        b.srcStageMask                    = VK_PIPELINE_STAGE_2_NONE;
+        b.srcAccessMask                   = 0;
+        b.dstStageMask                    = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.dstAccessMask                   = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        b.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+        b.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        b.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        b.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        b.image                           = up.dst;
+        b.subresourceRange.aspectMask     = GetImageAspect(up.format);
+        b.subresourceRange.baseMipLevel   = up.region.dstMipLevel;
+        b.subresourceRange.levelCount     = 1;
+        b.subresourceRange.baseArrayLayer = up.region.dstArrayLayer;
+        b.subresourceRange.layerCount     = 1;
+        m_ImageBarriers.push_back(b);
     }
 
-    for (auto& up : m_BufferUploads) {
+    VkDependencyInfo dep{};
+    dep.sType                   = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    dep.imageMemoryBarrierCount = (uint32_t)m_ImageBarriers.size();
+    dep.pImageMemoryBarriers    = m_ImageBarriers.data();
+    if (!m_ImageBarriers.empty())
+        vkCmdPipelineBarrier2(cmd, &dep);
+
+    for (auto& up : chunk.bufferUploads) {
         VkBufferCopy region{};
         region.srcOffset = up.stagingOffset;
         region.dstOffset = up.dstOffset;
         region.size      = up.size;
-        vkCmdCopyBuffer(m_Cmd, stagingBuffer, up.dst, 1, &region);
+        vkCmdCopyBuffer(cmd, chunk.buffer, up.dst, 1, &region);
     }
 
-    for (auto& up : m_TextureUploads) {
+    for (auto& up : chunk.textureUploads) {
         VkBufferImageCopy region{};
         region.bufferOffset                    = up.stagingOffset;
         region.bufferRowLength                 = 0; // tightly packed
         region.bufferImageHeight               = 0;
-        region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.aspectMask     = GetCopyAspect(up.format);
         region.imageSubresource.mipLevel       = up.region.dstMipLevel;
         region.imageSubresource.baseArrayLayer = up.region.dstArrayLayer;
         region.imageSubresource.layerCount     = 1;
         region.imageOffset = {(int32_t)up.region.dstOffset.x, (int32_t)up.region.dstOffset.y, (int32_t)up.region.dstOffset.z};
         region.imageExtent = {(uint32_t)up.region.extent.x, (uint32_t)up.region.extent.y, (uint32_t)up.region.extent.z};
-        vkCmdCopyBufferToImage(m_Cmd, stagingBuffer, up.dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-    }
-
-    if (!m_TextureUploads.empty()) {
-        std::vector<VkImageMemoryBarrier> postBarriers;
-        postBarriers.reserve(m_TextureUploads.size());
-
-        for (auto& up : m_TextureUploads) {
-            VkImageMemoryBarrier b{};
-            b.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            b.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            b.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            b.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            b.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            b.image                           = up.dst;
-            b.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-            b.subresourceRange.baseMipLevel   = up.region.dstMipLevel;
-            b.subresourceRange.levelCount     = 1;
-            b.subresourceRange.baseArrayLayer = up.region.dstArrayLayer;
-            b.subresourceRange.layerCount     = 1;
-            b.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            b.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
-            postBarriers.push_back(b);
+        vkCmdCopyBufferToImage(cmd, chunk.buffer, up.dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    }
+
+    // Writes become visible to every later stage once the transfer completes.
+    // Mip sources instead stay blit-ready. Across queue families every write
+    // is released here with no destination scope, and the graphics queue
+    // acquires it in submitGraphics() before anything there reads it.
+    const uint32_t transferFamily = m_NeedsOwnershipTransfer ? m_Ctx.device->transferFamily() : VK_QUEUE_FAMILY_IGNORED;
+    const uint32_t graphicsFamily = m_NeedsOwnershipTransfer ? m_Ctx.device->graphicsFamily() : VK_QUEUE_FAMILY_IGNORED;
+    for (size_t i = 0; i < m_ImageBarriers.size(); i++) {
+        auto& b               = m_ImageBarriers[i];
+        b.srcStageMask        = VK_PIPELINE_STAGE_2_COPY_BIT;
+        b.srcAccessMask       = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        b.oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        b.srcQueueFamilyIndex = transferFamily;
+        b.dstQueueFamilyIndex = graphicsFamily;
+        if (chunk.textureUploads[i].mipSource) {
+            b.dstStageMask  = VK_PIPELINE_STAGE_2_NONE;
+            b.dstAccessMask = 0;
+            b.newLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            continue;
+        }
+        b.dstStageMask  = m_NeedsOwnershipTransfer ? VK_PIPELINE_STAGE_2_NONE : VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        b.dstAccessMask = m_NeedsOwnershipTransfer ? 0 : VK_ACCESS_2_SHADER_READ_BIT;
+        b.newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        if (m_NeedsOwnershipTransfer) {
+            VkImageMemoryBarrier2 acquire = b;
+            acquire.srcStageMask          = VK_PIPELINE_STAGE_2_NONE;
+            acquire.srcAccessMask         = 0;
+            acquire.dstStageMask          = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            acquire.dstAccessMask         = VK_ACCESS_2_SHADER_READ_BIT;
+            m_AcquireImageBarriers.push_back(acquire);
         }
+    }
 
-        vkCmdPipelineBarrier(m_Cmd,
-                             VK_PIPELINE_STAGE_TRANSFER_BIT,
-                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                             0,
-                             0,
-                             nullptr,
-                             0,
-                             nullptr,
-                             (uint32_t)postBarriers.size(),
-                             postBarriers.data());
+    m_BufferBarriers.clear();
+    if (m_NeedsOwnershipTransfer) {
+        for (auto& up : chunk.bufferUploads) {
+            VkBufferMemoryBarrier2 b{};
+            b.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+            b.srcStageMask        = VK_PIPELINE_STAGE_2_COPY_BIT;
+            b.srcAccessMask       = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            b.dstStageMask        = VK_PIPELINE_STAGE_2_NONE;
+            b.dstAccessMask       = 0;
+            b.srcQueueFamilyIndex = transferFamily;
+            b.dstQueueFamilyIndex = graphicsFamily;
+            b.buffer              = up.dst;
+            b.offset              = up.dstOffset;
+            b.size                = up.size;
+            m_BufferBarriers.push_back(b);
+
+            b.srcStageMask  = VK_PIPELINE_STAGE_2_NONE;
+            b.srcAccessMask = 0;
+            b.dstStageMask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            b.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT;
+            m_AcquireBufferBarriers.push_back(b);
+        }
     }
 
-    VK_CHECK(vkEndCommandBuffer(m_Cmd));
+    dep.bufferMemoryBarrierCount = (uint32_t)m_BufferBarriers.size();
+    dep.pBufferMemoryBarriers    = m_BufferBarriers.data();
+    if (!m_ImageBarriers.empty() || !m_BufferBarriers.empty())
+        vkCmdPipelineBarrier2(cmd, &dep);
 
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers    = &m_Cmd;
+    list->close();
+    chunk.value = m_Ctx.transferQueue->Submit(list).value;
 
-    VK_CHECK(vkQueueSubmit(m_Ctx.device->transferQueue(), 1, &submitInfo, m_Fence));
-    VK_CHECK(vkWaitForFences(m_Ctx.device->logical(), 1, &m_Fence, VK_TRUE, UINT64_MAX));
-    VK_CHECK(vkResetFences(m_Ctx.device->logical(), 1, &m_Fence));
+    m_Submitted += chunk.head;
+    chunk.bufferUploads.clear();
+    chunk.textureUploads.clear();
+}
 
-    m_Ctx.allocator->destroyBuffer(stagingBuffer, stagingAlloc);
+void VulkanLoadTimeStagingUploader::flush() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
 
-    RENDERX_INFO("[LoadUploader] Flush complete — staging memory freed");
+    Chunk& current = m_Chunks[m_Current];
+    submit(current);
+    if (m_Submitted == 0 && m_MipRequests.empty())
+        return;
 
-    m_CPUData.clear();
-    m_BufferUploads.clear();
-    m_TextureUploads.clear();
-    m_TotalSize = 0;
+    RENDERX_INFO("[LoadUploader] Flushing {:.2f} MB", m_Submitted / (1024.0f * 1024.0f));
 
-    vkResetCommandBuffer(m_Cmd, 0);
-}
+    // Submissions complete in order, so the newest value covers them all
+    uint64_t last = 0;
+    for (const auto& chunk : m_Chunks)
+        last = std::max(last, chunk.value);
+    for (const auto& chunk : m_Oversized)
+        last = std::max(last, chunk.value);
+
+    if (!m_MipRequests.empty() || !m_AcquireBufferBarriers.empty() || !m_AcquireImageBarriers.empty())
+        m_Ctx.graphicsQueue->Wait(Timeline(submitGraphics(last)));
+    m_Ctx.transferQueue->Wait(Timeline(last));
+
+    for (auto& chunk : m_Oversized) {
+        m_Allocator->Free(chunk.cmd);
+        destroyChunk(chunk);
+    }
+    m_Oversized.clear();
+
+    current.head = 0;
+    m_Submitted  = 0;
 
-uint32_t VulkanLoadTimeStagingUploader::pushData(const void* data, uint32_t size, uint32_t alignment) {
-    // Pad to alignment boundary
-    uint32_t offset = (uint32_t)((m_CPUData.size() + alignment - 1) & ~(alignment - 1));
-    m_CPUData.resize(offset + size);
-    std::memcpy(m_CPUData.data() + offset, data, size);
-    return offset;
+    RENDERX_INFO("[LoadUploader] Flush complete");
 }
 
 void VKFlushUploads() {
@@ -783,5 +1358,17 @@ void VKFlushUploads() {
     ctx.loadTimeStagingUploader->flush();
 }
 
+bool VKUploadBuffer(BufferHandle dst, const void* data, uint32_t size, uint32_t dstOffset) {
+    return GetVulkanContext().deferredUploader->uploadBuffer(dst, data, size, dstOffset);
+}
+
+bool VKUploadTexture(TextureHandle dst, const void* data, uint32_t size, const TextureCopy& region) {
+    return GetVulkanContext().deferredUploader->uploadTexture(dst, data, size, region);
+}
+
+Timeline VKSubmitUploads() {
+    return GetVulkanContext().deferredUploader->flush();
+}
+
 } // namespace RxVK
 } // namespace Rx
@@ -105,8 +105,12 @@ void VulkanSwapchain::Present(uint32_t imageIndex) {
     info.swapchainCount     = 1;
     info.pSwapchains        = &m_Swapchain;
     info.pImageIndices      = &imageIndex;
-    VK_CHECK(vkQueuePresentKHR(ctx.graphicsQueue->Queue(), &info));
+    VK_CHECK(ctx.graphicsQueue->Present(info));
     m_currentSemaphoreIndex = (m_currentSemaphoreIndex + 1) % m_Info.maxFramesInFlight;
+
+    // Presenting marks the end of a frame on the frame thread, which is where
+    // deferred destruction runs when no FrameContext is driving it
+    ctx.deletionQueue->retire();
 }
 void VulkanSwapchain::Resize(uint32_t width, uint32_t height) {
     recreate(width, height);
@@ -194,6 +198,11 @@ void VulkanSwapchain::destroySwapchain() {
     m_ImageViewsHandles.clear();
     m_DepthViewHandles.clear();
 
+    // The views above went through the deletion queue; they have to be gone
+    // before their swapchain images are, so drain it on an idle device.
+    vkDeviceWaitIdle(ctx.device->logical());
+    ctx.deletionQueue->retire();
+
     if (m_Swapchain) {
         vkDestroySwapchainKHR(ctx.device->logical(), m_Swapchain, nullptr);
         m_Swapchain = VK_NULL_HANDLE;
@@ -242,7 +251,12 @@ VkExtent2D VulkanSwapchain::chooseExtent(uint32_t width, uint32_t height) const
 
 // renderx API implemention
 Swapchain* VKCreateSwapchain(const SwapchainDesc& desc) {
-    auto&               ctx = GetVulkanContext();
+    auto& ctx = GetVulkanContext();
+    if (ctx.instance->getSurface() == VK_NULL_HANDLE) {
+        RENDERX_ERROR("VKCreateSwapchain: initialized headless (WindowSystem::NONE), there is no surface to present to");
+        return nullptr;
+    }
+
     SwapchainCreateInfo info{};
     info.height               = desc.height;
     info.width                = desc.width;
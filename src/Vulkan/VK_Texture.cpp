@@ -16,19 +16,6 @@ static uint32_t CalculateMipLevels(uint32_t width, uint32_t height, uint32_t dep
     return mipLevels;
 }
 
-static bool IsDepthFormat(VkFormat format) {
-    return format == VK_FORMAT_D16_UNORM || format == VK_FORMAT_D32_SFLOAT || format == VK_FORMAT_D24_UNORM_S8_UINT ||
-           format == VK_FORMAT_D32_SFLOAT_S8_UINT;
-}
-
-static bool IsStencilFormat(VkFormat format) {
-    return format == VK_FORMAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT || format == VK_FORMAT_D32_SFLOAT_S8_UINT;
-}
-
-static bool IsDepthStencilFormat(VkFormat format) {
-    return IsDepthFormat(format) || IsStencilFormat(format);
-}
-
 // Build VkImageUsageFlags directly from TextureDesc::usage.
 // This replaces GetDefaultImageUsageFlags which ignored the desc flags entirely.
 static VkImageUsageFlags BuildImageUsageFlags(const TextureDesc& desc) {
@@ -61,6 +48,21 @@ static VkImageUsageFlags BuildImageUsageFlags(const TextureDesc& desc) {
     return usage;
 }
 
+// Blit filter for generating mips of `format`, or VK_FILTER_MAX_ENUM when the
+// format cannot be blitted at all (compressed, depth, some integer formats)
+static VkFilter GetMipFilter(VkPhysicalDevice physical, VkFormat format) {
+    VkFormatProperties props{};
+    vkGetPhysicalDeviceFormatProperties(physical, format, &props);
+
+    const VkFormatFeatureFlags features = props.optimalTilingFeatures;
+    if (IsDepthStencilFormat(format) ||
+        (features & (VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT)) !=
+            (VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT))
+        return VK_FILTER_MAX_ENUM;
+
+    return (features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+}
+
 TextureHandle VKCreateTexture(const TextureDesc& desc) {
     auto& ctx = GetVulkanContext();
 
@@ -69,8 +71,26 @@ TextureHandle VKCreateTexture(const TextureDesc& desc) {
     texture.height      = desc.height;
     texture.arrayLayers = desc.arrayLayers > 0 ? desc.arrayLayers : 1;
     texture.format      = ToVulkanFormat(desc.format);
-    texture.mipLevels =
-        desc.generateMips ? CalculateMipLevels(desc.width, desc.height, desc.depth) : std::max(1u, desc.mipLevels);
+    texture.mipLevels   = std::max(1u, desc.mipLevels);
+
+    // Mips are blitted from the initial data; with none there is nothing to
+    // generate them from
+    if (desc.generateMips && !desc.initialData) {
+        RENDERX_ERROR("VKCreateTexture: '{}' sets generateMips without initialData",
+                      desc.debugName ? desc.debugName : "<unnamed>");
+        return {};
+    }
+
+    VkFilter mipFilter = VK_FILTER_MAX_ENUM;
+    if (desc.generateMips) {
+        mipFilter = GetMipFilter(ctx.device->physical(), texture.format);
+        if (mipFilter == VK_FILTER_MAX_ENUM)
+            RENDERX_WARN("VKCreateTexture: format {} cannot be blitted, '{}' keeps a single mip level",
+                         static_cast<int>(desc.format),
+                         desc.debugName ? desc.debugName : "<unnamed>");
+        else
+            texture.mipLevels = CalculateMipLevels(desc.width, desc.height, desc.depth);
+    }
     texture.debugName        = desc.debugName;
     texture.isSwapchainImage = false;
 
@@ -123,13 +143,60 @@ TextureHandle VKCreateTexture(const TextureDesc& desc) {
     }
 
     if (desc.initialData) {
-        TextureCopy cpy = TextureCopy::FullTexture(desc.width, desc.height, desc.depth);
-        ctx.loadTimeStagingUploader->uploadTexture(texture.image, desc.initialData, desc.size, cpy);
+        // Levels 1..N are filled from level 0 at the next FlushUploads; the
+        // initial data covers the first layer only
+        const bool  mipSource = texture.mipLevels > 1 && mipFilter != VK_FILTER_MAX_ENUM;
+        TextureCopy cpy       = TextureCopy::FullTexture(desc.width, desc.height, desc.depth);
+        auto*       uploader  = ctx.loadTimeStagingUploader;
+        if (uploader->uploadTexture(texture.image, texture.format, desc.initialData, desc.size, cpy, mipSource)) {
+            if (mipSource)
+                uploader->generateMips(texture.image, imageInfo.extent, texture.mipLevels, 1, mipFilter);
+
+            // The uploader leaves every level it wrote shader-readable on the graphics family
+            VulkanSubresourceState uploaded = texture.state.global;
+            VulkanAccessState&     written  = isDepth ? uploaded.depth : uploaded.color;
+            written.layout                  = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            written.stageMask               = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            written.accessMask              = VK_ACCESS_2_SHADER_READ_BIT;
+            if (isDepth)
+                uploaded.stencil = uploaded.depth;
+
+            const uint32_t levels = mipSource ? texture.mipLevels : 1;
+            for (uint32_t mip = 0; mip < levels; ++mip)
+                SetSubresourceState(texture.state, SubresourceIndex(texture, mip, 0), uploaded);
+        }
     }
 
     return g_TexturePool.allocate(std::move(texture));
 }
 
+FormatFeature VKGetFormatFeatures(Format format) {
+    const VkFormat vkFormat = ToVulkanFormat(format);
+    if (vkFormat == VK_FORMAT_UNDEFINED)
+        return FormatFeature::NONE;
+
+    VkFormatProperties props{};
+    vkGetPhysicalDeviceFormatProperties(GetVulkanContext().device->physical(), vkFormat, &props);
+    const VkFormatFeatureFlags features = props.optimalTilingFeatures;
+
+    FormatFeature result = FormatFeature::NONE;
+    if (features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT)
+        result |= FormatFeature::SAMPLED;
+    if (features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)
+        result |= FormatFeature::FILTER_LINEAR;
+    if (features & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT)
+        result |= FormatFeature::STORAGE;
+    if (features & VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT)
+        result |= FormatFeature::RENDER_TARGET;
+    if (features & VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT)
+        result |= FormatFeature::BLEND;
+    if (features & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT)
+        result |= FormatFeature::DEPTH_STENCIL;
+    if ((features & VK_FORMAT_FEATURE_BLIT_SRC_BIT) && (features & VK_FORMAT_FEATURE_BLIT_DST_BIT))
+        result |= FormatFeature::BLIT;
+    return result;
+}
+
 void VKDestroyTexture(TextureHandle& handle) {
     auto* tex = g_TexturePool.get(handle);
     if (!tex)
@@ -138,7 +205,7 @@ void VKDestroyTexture(TextureHandle& handle) {
     auto& ctx = GetVulkanContext();
 
     if (!tex->isSwapchainImage && tex->image != VK_NULL_HANDLE) {
-        ctx.allocator->destroyImage(tex->image, tex->allocation);
+        ctx.deletionQueue->destroyImage(tex->image, tex->allocation);
     }
 
     g_TexturePool.free(handle);
@@ -199,7 +266,14 @@ TextureViewHandle VKCreateTextureView(const TextureViewDesc& desc) {
         return {};
     }
 
-    return g_TextureViewPool.allocate(std::move(view));
+    TextureViewHandle handle = g_TextureViewPool.allocate(std::move(view));
+    if (desc.bindlessTable.isValid()) {
+        auto* stored          = g_TextureViewPool.get(handle);
+        stored->bindlessTable = desc.bindlessTable;
+        stored->bindlessType  = desc.bindlessType;
+        stored->bindlessIndex = RegisterBindlessDescriptor(desc.bindlessTable, desc.bindlessType, handle.id);
+    }
+    return handle;
 }
 
 void VKDestroyTextureView(TextureViewHandle& handle) {
@@ -208,8 +282,12 @@ void VKDestroyTextureView(TextureViewHandle& handle) {
         return;
 
     if (view->view != VK_NULL_HANDLE) {
-        vkDestroyImageView(GetVulkanContext().device->logical(), view->view, nullptr);
+        GetVulkanContext().deletionQueue->destroyImageView(view->view);
     }
+    if (view->bindlessIndex != BindlessTableDesc::INVALID_INDEX) {
+        GetVulkanContext().deletionQueue->releaseBindlessIndex(view->bindlessTable, view->bindlessType, view->bindlessIndex);
+    }
+    InvalidateCachedSets(ResourceType::TEXTURE_SRV, handle.id);
 
     g_TextureViewPool.free(handle);
 }
@@ -358,7 +436,13 @@ SamplerHandle VKCreateSampler(const SamplerDesc& desc) {
     //     vkSetDebugUtilsObjectNameEXT(ctx.device->logical(), &nameInfo);
     // }
 
-    return g_SamplerPool.allocate(sampler);
+    SamplerHandle handle = g_SamplerPool.allocate(sampler);
+    if (desc.bindlessTable.isValid()) {
+        auto* stored          = g_SamplerPool.get(handle);
+        stored->bindlessTable = desc.bindlessTable;
+        stored->bindlessIndex = RegisterBindlessDescriptor(desc.bindlessTable, ResourceType::SAMPLER, handle.id);
+    }
+    return handle;
 }
 
 void VKDestroySampler(SamplerHandle& handle) {
@@ -367,7 +451,10 @@ void VKDestroySampler(SamplerHandle& handle) {
         return;
 
     if (s->vkSampler != VK_NULL_HANDLE)
-        vkDestroySampler(GetVulkanContext().device->logical(), s->vkSampler, nullptr);
+        GetVulkanContext().deletionQueue->destroySampler(s->vkSampler);
+    if (s->bindlessIndex != BindlessTableDesc::INVALID_INDEX)
+        GetVulkanContext().deletionQueue->releaseBindlessIndex(s->bindlessTable, ResourceType::SAMPLER, s->bindlessIndex);
+    InvalidateCachedSets(ResourceType::SAMPLER, handle.id);
 
     g_SamplerPool.free(handle);
 }